@@ -0,0 +1,63 @@
+#ifndef CONTADOR_ALOCACOES_H
+#define CONTADOR_ALOCACOES_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief Contagem das alocações do programa inteiro
+ *
+ * Incluir em um único .cpp por executável: este cabeçalho substitui os
+ * operadores new/delete globais. Cada bloco leva um cabeçalho de 16
+ * bytes com o seu tamanho, e os contadores somam o que foi pedido (sem
+ * o cabeçalho nem a sobra do malloc, que ainda custa uns 8 a 16 bytes
+ * por bloco na prática).
+ */
+struct ContadorAlocacoes {
+    static inline std::atomic<long long> bytesVivos{0};     // Bytes pedidos e ainda não liberados
+    static inline std::atomic<long long> blocosVivos{0};    // Blocos ainda não liberados
+    static inline std::atomic<long long> alocacoes{0};      // Total de chamadas a new desde o início
+    static const std::size_t CABECALHO = 16;
+};
+
+void* operator new(std::size_t tamanho) {
+    void* bloco = std::malloc(tamanho + ContadorAlocacoes::CABECALHO);
+    if (!bloco) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(bloco) = tamanho;
+    ContadorAlocacoes::bytesVivos += static_cast<long long>(tamanho);
+    ContadorAlocacoes::blocosVivos++;
+    ContadorAlocacoes::alocacoes++;
+    return static_cast<char*>(bloco) + ContadorAlocacoes::CABECALHO;
+}
+
+void operator delete(void* ponteiro) noexcept {
+    if (!ponteiro) {
+        return;
+    }
+    void* bloco = static_cast<char*>(ponteiro) - ContadorAlocacoes::CABECALHO;
+    ContadorAlocacoes::bytesVivos -= static_cast<long long>(*static_cast<std::size_t*>(bloco));
+    ContadorAlocacoes::blocosVivos--;
+    std::free(bloco);
+}
+
+void* operator new[](std::size_t tamanho) {
+    return operator new(tamanho);
+}
+
+void operator delete[](void* ponteiro) noexcept {
+    operator delete(ponteiro);
+}
+
+void operator delete(void* ponteiro, std::size_t) noexcept {
+    operator delete(ponteiro);
+}
+
+void operator delete[](void* ponteiro, std::size_t) noexcept {
+    operator delete(ponteiro);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef CRONOMETRO_H
+#define CRONOMETRO_H
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+/**
+ * @brief Cronômetro simples para os benchmarks do projeto
+ *
+ * Usa steady_clock, que não sofre ajustes do relógio do sistema.
+ */
+class Cronometro {
+private:
+    std::chrono::steady_clock::time_point inicio;  // Momento da última partida
+
+public:
+    /**
+     * @brief Construtor - já inicia a contagem
+     */
+    Cronometro() : inicio(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Reinicia a contagem a partir de agora
+     */
+    void reiniciar() {
+        inicio = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Tempo decorrido desde a partida
+     * @return Milissegundos decorridos
+     */
+    double decorridoMs() const {
+        std::chrono::duration<double, std::milli> duracao = std::chrono::steady_clock::now() - inicio;
+        return duracao.count();
+    }
+};
+
+/**
+ * @brief Lê um tamanho da linha de comando, com valor padrão
+ * @param argc Número de argumentos
+ * @param argv Argumentos
+ * @param indice Posição do argumento desejado
+ * @param padrao Valor usado quando o argumento não foi informado
+ * @return Valor lido ou padrão
+ */
+inline long lerArgumento(int argc, char* argv[], int indice, long padrao) {
+    if (indice < argc) {
+        long valor = std::atol(argv[indice]);
+        if (valor > 0) {
+            return valor;
+        }
+    }
+    return padrao;
+}
+
+/**
+ * @brief Largura a passar para std::setw para um texto ocupar um número de colunas
+ * @param texto Texto em UTF-8
+ * @param colunas Colunas que o texto deve ocupar na tela
+ * @return Colunas mais os bytes de continuação do texto
+ *
+ * setw conta bytes, e cada caractere acentuado ocupa dois em UTF-8.
+ */
+inline int larguraExibicao(const std::string& texto, int colunas) {
+    for (char c : texto) {
+        colunas += (c & 0xC0) == 0x80;
+    }
+    return colunas;
+}
+
+#endif
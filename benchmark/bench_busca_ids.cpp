@@ -0,0 +1,228 @@
+#include "../src/estruturas_sequenciais/ListaOrdenada.h"
+#include "../src/estruturas_sequenciais/ListaNaoOrdenada.h"
+#include "../src/estruturas_encadeadas/ArvoreBinariaBusca.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief getID como era antes: uma chamada para outra unidade de compilação
+ *
+ * Sem LTO, o compilador não enxergava o corpo de Elemento::getID e fazia
+ * uma chamada por comparação. O ponteiro volatile reproduz isso: a chamada
+ * não pode ser expandida nem tirada do laço.
+ */
+long obterIdPorChamada(const Elemento& elemento) {
+    return elemento.getID();
+}
+long (*volatile obterIdForaDeLinha)(const Elemento&) = obterIdPorChamada;
+
+struct IdForaDeLinha {
+    long operator()(const Elemento& elemento) const { return obterIdForaDeLinha(elemento); }
+};
+
+struct IdInline {
+    long operator()(const Elemento& elemento) const { return elemento.getID(); }
+};
+
+/**
+ * @brief Busca binária de ListaOrdenada sobre os ponteiros, sem a cópia dos IDs
+ */
+template<typename ObterId>
+const Elemento* buscaBinaria(const std::vector<const Elemento*>& elementos, long id, ObterId obterId) {
+    int esquerda = 0;
+    int direita = static_cast<int>(elementos.size()) - 1;
+    while (esquerda <= direita) {
+        int meio = esquerda + (direita - esquerda) / 2;
+        long idMeio = obterId(*elementos[meio]);
+        if (idMeio == id) {
+            return elementos[meio];
+        }
+        if (idMeio < id) {
+            esquerda = meio + 1;
+        } else {
+            direita = meio - 1;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Árvore com o mesmo formato da ArvoreBinariaBusca, mas sem o ID no nó
+ */
+struct NoSemId {
+    const Elemento* dados;
+    std::unique_ptr<NoSemId> esquerdo;
+    std::unique_ptr<NoSemId> direito;
+};
+
+void inserirSemId(std::unique_ptr<NoSemId>& raiz, const Elemento* elemento) {
+    std::unique_ptr<NoSemId>* atual = &raiz;
+    while (*atual) {
+        atual = elemento->getID() < (*atual)->dados->getID() ? &(*atual)->esquerdo : &(*atual)->direito;
+    }
+    *atual = std::make_unique<NoSemId>(NoSemId{elemento, nullptr, nullptr});
+}
+
+// Recursiva, como ArvoreBinariaBusca::buscarRecursivo
+template<typename ObterId>
+const Elemento* buscarSemId(const NoSemId* no, long id, ObterId obterId) {
+    if (!no) {
+        return nullptr;
+    }
+    long idNo = obterId(*no->dados);
+    if (id == idNo) {
+        return no->dados;
+    }
+    return buscarSemId(id < idNo ? no->esquerdo.get() : no->direito.get(), id, obterId);
+}
+
+/**
+ * @brief Busca linear de ListaNaoOrdenada sobre os ponteiros
+ */
+template<typename ObterId>
+const Elemento* buscaLinear(const std::vector<const Elemento*>& elementos, long id, ObterId obterId) {
+    for (const Elemento* elemento : elementos) {
+        if (obterId(*elemento) == id) {
+            return elemento;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Mede uma busca para cada ID da lista
+ * @return Nanossegundos por busca
+ */
+template<typename Busca>
+double medir(const std::vector<long>& consultas, long& conferencia, Busca busca) {
+    Cronometro cronometro;
+    for (long id : consultas) {
+        const Elemento* encontrado = busca(id);
+        conferencia += encontrado ? encontrado->getID() : -1;
+    }
+    return cronometro.decorridoMs() * 1e6 / static_cast<double>(consultas.size());
+}
+
+void imprimirLinha(const std::string& estrutura, long elementos, double foraDeLinha, double emLinha, double comCache) {
+    std::cout << "  " << std::left << std::setw(larguraExibicao(estrutura, 28)) << estrutura
+              << std::setw(12) << elementos
+              << std::fixed << std::setprecision(1)
+              << std::setw(17) << foraDeLinha
+              << std::setw(15) << emLinha
+              << std::setw(15) << comCache
+              << foraDeLinha / comCache << "x" << std::endl;
+}
+
+/**
+ * @brief Produtos com IDs de 0 a n-1 criados em ordem aleatória
+ *
+ * A ordem de criação decide onde cada objeto fica no heap: vizinhos por
+ * ID não são vizinhos na memória, como em um cadastro real.
+ */
+std::vector<std::unique_ptr<Elemento>> criarEmbaralhados(long quantidade, std::mt19937& gerador) {
+    std::vector<long> ids(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        ids[i] = i;
+    }
+    std::shuffle(ids.begin(), ids.end(), gerador);
+    std::vector<std::unique_ptr<Elemento>> elementos;
+    elementos.reserve(quantidade);
+    for (long id : ids) {
+        elementos.push_back(std::make_unique<Produto>(id, "Produto", "Categoria", "Marca", 10.0, 1));
+    }
+    return elementos;
+}
+
+std::vector<long> sortearConsultas(long quantidade, long maiorId, std::mt19937& gerador) {
+    std::uniform_int_distribution<long> distribuicao(0, maiorId - 1);
+    std::vector<long> consultas(quantidade);
+    for (long& id : consultas) {
+        id = distribuicao(gerador);
+    }
+    return consultas;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    long quantidadeLinear = std::min(quantidade, 100000L);
+    std::mt19937 gerador(49);
+    long conferencia = 0;
+
+    std::cout << std::string(104, '=') << std::endl;
+    std::cout << "BENCHMARK: BUSCA POR ID (ns por busca, sem LTO)" << std::endl;
+    std::cout << "getID fora de linha: uma chamada por comparação, como antes | getID inline: leitura direta do campo" << std::endl;
+    std::cout << "ID em cache: a própria estrutura, que guarda o ID ao lado do ponteiro | Ganho: fora de linha / cache" << std::endl;
+    std::cout << std::string(104, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(28) << "Estrutura"
+              << std::setw(12) << "Elementos"
+              << std::setw(17) << "Fora de linha"
+              << std::setw(15) << "getID inline"
+              << std::setw(15) << "ID em cache"
+              << "Ganho" << std::endl;
+
+    {
+        std::vector<std::unique_ptr<Elemento>> elementos = criarEmbaralhados(quantidade, gerador);
+        std::sort(elementos.begin(), elementos.end(),
+                  [](const std::unique_ptr<Elemento>& a, const std::unique_ptr<Elemento>& b) { return Elemento::menorId(*a, *b); });
+        ListaOrdenada lista(static_cast<int>(quantidade));
+        for (auto& elemento : elementos) {
+            lista.InserirNoFinal(std::move(elemento));
+        }
+        std::vector<const Elemento*> ponteiros;
+        for (int i = 0; i < lista.getTamanho(); i++) {
+            ponteiros.push_back(lista.obterElementoPorIndice(i));
+        }
+        std::vector<long> consultas = sortearConsultas(1000000, quantidade, gerador);
+        imprimirLinha("ListaOrdenada (binária)", quantidade,
+            medir(consultas, conferencia, [&ponteiros](long id) { return buscaBinaria(ponteiros, id, IdForaDeLinha()); }),
+            medir(consultas, conferencia, [&ponteiros](long id) { return buscaBinaria(ponteiros, id, IdInline()); }),
+            medir(consultas, conferencia, [&lista](long id) { return lista.BuscarPeloId(id); }));
+    }
+
+    {
+        std::vector<std::unique_ptr<Elemento>> elementos = criarEmbaralhados(quantidade, gerador);
+        std::unique_ptr<NoSemId> raizSemId;
+        for (const auto& elemento : elementos) {
+            inserirSemId(raizSemId, elemento.get());
+        }
+        // Mesma ordem de inserção: as duas árvores têm o mesmo formato
+        ArvoreBinariaBusca arvore;
+        for (const auto& elemento : elementos) {
+            arvore.inserir(std::make_unique<Produto>(elemento->getID(), "Produto", "Categoria", "Marca", 10.0, 1));
+        }
+        std::vector<long> consultas = sortearConsultas(1000000, quantidade, gerador);
+        const NoSemId* raiz = raizSemId.get();
+        imprimirLinha("ArvoreBinariaBusca", quantidade,
+            medir(consultas, conferencia, [raiz](long id) { return buscarSemId(raiz, id, IdForaDeLinha()); }),
+            medir(consultas, conferencia, [raiz](long id) { return buscarSemId(raiz, id, IdInline()); }),
+            medir(consultas, conferencia, [&arvore](long id) { return arvore.buscarPeloId(id); }));
+    }
+
+    {
+        std::vector<std::unique_ptr<Elemento>> elementos = criarEmbaralhados(quantidadeLinear, gerador);
+        ListaNaoOrdenada lista(static_cast<int>(quantidadeLinear));
+        std::vector<const Elemento*> ponteiros;
+        for (auto& elemento : elementos) {
+            ponteiros.push_back(elemento.get());
+            lista.InserirNoFinal(std::move(elemento));
+        }
+        std::vector<long> consultas = sortearConsultas(2000, quantidadeLinear, gerador);
+        imprimirLinha("ListaNaoOrdenada (linear)", quantidadeLinear,
+            medir(consultas, conferencia, [&ponteiros](long id) { return buscaLinear(ponteiros, id, IdForaDeLinha()); }),
+            medir(consultas, conferencia, [&ponteiros](long id) { return buscaLinear(ponteiros, id, IdInline()); }),
+            medir(consultas, conferencia, [&lista](long id) { return lista.BuscarPeloId(id); }));
+    }
+
+    std::cout << "\nConferência: " << conferencia << std::endl;
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "../src/estruturas_encadeadas/CacheLRU.h"
+#include "../src/estruturas_encadeadas/CacheSLRU.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Gera uma sequência de IDs com distribuição de Zipf
+ * @param chaves Número de IDs distintos (0..chaves-1, o 0 é o mais popular)
+ * @param expoente Expoente s: o ID de posição k tem peso 1/(k+1)^s
+ * @param acessos Tamanho da sequência
+ *
+ * Os IDs populares são embaralhados para não ficarem contíguos.
+ */
+std::vector<long> gerarZipf(long chaves, double expoente, long acessos, unsigned semente) {
+    std::vector<double> acumulada(chaves);
+    double soma = 0.0;
+    for (long k = 0; k < chaves; k++) {
+        soma += 1.0 / std::pow(static_cast<double>(k + 1), expoente);
+        acumulada[k] = soma;
+    }
+
+    std::vector<long> permutacao(chaves);
+    for (long k = 0; k < chaves; k++) {
+        permutacao[k] = k;
+    }
+    std::mt19937_64 gerador(semente);
+    std::shuffle(permutacao.begin(), permutacao.end(), gerador);
+
+    std::uniform_real_distribution<double> sorteio(0.0, soma);
+    std::vector<long> sequencia(acessos);
+    for (long& id : sequencia) {
+        long posicao = std::lower_bound(acumulada.begin(), acumulada.end(), sorteio(gerador)) - acumulada.begin();
+        id = permutacao[std::min(posicao, chaves - 1)];
+    }
+    return sequencia;
+}
+
+/**
+ * @brief Intercala varreduras de IDs nunca repetidos em uma sequência
+ * @param sequencia Sequência original (alterada)
+ * @param tamanhoVarredura IDs de cada varredura
+ * @param intervalo Acessos entre o início de duas varreduras
+ */
+void intercalarVarreduras(std::vector<long>& sequencia, long chaves, long tamanhoVarredura, long intervalo) {
+    long proximoId = chaves;
+    for (long inicio = 0; inicio + tamanhoVarredura <= static_cast<long>(sequencia.size()); inicio += intervalo) {
+        for (long i = 0; i < tamanhoVarredura; i++) {
+            sequencia[inicio + i] = proximoId++;
+        }
+    }
+}
+
+/**
+ * @brief Resultado de uma sequência aplicada a um cache
+ */
+struct Resultado {
+    double taxaAcertos;
+    double nsPorAcesso;
+};
+
+/**
+ * @brief Aplica a sequência ao cache: cada falha busca o elemento na "origem"
+ * (criação de um Produto) e o insere, como faria o serviço lento
+ */
+template<typename Cache>
+Resultado executar(Cache& cache, const std::vector<long>& sequencia) {
+    Cronometro cronometro;
+    for (long id : sequencia) {
+        if (!cache.obter(id)) {
+            cache.inserir(std::make_unique<Produto>(id, "Item", "Cache", "Marca", 1.0, 1));
+        }
+    }
+    double decorrido = cronometro.decorridoMs();
+
+    Resultado resultado;
+    resultado.taxaAcertos = cache.getTaxaAcertos() * 100.0;
+    resultado.nsPorAcesso = decorrido * 1e6 / sequencia.size();
+    return resultado;
+}
+
+void compararCaches(const std::string& nome, const std::vector<long>& sequencia, int capacidade) {
+    CacheLRU lru(capacidade);
+    CacheSLRU slru(capacidade);
+    Resultado resultadoLru = executar(lru, sequencia);
+    Resultado resultadoSlru = executar(slru, sequencia);
+
+    std::cout << "  " << std::left << std::setw(24) << nome
+              << std::setw(12) << capacidade
+              << std::fixed << std::setprecision(2)
+              << std::setw(12) << resultadoLru.taxaAcertos
+              << std::setw(12) << resultadoSlru.taxaAcertos
+              << std::setprecision(0)
+              << std::setw(12) << resultadoLru.nsPorAcesso
+              << resultadoSlru.nsPorAcesso << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long chaves = lerArgumento(argc, argv, 1, 1000000);
+    long acessos = lerArgumento(argc, argv, 2, 2000000);
+
+    std::cout << std::string(84, '=') << std::endl;
+    std::cout << "BENCHMARK: CACHE LRU vs SLRU EM SEQUÊNCIAS ZIPF" << std::endl;
+    std::cout << "IDs distintos: " << chaves << " | Acessos por sequência: " << acessos << std::endl;
+    std::cout << std::string(84, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(larguraExibicao("Sequência", 24)) << "Sequência"
+              << std::setw(12) << "Capacidade"
+              << std::setw(12) << "Acerto LRU"
+              << std::setw(12) << "Acerto SLRU"
+              << std::setw(12) << "ns/op LRU"
+              << "ns/op SLRU" << std::endl;
+
+    const int capacidades[] = {static_cast<int>(std::max(chaves / 100, 2L)), static_cast<int>(std::max(chaves / 10, 2L))};
+    const double expoentes[] = {0.8, 0.99, 1.2};
+
+    for (double expoente : expoentes) {
+        std::vector<long> sequencia = gerarZipf(chaves, expoente, acessos, 7);
+        std::ostringstream nome;
+        nome << "Zipf s=" << expoente;
+        for (int capacidade : capacidades) {
+            compararCaches(nome.str(), sequencia, capacidade);
+        }
+    }
+
+    // Varreduras longas de IDs únicos no meio de uma carga Zipf: caso em que o SLRU se destaca
+    std::vector<long> comVarreduras = gerarZipf(chaves, 0.99, acessos, 7);
+    for (int capacidade : capacidades) {
+        std::vector<long> sequencia = comVarreduras;
+        intercalarVarreduras(sequencia, chaves, capacidade, capacidade * 4L);
+        compararCaches("Zipf s=0.99 + varredura", sequencia, capacidade);
+    }
+
+    return 0;
+}
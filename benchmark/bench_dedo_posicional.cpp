@@ -0,0 +1,100 @@
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Gera as posições de um padrão de acesso
+ * @param padrao 0 = crescente, 1 = decrescente, 2 = quase sequencial (vizinhas), 3 = aleatório
+ */
+std::vector<int> gerarPosicoes(int padrao, int tamanho, long acessos) {
+    std::mt19937 gerador(42);
+    std::vector<int> posicoes(acessos);
+    int atual = tamanho / 2;
+    for (long i = 0; i < acessos; i++) {
+        switch (padrao) {
+            case 0: atual = static_cast<int>(i % tamanho); break;
+            case 1: atual = tamanho - 1 - static_cast<int>(i % tamanho); break;
+            case 2: atual = std::min(std::max(atual + static_cast<int>(gerador() % 7) - 3, 0), tamanho - 1); break;
+            default: atual = static_cast<int>(gerador() % tamanho); break;
+        }
+        posicoes[i] = atual;
+    }
+    return posicoes;
+}
+
+/**
+ * @brief Mede obterElementoPorPosicao sobre uma sequência de posições
+ * @return Nanossegundos por acesso
+ */
+template<typename Lista>
+double medirAcessos(const Lista& lista, const std::vector<int>& posicoes, long& conferencia) {
+    Cronometro cronometro;
+    for (int posicao : posicoes) {
+        conferencia += lista.obterElementoPorPosicao(posicao)->getID();
+    }
+    return cronometro.decorridoMs() * 1e6 / posicoes.size();
+}
+
+template<typename Lista>
+void medirLista(const std::string& nome, const Lista& lista, int tamanho, long acessos, long& conferencia) {
+    std::cout << "  " << std::left << std::setw(34) << nome << std::fixed << std::setprecision(1);
+    for (int padrao = 0; padrao < 4; padrao++) {
+        // Sem ponto de partida próximo, o acesso aleatório custa O(n): usa menos acessos
+        long quantidade = padrao == 3 ? std::max(1000L, acessos * 64 / tamanho) : acessos;
+        std::vector<int> posicoes = gerarPosicoes(padrao, tamanho, std::min(quantidade, acessos));
+        std::cout << std::setw(15) << medirAcessos(lista, posicoes, conferencia);
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    int tamanho = static_cast<int>(lerArgumento(argc, argv, 1, 100000));
+    long acessos = lerArgumento(argc, argv, 2, 5000000);
+
+    std::cout << std::string(92, '=') << std::endl;
+    std::cout << "BENCHMARK: ACESSO POSICIONAL A PARTIR DO PONTO MAIS PRÓXIMO (ns por acesso)" << std::endl;
+    std::cout << "Elementos: " << tamanho << " | Acessos por padrão: " << acessos
+              << " (aleatório usa menos)" << std::endl;
+    std::cout << "Partindo sempre da cabeça, os padrões sequenciais custariam em média n/2 saltos por acesso" << std::endl;
+    std::cout << std::string(92, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(34) << "Lista"
+              << std::setw(15) << "Crescente"
+              << std::setw(15) << "Decrescente"
+              << std::setw(larguraExibicao("Vizinhas (±3)", 15)) << "Vizinhas (±3)"
+              << "Aleatório" << std::endl;
+
+    long conferencia = 0;
+
+    ListaDuplamenteEncadeada dupla;
+    ListaDuplamenteEncadeadaCircular circular;
+    for (int i = 0; i < tamanho; i++) {
+        dupla.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+        circular.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    medirLista("ListaDupla", dupla, tamanho, acessos, conferencia);
+    medirLista("ListaCircular", circular, tamanho, acessos, conferencia);
+    dupla.ativarIndicePosicional();
+    medirLista("ListaDupla + IndicePosicional", dupla, tamanho, acessos, conferencia);
+
+    // Referência: percurso completo sem acesso por posição
+    Cronometro cronometro;
+    dupla.paraCada([&conferencia](Elemento& elemento) {
+        conferencia += elemento.getID();
+    });
+    std::cout << "\nReferência - paraCada na lista dupla: " << std::setprecision(1)
+              << cronometro.decorridoMs() * 1e6 / tamanho << " ns por elemento" << std::endl;
+    std::cout << "Conferência: " << conferencia << std::endl;
+    return 0;
+}
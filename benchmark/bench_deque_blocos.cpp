@@ -0,0 +1,98 @@
+#include "../src/estruturas_encadeadas/Deque.h"
+#include "../src/estruturas_sequenciais/DequeBlocos.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Enche o deque pelas duas pontas e esvazia alternando as pontas
+ * @return Tempo em milissegundos
+ */
+template<typename Deque>
+double medirPontas(Deque& deque, std::vector<std::unique_ptr<Elemento>>& elementos, int rodadas) {
+    std::size_t metade = elementos.size() / 2;
+    Cronometro cronometro;
+    for (int r = 0; r < rodadas; r++) {
+        for (std::size_t i = 0; i < metade; i++) {
+            deque.inserirFim(std::move(elementos[i]));
+            deque.inserirInicio(std::move(elementos[metade + i]));
+        }
+        for (std::size_t i = 0; i < metade; i++) {
+            elementos[i] = deque.removerFim();
+            elementos[metade + i] = deque.removerInicio();
+        }
+    }
+    return cronometro.decorridoMs() / rodadas;
+}
+
+/**
+ * @brief Percorre o deque inteiro com paraCada
+ * @return Tempo em milissegundos por percurso
+ */
+template<typename Deque>
+double medirPercurso(const Deque& deque, int rodadas, long& soma) {
+    Cronometro cronometro;
+    for (int r = 0; r < rodadas; r++) {
+        deque.paraCada([&](Elemento& elemento) { soma += elemento.getID(); });
+    }
+    return cronometro.decorridoMs() / rodadas;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    int rodadas = static_cast<int>(lerArgumento(argc, argv, 2, 5));
+
+    std::vector<std::unique_ptr<Elemento>> elementos;
+    elementos.reserve(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        elementos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "BENCHMARK: DEQUE ENCADEADO vs DEQUE EM BLOCOS" << std::endl;
+    std::cout << "Elementos: " << quantidade << " | Rodadas: " << rodadas
+              << " | Bloco: " << DequeBlocos::TAMANHO_BLOCO << " elementos" << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+
+    Deque encadeado;
+    DequeBlocos blocos;
+    double pontasEncadeado = medirPontas(encadeado, elementos, rodadas);
+    double pontasBlocos = medirPontas(blocos, elementos, rodadas);
+
+    for (auto& elemento : elementos) {
+        encadeado.inserirFim(std::move(elemento));
+    }
+    long somaEncadeado = 0;
+    double percursoEncadeado = medirPercurso(encadeado, rodadas, somaEncadeado);
+    while (!encadeado.estaVazio()) {
+        blocos.inserirFim(encadeado.removerInicio());
+    }
+    long somaBlocos = 0;
+    double percursoBlocos = medirPercurso(blocos, rodadas, somaBlocos);
+
+    std::cout << std::left << std::setw(larguraExibicao("Operação", 30)) << "Operação"
+              << std::setw(16) << "Encadeado (ms)"
+              << std::setw(16) << "Blocos (ms)"
+              << "Ganho" << std::endl;
+    std::cout << std::left << std::setw(30) << "Inserir/remover nas pontas"
+              << std::setw(16) << std::fixed << std::setprecision(2) << pontasEncadeado
+              << std::setw(16) << pontasBlocos
+              << pontasEncadeado / pontasBlocos << "x" << std::endl;
+    std::cout << std::left << std::setw(30) << "Percurso completo"
+              << std::setw(16) << percursoEncadeado
+              << std::setw(16) << percursoBlocos
+              << percursoEncadeado / percursoBlocos << "x" << std::endl;
+
+    std::cout << "\nAlocações da estrutura para " << quantidade << " elementos: "
+              << quantidade << " nós (encadeado) vs " << blocos.getBlocosAlocados() << " blocos" << std::endl;
+    std::cout << "Somas conferem? " << (somaEncadeado == somaBlocos ? "Sim" : "Não") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include "../src/estruturas_concorrentes/DequeRoubo.h"
+#include "../src/estruturas_encadeadas/Deque.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    const int LIMIAR = 512;  // Intervalos menores são calculados sem dividir
+
+    /**
+     * @brief Tarefa fork-join: somar o valor em estoque de um intervalo de produtos
+     */
+    class Tarefa : public Elemento {
+    public:
+        int inicio;
+        int fim;
+
+        Tarefa(int inicio, int fim) : Elemento(inicio), inicio(inicio), fim(fim) {}
+
+        void imprimirInfo() const override {
+            std::cout << "Tarefa [" << inicio << ", " << fim << ")";
+        }
+    };
+
+    double somarIntervalo(const std::vector<std::unique_ptr<Produto>>& produtos, int inicio, int fim) {
+        double soma = 0.0;
+        for (int i = inicio; i < fim; i++) {
+            soma += produtos[i]->getPreco() * produtos[i]->getQuantidadeEstoque();
+        }
+        return soma;
+    }
+}
+
+/**
+ * @brief Linha de base: um único Deque compartilhado protegido por mutex
+ */
+class DequeComTrava {
+private:
+    Deque deque;
+    std::mutex mutex;
+
+public:
+    void inserirFim(std::unique_ptr<Elemento> elemento) {
+        std::lock_guard<std::mutex> trava(mutex);
+        deque.inserirFim(std::move(elemento));
+    }
+
+    std::unique_ptr<Elemento> removerFim() {
+        std::lock_guard<std::mutex> trava(mutex);
+        return deque.removerFim();
+    }
+};
+
+/**
+ * @brief Executa uma tarefa: divide enquanto for grande (fork) e soma a folha
+ * @param inserir Função que publica a metade direita para outras threads
+ */
+template<typename Inserir>
+double executarTarefa(const std::vector<std::unique_ptr<Produto>>& produtos, std::unique_ptr<Elemento> elemento,
+                      std::atomic<long>& pendentes, Inserir inserir) {
+    Tarefa* tarefa = static_cast<Tarefa*>(elemento.get());
+    int inicio = tarefa->inicio;
+    int fim = tarefa->fim;
+    while (fim - inicio > LIMIAR) {
+        int meio = inicio + (fim - inicio) / 2;
+        pendentes.fetch_add(1, std::memory_order_relaxed);
+        inserir(std::make_unique<Tarefa>(meio, fim));
+        fim = meio;
+    }
+    double soma = somarIntervalo(produtos, inicio, fim);
+    // Join: a última tarefa concluída libera os trabalhadores
+    pendentes.fetch_sub(1, std::memory_order_release);
+    return soma;
+}
+
+double forkJoinRoubo(const std::vector<std::unique_ptr<Produto>>& produtos, int threads) {
+    std::vector<std::unique_ptr<DequeRoubo>> deques;
+    for (int t = 0; t < threads; t++) {
+        deques.push_back(std::make_unique<DequeRoubo>());
+    }
+    std::vector<double> somas(threads, 0.0);
+    std::atomic<long> pendentes(1);
+    deques[0]->inserirFim(std::make_unique<Tarefa>(0, static_cast<int>(produtos.size())));
+
+    std::vector<std::thread> trabalhadores;
+    for (int t = 0; t < threads; t++) {
+        trabalhadores.emplace_back([&, t] {
+            DequeRoubo& propria = *deques[t];
+            auto inserir = [&](std::unique_ptr<Elemento> tarefa) { propria.inserirFim(std::move(tarefa)); };
+            int vitima = t;
+            while (pendentes.load(std::memory_order_acquire) > 0) {
+                std::unique_ptr<Elemento> tarefa = propria.removerFim();
+                for (int tentativa = 1; !tarefa && tentativa < threads; tentativa++) {
+                    vitima = (vitima + 1) % threads;
+                    if (vitima != t) {
+                        tarefa = deques[vitima]->roubarInicio();
+                    }
+                }
+                if (tarefa) {
+                    somas[t] += executarTarefa(produtos, std::move(tarefa), pendentes, inserir);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& trabalhador : trabalhadores) {
+        trabalhador.join();
+    }
+
+    double total = 0.0;
+    for (double soma : somas) {
+        total += soma;
+    }
+    return total;
+}
+
+double forkJoinTrava(const std::vector<std::unique_ptr<Produto>>& produtos, int threads) {
+    DequeComTrava compartilhado;
+    std::vector<double> somas(threads, 0.0);
+    std::atomic<long> pendentes(1);
+    compartilhado.inserirFim(std::make_unique<Tarefa>(0, static_cast<int>(produtos.size())));
+
+    std::vector<std::thread> trabalhadores;
+    for (int t = 0; t < threads; t++) {
+        trabalhadores.emplace_back([&, t] {
+            auto inserir = [&](std::unique_ptr<Elemento> tarefa) { compartilhado.inserirFim(std::move(tarefa)); };
+            while (pendentes.load(std::memory_order_acquire) > 0) {
+                std::unique_ptr<Elemento> tarefa = compartilhado.removerFim();
+                if (tarefa) {
+                    somas[t] += executarTarefa(produtos, std::move(tarefa), pendentes, inserir);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& trabalhador : trabalhadores) {
+        trabalhador.join();
+    }
+
+    double total = 0.0;
+    for (double soma : somas) {
+        total += soma;
+    }
+    return total;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    int repeticoes = static_cast<int>(lerArgumento(argc, argv, 2, 10));
+    const int contagensThreads[] = {1, 2, 4, 8};
+
+    std::vector<std::unique_ptr<Produto>> produtos;
+    produtos.reserve(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        produtos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0 + i % 100, static_cast<int>(i % 7)));
+    }
+    double referencia = somarIntervalo(produtos, 0, static_cast<int>(quantidade));
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "BENCHMARK: FORK-JOIN COM ROUBO DE TRABALHO (CHASE-LEV)" << std::endl;
+    std::cout << "Produtos: " << quantidade << " | Limiar: " << LIMIAR << " | Repetições: " << repeticoes << std::endl;
+    std::cout << "Núcleos disponíveis: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+
+    Cronometro cronometro;
+    for (int r = 0; r < repeticoes; r++) {
+        referencia = somarIntervalo(produtos, 0, static_cast<int>(quantidade));
+    }
+    std::cout << "Sequencial: " << std::fixed << std::setprecision(2) << cronometro.decorridoMs() / repeticoes << " ms" << std::endl;
+
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::setw(24) << "Deque + mutex (ms)"
+              << std::setw(24) << "Chase-Lev (ms)"
+              << "Ganho" << std::endl;
+
+    for (int threads : contagensThreads) {
+        bool correto = true;
+
+        cronometro.reiniciar();
+        for (int r = 0; r < repeticoes; r++) {
+            correto = correto && forkJoinTrava(produtos, threads) == referencia;
+        }
+        double tempoTrava = cronometro.decorridoMs() / repeticoes;
+
+        cronometro.reiniciar();
+        for (int r = 0; r < repeticoes; r++) {
+            correto = correto && forkJoinRoubo(produtos, threads) == referencia;
+        }
+        double tempoRoubo = cronometro.decorridoMs() / repeticoes;
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(24) << tempoTrava
+                  << std::setw(24) << tempoRoubo
+                  << (tempoTrava / tempoRoubo) << "x" << (correto ? "" : "  (SOMA DIVERGENTE)") << std::endl;
+    }
+
+    return 0;
+}
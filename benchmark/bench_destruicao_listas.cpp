@@ -0,0 +1,91 @@
+#include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+template<typename Lista>
+void preencher(Lista& lista, long quantidade) {
+    for (long i = 0; i < quantidade; i++) {
+        lista.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+}
+
+/**
+ * @brief Esvaziamento elemento a elemento (como limpar() fazia antes)
+ * @return Tempo em milissegundos
+ */
+template<typename Lista>
+double medirRemocaoUmAUm(long quantidade) {
+    Lista lista;
+    preencher(lista, quantidade);
+    Cronometro cronometro;
+    while (!lista.estaVazia()) {
+        lista.removerPrimeiro();
+    }
+    return cronometro.decorridoMs();
+}
+
+/**
+ * @brief Tempo do destrutor da lista
+ * @param usarPool Se a lista aloca os nós pelo pool (descarte em bloco)
+ * @return Tempo em milissegundos
+ */
+template<typename Lista>
+double medirDestrutor(long quantidade, bool usarPool) {
+    auto lista = std::make_unique<Lista>(usarPool);
+    preencher(*lista, quantidade);
+    Cronometro cronometro;
+    lista.reset();
+    return cronometro.decorridoMs();
+}
+
+template<typename Lista>
+void compararLista(const std::string& nome, long quantidade, int rodadas) {
+    // Melhor de várias rodadas: a primeira liberação em massa após o
+    // sistema recuperar memória paga falhas de página que não são da lista
+    double tempoUmAUm = 1e300, tempoHeap = 1e300, tempoPool = 1e300;
+    for (int r = 0; r < rodadas; r++) {
+        tempoUmAUm = std::min(tempoUmAUm, medirRemocaoUmAUm<Lista>(quantidade));
+        tempoHeap = std::min(tempoHeap, medirDestrutor<Lista>(quantidade, false));
+        tempoPool = std::min(tempoPool, medirDestrutor<Lista>(quantidade, true));
+    }
+
+    std::cout << std::left << std::setw(34) << nome
+              << std::setw(16) << std::fixed << std::setprecision(1) << tempoUmAUm
+              << std::setw(16) << tempoHeap
+              << std::setw(16) << tempoPool
+              << std::setprecision(2) << tempoHeap / tempoPool << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 5000000);
+    int rodadas = static_cast<int>(lerArgumento(argc, argv, 2, 3));
+
+    std::cout << std::string(90, '=') << std::endl;
+    std::cout << "BENCHMARK: TEMPO DE DESTRUIÇÃO DAS LISTAS ENCADEADAS" << std::endl;
+    std::cout << "Elementos por lista: " << quantidade << " | Melhor de " << rodadas << " rodadas" << std::endl;
+    std::cout << std::string(90, '=') << std::endl;
+    std::cout << std::left << std::setw(34) << "Lista"
+              << std::setw(16) << "Um a um (ms)"
+              << std::setw(16) << "Destrutor (ms)"
+              << std::setw(16) << "Com pool (ms)"
+              << "Ganho" << std::endl;
+
+    compararLista<ListaSimplesmenteEncadeada>("ListaSimplesmenteEncadeada", quantidade, rodadas);
+    compararLista<ListaDuplamenteEncadeada>("ListaDuplamenteEncadeada", quantidade, rodadas);
+    compararLista<ListaDuplamenteEncadeadaCircular>("ListaDuplamenteEncadeadaCircular", quantidade, rodadas);
+
+    std::cout << "\nUm a um: removerPrimeiro() até esvaziar | Destrutor: nós com new/delete"
+              << " | Com pool: elementos destruídos e slabs descartados em bloco" << std::endl;
+
+    return 0;
+}
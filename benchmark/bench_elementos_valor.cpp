@@ -0,0 +1,226 @@
+#include "../src/estruturas_sequenciais/ListaValores.h"
+#include "../src/estruturas_sequenciais/ListaNaoOrdenada.h"
+#include "../ConfigLocale.h"
+#include "ContadorAlocacoes.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+struct Resultado {
+    double construcaoMs;
+    long long alocacoes;
+    double bytesPorElemento;
+    double varreduraMs;
+    double buscaUs;
+};
+
+/**
+ * @brief Trabalho de cada tipo na varredura: nota, salário ou valor do estoque
+ */
+struct Somador {
+    double& soma;
+    void operator()(const Aluno& aluno) const { soma += aluno.getNota(); }
+    void operator()(const Funcionario& funcionario) const { soma += funcionario.getSalario(); }
+    void operator()(const Produto& produto) const { soma += produto.calcularValorTotalEstoque(); }
+};
+
+// Como o resto do código descobre o tipo atrás de um Elemento*
+void somarPorTipo(const Elemento& elemento, double& soma) {
+    Somador somador{soma};
+    if (const Aluno* aluno = dynamic_cast<const Aluno*>(&elemento)) {
+        somador(*aluno);
+    } else if (const Funcionario* funcionario = dynamic_cast<const Funcionario*>(&elemento)) {
+        somador(*funcionario);
+    } else {
+        somador(static_cast<const Produto&>(elemento));
+    }
+}
+
+// Leva o tipo a criar até o lambda genérico
+template<typename Tipo>
+struct TipoElemento {
+    typedef Tipo tipo;
+};
+
+/**
+ * @brief Cria o elemento i com o construtor recebido (make_unique ou construirNoFim)
+ *
+ * Nomes curtos cabem na própria string: a única alocação de um
+ * elemento, quando há, é a do objeto.
+ */
+template<typename Criar>
+void criarElemento(long i, Criar criar) {
+    std::string nome = "R" + std::to_string(i);
+    switch (i % 3) {
+        case 0:
+            criar(TipoElemento<Aluno>(), i, nome, "Computação", (i % 101) / 10.0);
+            break;
+        case 1:
+            criar(TipoElemento<Funcionario>(), i, nome, "Analista", "Tecnologia", 1500.0 + i % 1000);
+            break;
+        default:
+            criar(TipoElemento<Produto>(), i, nome, "Periféricos", "Logitech", 10.0 + i % 50, static_cast<int>(i % 20));
+            break;
+    }
+}
+
+template<typename Construcao>
+void medirConstrucao(Resultado& resultado, long quantidade, Construcao construcao) {
+    long long alocacoesAntes = ContadorAlocacoes::alocacoes;
+    long long bytesAntes = ContadorAlocacoes::bytesVivos;
+    Cronometro cronometro;
+    construcao();
+    resultado.construcaoMs = cronometro.decorridoMs();
+    resultado.alocacoes = ContadorAlocacoes::alocacoes - alocacoesAntes;
+    resultado.bytesPorElemento = static_cast<double>(ContadorAlocacoes::bytesVivos - bytesAntes) / quantidade;
+}
+
+template<typename Varredura>
+double medirVarredura(int repeticoes, double& conferencia, Varredura varredura) {
+    Cronometro cronometro;
+    for (int r = 0; r < repeticoes; r++) {
+        conferencia += varredura();
+    }
+    return cronometro.decorridoMs() / repeticoes;
+}
+
+/**
+ * @brief Mede uma busca linear por ID para cada consulta
+ * @return Microssegundos por busca
+ */
+template<typename Busca>
+double medirBusca(const std::vector<long>& consultas, double& conferencia, Busca busca) {
+    Cronometro cronometro;
+    for (long id : consultas) {
+        conferencia += busca(id);
+    }
+    return cronometro.decorridoMs() * 1e3 / static_cast<double>(consultas.size());
+}
+
+void imprimirLinha(const std::string& estrutura, const Resultado& resultado, const Resultado& referencia) {
+    std::cout << "  " << std::left << std::setw(32) << estrutura
+              << std::fixed << std::setprecision(1)
+              << std::setw(17) << resultado.construcaoMs
+              << std::setw(12) << resultado.alocacoes
+              << std::setw(13) << resultado.bytesPorElemento
+              << std::setw(17) << resultado.varreduraMs
+              << std::setw(12) << resultado.buscaUs
+              << referencia.varreduraMs / resultado.varreduraMs << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    const int repeticoes = 10;
+    std::mt19937 gerador(50);
+    std::uniform_int_distribution<long> distribuicao(0, quantidade - 1);
+    std::vector<long> consultas(static_cast<std::size_t>(std::max(1L, 200000000L / quantidade)));
+    for (long& id : consultas) {
+        id = distribuicao(gerador);
+    }
+    double conferencia = 0.0;
+
+    std::cout << std::string(112, '=') << std::endl;
+    std::cout << "BENCHMARK: " << quantidade << " ELEMENTOS MISTOS POR PONTEIRO vs POR VALOR (std::variant)" << std::endl;
+    std::cout << "Varredura: soma por tipo (dynamic_cast nos ponteiros, visit nos valores) | Busca: linear por ID, "
+              << consultas.size() << " consultas" << std::endl;
+    std::cout << "Bytes/elem: heap ao fim da construção, vetor incluído, sem a sobra do malloc (~16 por bloco) | Ganho: varredura dos ponteiros / desta" << std::endl;
+    std::cout << std::string(112, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(32) << "Estrutura"
+              << std::setw(larguraExibicao("Construção (ms)", 17)) << "Construção (ms)"
+              << std::setw(larguraExibicao("Alocações", 12)) << "Alocações"
+              << std::setw(13) << "Bytes/elem"
+              << std::setw(17) << "Varredura (ms)"
+              << std::setw(larguraExibicao("Busca (µs)", 12)) << "Busca (µs)"
+              << "Ganho" << std::endl;
+
+    Resultado ponteiros{}, naoOrdenada{}, valores{};
+    {
+        std::vector<std::unique_ptr<Elemento>> vetor;
+        medirConstrucao(ponteiros, quantidade, [&vetor, quantidade]() {
+            vetor.reserve(quantidade);
+            for (long i = 0; i < quantidade; i++) {
+                criarElemento(i, [&vetor](auto tipo, auto&&... argumentos) {
+                    using Tipo = typename decltype(tipo)::tipo;
+                    vetor.push_back(std::make_unique<Tipo>(argumentos...));
+                });
+            }
+        });
+        ponteiros.varreduraMs = medirVarredura(repeticoes, conferencia, [&vetor]() {
+            double soma = 0.0;
+            for (const auto& elemento : vetor) {
+                somarPorTipo(*elemento, soma);
+                soma += elemento->getID();
+            }
+            return soma;
+        });
+        ponteiros.buscaUs = medirBusca(consultas, conferencia, [&vetor](long id) {
+            for (const auto& elemento : vetor) {
+                if (elemento->getID() == id) {
+                    return elemento->getID();
+                }
+            }
+            return -1L;
+        });
+    }
+    imprimirLinha("vector<unique_ptr<Elemento>>", ponteiros, ponteiros);
+
+    {
+        ListaNaoOrdenada lista(static_cast<int>(quantidade));
+        medirConstrucao(naoOrdenada, quantidade, [&lista, quantidade]() {
+            for (long i = 0; i < quantidade; i++) {
+                criarElemento(i, [&lista](auto tipo, auto&&... argumentos) {
+                    using Tipo = typename decltype(tipo)::tipo;
+                    lista.InserirNoFinal(std::make_unique<Tipo>(argumentos...));
+                });
+            }
+        });
+        naoOrdenada.varreduraMs = medirVarredura(repeticoes, conferencia, [&lista]() {
+            double soma = 0.0;
+            for (int i = 0, n = lista.getTamanho(); i < n; i++) {
+                const Elemento* elemento = lista.obterElementoPorIndice(i);
+                somarPorTipo(*elemento, soma);
+                soma += elemento->getID();
+            }
+            return soma;
+        });
+        naoOrdenada.buscaUs = medirBusca(consultas, conferencia, [&lista](long id) {
+            return lista.BuscarPeloId(id)->getID();
+        });
+    }
+    // A capacidade inicial já separa o vetor de ponteiros e o de IDs: a construção não os conta
+    imprimirLinha("ListaNaoOrdenada (IDs em cache)", naoOrdenada, ponteiros);
+
+    {
+        ListaValores lista;
+        medirConstrucao(valores, quantidade, [&lista, quantidade]() {
+            lista.reservar(static_cast<int>(quantidade));
+            for (long i = 0; i < quantidade; i++) {
+                criarElemento(i, [&lista](auto tipo, auto&&... argumentos) {
+                    lista.construirNoFim<typename decltype(tipo)::tipo>(argumentos...);
+                });
+            }
+        });
+        valores.varreduraMs = medirVarredura(repeticoes, conferencia, [&lista]() {
+            double soma = 0.0;
+            lista.paraCada([&soma](const ElementoValor& elemento) {
+                elemento.visitar(Somador{soma});
+                soma += elemento.getID();
+            });
+            return soma;
+        });
+        valores.buscaUs = medirBusca(consultas, conferencia, [&lista](long id) {
+            return lista.buscarPeloId(id)->getID();
+        });
+    }
+    imprimirLinha("ListaValores (std::variant)", valores, ponteiros);
+
+    std::cout << "\nConferência: " << std::fixed << std::setprecision(0) << conferencia << std::endl;
+    return 0;
+}
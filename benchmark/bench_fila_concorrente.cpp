@@ -0,0 +1,148 @@
+#include "../src/estruturas_concorrentes/FilaConcorrente.h"
+#include "../src/estruturas_sequenciais/FilaOtimizada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <atomic>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Linha de base: FilaOtimizada protegida por mutex e variáveis de condição
+ */
+class FilaComTrava {
+private:
+    FilaOtimizada fila;
+    std::mutex mutex;
+    std::condition_variable naoVazia;
+    std::condition_variable naoCheia;
+
+public:
+    explicit FilaComTrava(int capacidade) : fila(capacidade) {}
+
+    void enfileirar(std::unique_ptr<Elemento> elemento) {
+        std::unique_lock<std::mutex> trava(mutex);
+        naoCheia.wait(trava, [&] { return !fila.filaCheia(); });
+        fila.enfileirar(std::move(elemento));
+        trava.unlock();
+        naoVazia.notify_one();
+    }
+
+    std::unique_ptr<Elemento> desenfileirar() {
+        std::unique_lock<std::mutex> trava(mutex);
+        naoVazia.wait(trava, [&] { return !fila.filaVazia(); });
+        std::unique_ptr<Elemento> elemento = fila.desenfileirar();
+        trava.unlock();
+        naoCheia.notify_one();
+        return elemento;
+    }
+};
+
+/**
+ * @brief Executa produtores e consumidores sobre a fila informada
+ * @return Tempo total em milissegundos
+ */
+template<typename Fila>
+double executarCenario(Fila& fila, int threads, long operacoes, int capacidade) {
+    if (threads == 1) {
+        // Uma única thread alterna blocos de produção e consumo
+        std::vector<std::unique_ptr<Elemento>> elementos;
+        for (int i = 0; i < capacidade; i++) {
+            elementos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+        }
+        Cronometro cronometro;
+        for (long feitos = 0; feitos < operacoes; feitos += capacidade) {
+            for (auto& elemento : elementos) {
+                fila.enfileirar(std::move(elemento));
+            }
+            for (auto& elemento : elementos) {
+                elemento = fila.desenfileirar();
+            }
+        }
+        return cronometro.decorridoMs();
+    }
+
+    int produtores = threads / 2;
+    int consumidores = threads - produtores;
+
+    // Elementos criados antes da medição para não medir o alocador
+    std::vector<std::vector<std::unique_ptr<Elemento>>> entradas(produtores);
+    for (int p = 0; p < produtores; p++) {
+        long quantidade = operacoes / produtores + (p < operacoes % produtores ? 1 : 0);
+        entradas[p].reserve(quantidade);
+        for (long i = 0; i < quantidade; i++) {
+            entradas[p].push_back(std::make_unique<Produto>(p * operacoes + i, "Item", "Bench", "Marca", 1.0, 1));
+        }
+    }
+    std::vector<std::vector<std::unique_ptr<Elemento>>> saidas(consumidores);
+    for (auto& saida : saidas) {
+        saida.reserve(operacoes / consumidores + 1);
+    }
+
+    std::atomic<long> reservados(0);
+    std::vector<std::thread> trabalhadores;
+    Cronometro cronometro;
+
+    for (int p = 0; p < produtores; p++) {
+        trabalhadores.emplace_back([&, p] {
+            for (auto& elemento : entradas[p]) {
+                fila.enfileirar(std::move(elemento));
+            }
+        });
+    }
+    for (int c = 0; c < consumidores; c++) {
+        trabalhadores.emplace_back([&, c] {
+            // Cada reserva garante que um elemento ainda vai chegar
+            while (reservados.fetch_add(1, std::memory_order_relaxed) < operacoes) {
+                saidas[c].push_back(fila.desenfileirar());
+            }
+        });
+    }
+    for (auto& trabalhador : trabalhadores) {
+        trabalhador.join();
+    }
+
+    return cronometro.decorridoMs();
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long operacoes = lerArgumento(argc, argv, 1, 1000000);
+    const int capacidade = 1024;
+    const int contagensThreads[] = {1, 2, 4, 8, 16, 32};
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "BENCHMARK: FILA CONCORRENTE (VYUKOV) vs MUTEX + CONDIÇÃO" << std::endl;
+    std::cout << "Operações por cenário: " << operacoes << " | Capacidade: " << capacidade << std::endl;
+    std::cout << "Núcleos disponíveis: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::setw(20) << "Mutex+CV (Mops/s)"
+              << std::setw(20) << "Vyukov (Mops/s)"
+              << "Ganho" << std::endl;
+
+    for (int threads : contagensThreads) {
+        FilaComTrava filaTrava(capacidade);
+        double tempoTrava = executarCenario(filaTrava, threads, operacoes, capacidade);
+
+        FilaConcorrente filaConcorrente(capacidade);
+        double tempoConcorrente = executarCenario(filaConcorrente, threads, operacoes, capacidade);
+
+        double vazaoTrava = operacoes / (tempoTrava * 1000.0);
+        double vazaoConcorrente = operacoes / (tempoConcorrente * 1000.0);
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(20) << std::fixed << std::setprecision(2) << vazaoTrava
+                  << std::setw(20) << vazaoConcorrente
+                  << std::setprecision(2) << (tempoTrava / tempoConcorrente) << "x" << std::endl;
+    }
+
+    return 0;
+}
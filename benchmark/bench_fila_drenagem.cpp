@@ -0,0 +1,82 @@
+#include "../src/estruturas_sequenciais/Fila.h"
+#include "../src/estruturas_sequenciais/ListaNaoOrdenada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * @brief Enche a Fila com n elementos e mede o tempo para esvaziá-la
+ * @return Tempo de drenagem em milissegundos
+ */
+double drenarFila(long n) {
+    Fila fila(static_cast<int>(n));
+    for (long i = 0; i < n; i++) {
+        fila.enfileirar(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    Cronometro cronometro;
+    long soma = 0;
+    while (auto elemento = fila.desenfileirar()) {
+        soma += elemento->getID();
+    }
+    double tempo = cronometro.decorridoMs();
+    return soma == n * (n - 1) / 2 ? tempo : -1.0;
+}
+
+/**
+ * @brief Referência: drenagem com RemoverPrimeiro, que desloca a lista a cada remoção
+ * @return Tempo de drenagem em milissegundos
+ */
+double drenarComDeslocamento(long n) {
+    ListaNaoOrdenada lista(static_cast<int>(n));
+    for (long i = 0; i < n; i++) {
+        lista.InserirNoFinal(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    Cronometro cronometro;
+    long soma = 0;
+    while (auto elemento = lista.RemoverPrimeiro()) {
+        soma += elemento->getID();
+    }
+    double tempo = cronometro.decorridoMs();
+    return soma == n * (n - 1) / 2 ? tempo : -1.0;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long maximo = lerArgumento(argc, argv, 1, 1000000);
+    // Acima deste tamanho a drenagem quadrática leva tempo demais
+    long limiteDeslocamento = lerArgumento(argc, argv, 2, 100000);
+
+    std::cout << std::string(72, '=') << std::endl;
+    std::cout << "BENCHMARK: DRENAGEM DA FILA (DESLOCAMENTO DE CABEÇA vs DESLOCAR A LISTA)" << std::endl;
+    std::cout << std::string(72, '=') << std::endl;
+    std::cout << std::left << std::setw(12) << "Elementos"
+              << std::setw(16) << "Fila (ms)"
+              << std::setw(16) << "ns/elemento"
+              << std::setw(20) << "Deslocando (ms)"
+              << "Ganho" << std::endl;
+
+    for (long n = 1000; n <= maximo; n *= 10) {
+        double tempoFila = drenarFila(n);
+        std::cout << std::left << std::setw(12) << n
+                  << std::setw(16) << std::fixed << std::setprecision(3) << tempoFila
+                  << std::setw(16) << std::setprecision(1) << tempoFila * 1e6 / n;
+
+        if (n <= limiteDeslocamento) {
+            double tempoDeslocando = drenarComDeslocamento(n);
+            std::cout << std::setw(20) << std::setprecision(3) << tempoDeslocando
+                      << std::setprecision(1) << tempoDeslocando / tempoFila << "x";
+        } else {
+            std::cout << std::setw(20) << "-" << "-";
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
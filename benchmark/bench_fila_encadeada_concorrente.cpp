@@ -0,0 +1,133 @@
+#include "../src/estruturas_concorrentes/FilaEncadeadaConcorrente.h"
+#include "../src/estruturas_encadeadas/FilaEncadeada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Linha de base: FilaEncadeada protegida por um std::mutex
+ */
+class FilaComTrava {
+private:
+    FilaEncadeada fila;
+    std::mutex mutex;
+
+public:
+    void enfileirar(std::unique_ptr<Elemento> elemento) {
+        std::lock_guard<std::mutex> trava(mutex);
+        fila.enfileirar(std::move(elemento));
+    }
+
+    std::unique_ptr<Elemento> desenfileirar() {
+        std::lock_guard<std::mutex> trava(mutex);
+        return fila.desenfileirar();
+    }
+};
+
+/**
+ * @brief Executa produtores e consumidores sobre a fila (ilimitada, sem bloqueio)
+ * @return Tempo total em milissegundos
+ */
+template<typename Fila>
+double executarCenario(Fila& fila, int threads, long operacoes) {
+    int produtores = threads > 1 ? threads / 2 : 1;
+    int consumidores = threads > 1 ? threads - produtores : 1;
+
+    // Elementos criados antes da medição para não medir o alocador de Elemento
+    std::vector<std::vector<std::unique_ptr<Elemento>>> entradas(produtores);
+    for (int p = 0; p < produtores; p++) {
+        long quantidade = operacoes / produtores + (p < operacoes % produtores ? 1 : 0);
+        entradas[p].reserve(quantidade);
+        for (long i = 0; i < quantidade; i++) {
+            entradas[p].push_back(std::make_unique<Produto>(p * operacoes + i, "Item", "Bench", "Marca", 1.0, 1));
+        }
+    }
+    std::vector<std::vector<std::unique_ptr<Elemento>>> saidas(consumidores);
+    for (auto& saida : saidas) {
+        saida.reserve(operacoes / consumidores + 1);
+    }
+
+    Cronometro cronometro;
+    if (threads == 1) {
+        // Uma única thread alterna blocos de produção e consumo
+        auto& entrada = entradas[0];
+        for (std::size_t inicio = 0; inicio < entrada.size(); inicio += 256) {
+            std::size_t fim = std::min(entrada.size(), inicio + 256);
+            for (std::size_t i = inicio; i < fim; i++) {
+                fila.enfileirar(std::move(entrada[i]));
+            }
+            for (std::size_t i = inicio; i < fim; i++) {
+                saidas[0].push_back(fila.desenfileirar());
+            }
+        }
+        return cronometro.decorridoMs();
+    }
+
+    std::atomic<long> consumidos(0);
+    std::vector<std::thread> trabalhadores;
+    for (int p = 0; p < produtores; p++) {
+        trabalhadores.emplace_back([&, p] {
+            for (auto& elemento : entradas[p]) {
+                fila.enfileirar(std::move(elemento));
+            }
+        });
+    }
+    for (int c = 0; c < consumidores; c++) {
+        trabalhadores.emplace_back([&, c] {
+            while (consumidos.load(std::memory_order_relaxed) < operacoes) {
+                auto elemento = fila.desenfileirar();
+                if (elemento) {
+                    saidas[c].push_back(std::move(elemento));
+                    consumidos.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& trabalhador : trabalhadores) {
+        trabalhador.join();
+    }
+    return cronometro.decorridoMs();
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long operacoes = lerArgumento(argc, argv, 1, 1000000);
+    const int contagensThreads[] = {1, 2, 4, 8, 16, 32};
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "BENCHMARK: FILA DE MICHAEL-SCOTT vs FILA ENCADEADA + MUTEX (MPMC)" << std::endl;
+    std::cout << "Operações por cenário: " << operacoes << std::endl;
+    std::cout << "Núcleos disponíveis: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::setw(20) << "Mutex (Mops/s)"
+              << std::setw(24) << "Michael-Scott (Mops/s)"
+              << "Ganho" << std::endl;
+
+    for (int threads : contagensThreads) {
+        FilaComTrava filaTrava;
+        double tempoTrava = executarCenario(filaTrava, threads, operacoes);
+
+        FilaEncadeadaConcorrente filaConcorrente;
+        double tempoConcorrente = executarCenario(filaConcorrente, threads, operacoes);
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(20) << std::fixed << std::setprecision(2) << operacoes / (tempoTrava * 1000.0)
+                  << std::setw(24) << operacoes / (tempoConcorrente * 1000.0)
+                  << (tempoTrava / tempoConcorrente) << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Tempo médio por operação por ID, em nanossegundos
+ */
+struct Medicao {
+    double buscar;
+    double alterar;
+    double removerReinserir;
+};
+
+/**
+ * @brief Mede buscarPeloId, alterarPeloId e removerPeloId (com reinserção no fim)
+ * @param lista Lista com os IDs 0..quantidade-1
+ * @param operacoes Operações de cada tipo, em IDs sorteados
+ */
+template<typename Lista>
+Medicao medir(Lista& lista, long quantidade, long operacoes, long& conferencia) {
+    Medicao medicao{};
+    std::mt19937_64 gerador(5);
+    std::uniform_int_distribution<long> sorteio(0, quantidade - 1);
+    std::vector<long> ids(operacoes);
+    for (long& id : ids) {
+        id = sorteio(gerador);
+    }
+
+    Cronometro cronometro;
+    for (long id : ids) {
+        conferencia += lista.buscarPeloId(id)->getID();
+    }
+    medicao.buscar = cronometro.decorridoMs() * 1e6 / operacoes;
+
+    cronometro.reiniciar();
+    for (long id : ids) {
+        lista.alterarPeloId(id, std::make_unique<Produto>(id, "Alterado", "Bench", "Marca", 2.0, 2));
+    }
+    medicao.alterar = cronometro.decorridoMs() * 1e6 / operacoes;
+
+    cronometro.reiniciar();
+    for (long id : ids) {
+        lista.inserirNoFim(lista.removerPeloId(id));
+    }
+    medicao.removerReinserir = cronometro.decorridoMs() * 1e6 / operacoes;
+
+    return medicao;
+}
+
+template<typename Lista>
+void compararLista(const std::string& nome, long quantidade, long operacoesSemIndice, long operacoesComIndice) {
+    Lista lista;
+    for (long i = 0; i < quantidade; i++) {
+        lista.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    long conferencia = 0;
+    Medicao semIndice = medir(lista, quantidade, operacoesSemIndice, conferencia);
+
+    Cronometro cronometro;
+    lista.ativarIndiceIds();
+    double construcao = cronometro.decorridoMs();
+
+    Medicao comIndice = medir(lista, quantidade, operacoesComIndice, conferencia);
+
+    std::cout << "\n" << nome << " (construção do índice: "
+              << std::fixed << std::setprecision(1) << construcao << " ms)" << std::endl;
+    auto linha = [](const std::string& operacao, double sem, double com) {
+        std::cout << "  " << std::left << std::setw(32) << operacao
+                  << std::setw(16) << std::setprecision(0) << sem
+                  << std::setw(14) << com
+                  << std::setprecision(0) << sem / com << "x" << std::endl;
+    };
+    linha("buscarPeloId", semIndice.buscar, comIndice.buscar);
+    linha("alterarPeloId", semIndice.alterar, comIndice.alterar);
+    linha("removerPeloId + inserirNoFim", semIndice.removerReinserir, comIndice.removerReinserir);
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    long operacoesSemIndice = lerArgumento(argc, argv, 2, 100);
+    long operacoesComIndice = lerArgumento(argc, argv, 3, 1000000);
+
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << "BENCHMARK: OPERAÇÕES POR ID COM E SEM ÍNDICE HASH" << std::endl;
+    std::cout << "Elementos: " << quantidade << " | Operações sem índice: " << operacoesSemIndice
+              << " | com índice: " << operacoesComIndice << std::endl;
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(larguraExibicao("Operação (ns/op)", 32)) << "Operação (ns/op)"
+              << std::setw(larguraExibicao("Sem índice", 16)) << "Sem índice"
+              << std::setw(larguraExibicao("Com índice", 14)) << "Com índice"
+              << "Ganho" << std::endl;
+
+    compararLista<ListaSimplesmenteEncadeada>("ListaSimplesmenteEncadeada", quantidade, operacoesSemIndice, operacoesComIndice);
+    compararLista<ListaDuplamenteEncadeada>("ListaDuplamenteEncadeada", quantidade, operacoesSemIndice, operacoesComIndice);
+    compararLista<ListaDuplamenteEncadeadaCircular>("ListaDuplamenteEncadeadaCircular", quantidade, operacoesSemIndice, operacoesComIndice);
+
+    return 0;
+}
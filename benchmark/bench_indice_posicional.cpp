@@ -0,0 +1,109 @@
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Tempo médio por operação, em nanossegundos
+ */
+struct Medicao {
+    double acesso;
+    double insercaoRemocao;
+    long conferencia;    // Soma dos IDs acessados (evita que o laço seja descartado)
+};
+
+/**
+ * @brief Acessos aleatórios seguidos de pares inserir/remover em posições aleatórias
+ * @param lista Lista preenchida
+ * @param operacoes Quantidade de operações de cada tipo
+ */
+Medicao medir(ListaDuplamenteEncadeada& lista, long operacoes, unsigned semente) {
+    Medicao medicao{};
+    std::mt19937 gerador(semente);
+    std::uniform_int_distribution<int> sorteio(0, lista.getTamanho() - 1);
+
+    Cronometro cronometro;
+    for (long i = 0; i < operacoes; i++) {
+        medicao.conferencia += lista.obterElementoPorPosicao(sorteio(gerador))->getID();
+    }
+    medicao.acesso = cronometro.decorridoMs() * 1e6 / operacoes;
+
+    cronometro.reiniciar();
+    for (long i = 0; i < operacoes; i++) {
+        // O elemento removido volta em outra posição: o tamanho fica constante
+        auto elemento = lista.removerDaPosicao(sorteio(gerador));
+        lista.inserirNaPosicao(sorteio(gerador), std::move(elemento));
+    }
+    medicao.insercaoRemocao = cronometro.decorridoMs() * 1e6 / operacoes;
+
+    return medicao;
+}
+
+long somarIds(const ListaDuplamenteEncadeada& lista, const std::vector<int>& posicoes) {
+    long soma = 0;
+    for (int posicao : posicoes) {
+        soma += lista.obterElementoPorPosicao(posicao)->getID();
+    }
+    return soma;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    long operacoesSemIndice = lerArgumento(argc, argv, 2, 200);
+    long operacoesComIndice = lerArgumento(argc, argv, 3, 1000000);
+
+    ListaDuplamenteEncadeada lista;
+    for (long i = 0; i < quantidade; i++) {
+        lista.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    Medicao semIndice = medir(lista, operacoesSemIndice, 1);
+
+    Cronometro cronometro;
+    lista.ativarIndicePosicional();
+    double construcao = cronometro.decorridoMs();
+
+    Medicao comIndice = medir(lista, operacoesComIndice, 1);
+
+    // As mesmas posições, com e sem índice, devem levar aos mesmos elementos
+    std::mt19937 gerador(99);
+    std::vector<int> posicoes(50);
+    for (int& posicao : posicoes) {
+        posicao = static_cast<int>(gerador() % quantidade);
+    }
+    long somaComIndice = somarIds(lista, posicoes);
+    lista.desativarIndicePosicional();
+    long somaSemIndice = somarIds(lista, posicoes);
+
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << "BENCHMARK: ACESSO POSICIONAL NA LISTA DUPLAMENTE ENCADEADA" << std::endl;
+    std::cout << "Elementos: " << quantidade << " | Operações sem índice: " << operacoesSemIndice
+              << " | com índice: " << operacoesComIndice << std::endl;
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << std::left << std::setw(larguraExibicao("Operação (ns/op)", 36)) << "Operação (ns/op)"
+              << std::setw(larguraExibicao("Sem índice", 16)) << "Sem índice"
+              << std::setw(larguraExibicao("Com índice", 16)) << "Com índice"
+              << "Ganho" << std::endl;
+    std::cout << std::left << std::setw(36) << "obterElementoPorPosicao"
+              << std::setw(16) << std::fixed << std::setprecision(0) << semIndice.acesso
+              << std::setw(16) << comIndice.acesso
+              << std::setprecision(1) << semIndice.acesso / comIndice.acesso << "x" << std::endl;
+    std::cout << std::left << std::setw(36) << "removerDaPosicao + inserirNaPosicao"
+              << std::setw(16) << std::setprecision(0) << semIndice.insercaoRemocao
+              << std::setw(16) << comIndice.insercaoRemocao
+              << std::setprecision(1) << semIndice.insercaoRemocao / comIndice.insercaoRemocao << "x" << std::endl;
+
+    std::cout << "\nConstrução do índice: " << std::setprecision(1) << construcao << " ms" << std::endl;
+    std::cout << "Com e sem índice retornam os mesmos elementos? "
+              << (somaComIndice == somaSemIndice ? "Sim" : "Não") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include "../src/estruturas_sequenciais/KernelsEstoque.h"
+#include "../src/estruturas_sequenciais/TabelaProdutos.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+typedef KernelsEstoque::Implementacao Implementacao;
+typedef KernelsEstoque::ModoSoma ModoSoma;
+
+/**
+ * @brief Mede uma operação repetindo-a algumas vezes
+ * @return Nanossegundos por registro
+ */
+template<typename Operacao>
+double medir(long registros, int repeticoes, double& conferencia, Operacao operacao) {
+    Cronometro cronometro;
+    for (int r = 0; r < repeticoes; r++) {
+        conferencia += operacao();
+    }
+    return cronometro.decorridoMs() * 1e6 / (static_cast<double>(registros) * repeticoes);
+}
+
+void imprimirLinha(const std::string& operacao, double objetos, double escalar, double avx2) {
+    std::cout << "  " << std::left << std::setw(larguraExibicao(operacao, 30)) << operacao
+              << std::fixed << std::setprecision(3)
+              << std::setw(12) << objetos
+              << std::setw(12) << escalar
+              << std::setw(12) << avx2
+              << std::setprecision(1) << escalar / avx2 << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long registros = lerArgumento(argc, argv, 1, 10000000);
+    int repeticoes = static_cast<int>(lerArgumento(argc, argv, 2, 10));
+    // Objetos Produto ocupam ~150 bytes cada: a coluna "Objetos" usa no máximo 2M
+    long registrosObjetos = std::min(registros, 2000000L);
+
+    std::mt19937 gerador(51);
+    TabelaProdutos tabela;
+    tabela.reservar(static_cast<int>(registros), 8);
+    std::vector<std::unique_ptr<Produto>> objetos;
+    objetos.reserve(registrosObjetos);
+    for (long i = 0; i < registros; i++) {
+        double preco = (gerador() % 100000) / 100.0;
+        int estoque = static_cast<int>(gerador() % 50);
+        tabela.adicionar(i, "Item", "Bench", "Marca", preco, estoque);
+        if (i < registrosObjetos) {
+            objetos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", preco, estoque));
+        }
+    }
+    int n = tabela.getTamanho();
+    const double* precos = tabela.dadosPrecos();
+    const int* estoques = tabela.dadosEstoques();
+
+    std::cout << std::string(84, '=') << std::endl;
+    std::cout << "BENCHMARK: LAÇOS DE ESTOQUE ESCALAR vs AVX2 (ns por registro)" << std::endl;
+    std::cout << "Registros: " << registros << " (objetos: " << registrosObjetos << ") | Repetições: " << repeticoes
+              << " | AVX2 neste processador: " << (KernelsEstoque::avx2Disponivel() ? "sim" : "não") << std::endl;
+    std::cout << "Objetos: vector<unique_ptr<Produto>> chamando o método de cada um" << std::endl;
+    std::cout << std::string(84, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(larguraExibicao("Operação", 30)) << "Operação"
+              << std::setw(12) << "Objetos"
+              << std::setw(12) << "Escalar"
+              << std::setw(12) << "AVX2"
+              << "Ganho" << std::endl;
+
+    double conferencia = 0.0;
+    for (ModoSoma modo : {ModoSoma::Simples, ModoSoma::Kahan}) {
+        imprimirLinha(modo == ModoSoma::Simples ? "Valor do estoque (simples)" : "Valor do estoque (Kahan)",
+            medir(registrosObjetos, repeticoes, conferencia, [&objetos, modo]() {
+                if (modo == ModoSoma::Simples) {
+                    double total = 0.0;
+                    for (const auto& produto : objetos) {
+                        total += produto->calcularValorTotalEstoque();
+                    }
+                    return total;
+                }
+                double total = 0.0, compensacao = 0.0;
+                for (const auto& produto : objetos) {
+                    double corrigida = produto->calcularValorTotalEstoque() - compensacao;
+                    double nova = total + corrigida;
+                    compensacao = (nova - total) - corrigida;
+                    total = nova;
+                }
+                return total;
+            }),
+            medir(registros, repeticoes, conferencia, [=]() {
+                return KernelsEstoque::valorTotal(precos, estoques, n, modo, Implementacao::Escalar);
+            }),
+            medir(registros, repeticoes, conferencia, [=]() {
+                return KernelsEstoque::valorTotal(precos, estoques, n, modo, Implementacao::Avx2);
+            }));
+    }
+
+    imprimirLinha("Produtos disponíveis",
+        medir(registrosObjetos, repeticoes, conferencia, [&objetos]() {
+            int disponiveis = 0;
+            for (const auto& produto : objetos) {
+                disponiveis += produto->estaDisponivel();
+            }
+            return static_cast<double>(disponiveis);
+        }),
+        medir(registros, repeticoes, conferencia, [=]() {
+            return static_cast<double>(KernelsEstoque::contarPositivos(estoques, n, Implementacao::Escalar));
+        }),
+        medir(registros, repeticoes, conferencia, [=]() {
+            return static_cast<double>(KernelsEstoque::contarPositivos(estoques, n, Implementacao::Avx2));
+        }));
+
+    // Estoques uniformes em [0, 50): limite 1 seleciona 2% das linhas, limite 5, 10%
+    for (int limite : {1, 5}) {
+        std::string nome = "Estoque < " + std::to_string(limite) + (limite == 1 ? " (2%)" : " (10%)");
+        imprimirLinha(nome,
+            medir(registrosObjetos, repeticoes, conferencia, [&objetos, limite]() {
+                std::vector<const Produto*> baixos;
+                for (const auto& produto : objetos) {
+                    if (produto->getQuantidadeEstoque() < limite) {
+                        baixos.push_back(produto.get());
+                    }
+                }
+                return static_cast<double>(baixos.size());
+            }),
+            medir(registros, repeticoes, conferencia, [=]() {
+                std::vector<int> linhas;
+                KernelsEstoque::filtrarAbaixoDe(estoques, n, limite, linhas, Implementacao::Escalar);
+                return static_cast<double>(linhas.size());
+            }),
+            medir(registros, repeticoes, conferencia, [=]() {
+                std::vector<int> linhas;
+                KernelsEstoque::filtrarAbaixoDe(estoques, n, limite, linhas, Implementacao::Avx2);
+                return static_cast<double>(linhas.size());
+            }));
+    }
+
+    // Erro de cada soma contra uma referência em long double (64 bits de mantissa no x86)
+    long double referencia = 0.0L;
+    for (int i = 0; i < n; i++) {
+        referencia += static_cast<long double>(precos[i]) * estoques[i];
+    }
+    std::cout << "\nErro absoluto do valor total (referência em long double: "
+              << std::setprecision(2) << static_cast<double>(referencia) << "):" << std::endl;
+    for (Implementacao implementacao : {Implementacao::Escalar, Implementacao::Avx2}) {
+        std::cout << "  " << (implementacao == Implementacao::Escalar ? "Escalar" : "AVX2   ") << std::scientific << std::setprecision(2);
+        for (ModoSoma modo : {ModoSoma::Simples, ModoSoma::Kahan}) {
+            double valor = KernelsEstoque::valorTotal(precos, estoques, n, modo, implementacao);
+            std::cout << (modo == ModoSoma::Simples ? "  simples: " : "  Kahan: ")
+                      << std::fabs(static_cast<double>(static_cast<long double>(valor) - referencia));
+        }
+        std::cout << std::fixed << std::endl;
+    }
+
+    std::cout << "\nConferência: " << std::setprecision(0) << conferencia << std::endl;
+    return 0;
+}
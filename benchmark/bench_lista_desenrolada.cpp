@@ -0,0 +1,133 @@
+#include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDesenrolada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Busca uma sequência de IDs (metade deles inexistente)
+ * @return Tempo em milissegundos
+ */
+template<typename Lista>
+double medirBusca(const Lista& lista, const std::vector<long>& ids, long& encontrados) {
+    Cronometro cronometro;
+    for (long id : ids) {
+        if (lista.buscarPeloId(id)) {
+            encontrados++;
+        }
+    }
+    return cronometro.decorridoMs();
+}
+
+/**
+ * @brief Conta elementos com uma condição sobre o elemento
+ * @return Tempo em milissegundos
+ */
+template<typename Lista>
+double medirContagem(const Lista& lista, int rodadas, long& total) {
+    Cronometro cronometro;
+    for (int r = 0; r < rodadas; r++) {
+        total += lista.contarElementos([](const Elemento* e) { return e->getID() % 3 == 0; });
+    }
+    return cronometro.decorridoMs();
+}
+
+/**
+ * @brief Acessa posições aleatórias
+ * @return Tempo em milissegundos
+ */
+template<typename Lista>
+double medirPosicoes(const Lista& lista, const std::vector<int>& posicoes, long& soma) {
+    Cronometro cronometro;
+    for (int posicao : posicoes) {
+        soma += lista.obterElementoPorPosicao(posicao)->getID();
+    }
+    return cronometro.decorridoMs();
+}
+
+void imprimirLinha(const std::string& operacao, double classica, double desenrolada) {
+    std::cout << std::left << std::setw(36) << operacao
+              << std::setw(18) << std::fixed << std::setprecision(2) << classica
+              << std::setw(18) << desenrolada
+              << classica / desenrolada << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 100000);
+    long buscas = lerArgumento(argc, argv, 2, 1000);
+
+    // Elementos alocados em ordem embaralhada, como numa lista que cresceu aos poucos
+    std::mt19937_64 gerador(42);
+    std::vector<long> ordem(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        ordem[i] = i;
+    }
+    std::shuffle(ordem.begin(), ordem.end(), gerador);
+
+    ListaSimplesmenteEncadeada classica;
+    ListaDesenrolada desenrolada;
+    for (long id : ordem) {
+        classica.inserirNoFim(std::make_unique<Produto>(id, "Item", "Bench", "Marca", 1.0, 1));
+        desenrolada.inserirNoFim(std::make_unique<Produto>(id, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    std::uniform_int_distribution<long> sorteioId(0, 2 * quantidade - 1);
+    std::vector<long> ids(buscas);
+    for (long& id : ids) {
+        id = sorteioId(gerador);
+    }
+    std::uniform_int_distribution<int> sorteioPosicao(0, static_cast<int>(quantidade) - 1);
+    std::vector<int> posicoes(buscas);
+    for (int& posicao : posicoes) {
+        posicao = sorteioPosicao(gerador);
+    }
+
+    std::cout << std::string(82, '=') << std::endl;
+    std::cout << "BENCHMARK: LISTA SIMPLESMENTE ENCADEADA vs LISTA DESENROLADA" << std::endl;
+    std::cout << "Elementos: " << quantidade << " | Buscas/acessos: " << buscas
+              << " | Elementos por bloco: " << ListaDesenrolada::CAPACIDADE_BLOCO << std::endl;
+    std::cout << std::string(82, '=') << std::endl;
+    std::cout << std::left << std::setw(larguraExibicao("Operação", 36)) << "Operação"
+              << std::setw(larguraExibicao("Clássica (ms)", 18)) << "Clássica (ms)"
+              << std::setw(18) << "Desenrolada (ms)"
+              << "Ganho" << std::endl;
+
+    long encontradosClassica = 0, encontradosDesenrolada = 0;
+    double buscaClassica = medirBusca(classica, ids, encontradosClassica);
+    double buscaDesenrolada = medirBusca(desenrolada, ids, encontradosDesenrolada);
+    imprimirLinha("buscarPeloId", buscaClassica, buscaDesenrolada);
+
+    const int rodadasContagem = 20;
+    long totalClassica = 0, totalDesenrolada = 0;
+    double contagemClassica = medirContagem(classica, rodadasContagem, totalClassica);
+    double contagemDesenrolada = medirContagem(desenrolada, rodadasContagem, totalDesenrolada);
+    imprimirLinha("contarElementos (x20)", contagemClassica, contagemDesenrolada);
+
+    long totalIds = 0;
+    Cronometro cronometro;
+    for (int r = 0; r < rodadasContagem; r++) {
+        totalIds += desenrolada.contarPorId([](long id) { return id % 3 == 0; });
+    }
+    imprimirLinha("contarPorId (x20)", contagemClassica, cronometro.decorridoMs());
+
+    long somaClassica = 0, somaDesenrolada = 0;
+    double posicaoClassica = medirPosicoes(classica, posicoes, somaClassica);
+    double posicaoDesenrolada = medirPosicoes(desenrolada, posicoes, somaDesenrolada);
+    imprimirLinha("obterElementoPorPosicao", posicaoClassica, posicaoDesenrolada);
+
+    bool confere = encontradosClassica == encontradosDesenrolada && totalClassica == totalDesenrolada
+                   && totalIds == totalDesenrolada && somaClassica == somaDesenrolada;
+    std::cout << "\nBlocos da lista desenrolada: " << desenrolada.getBlocos()
+              << " | Resultados conferem? " << (confere ? "Sim" : "Não") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaIntrusiva.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Tempos de cada operação para uma lista
+ */
+struct Tempos {
+    double inserir;
+    double percorrer;
+    double removerPeloId;
+    double removerConhecido;
+    double removerPrimeiro;
+    long conferencia;    // Soma usada para conferir que as listas têm o mesmo conteúdo
+};
+
+std::vector<std::unique_ptr<Produto>> criarProdutos(long quantidade) {
+    std::vector<std::unique_ptr<Produto>> produtos;
+    produtos.reserve(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        produtos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, static_cast<int>(i % 100)));
+    }
+    return produtos;
+}
+
+/**
+ * @brief Mede inserção, percurso e remoções em uma lista
+ * @param lista Lista vazia
+ * @param ids IDs distintos sorteados para removerPeloId
+ * @param conhecidos IDs distintos (e diferentes de ids) dos elementos removidos por removerConhecido
+ * @param removerConhecido Remove um elemento cujo ponteiro já se tem em mãos
+ *
+ * Os elementos são criados antes e guardados depois das medições,
+ * então os tempos contam só o trabalho da lista (nós incluídos).
+ */
+template<typename Lista, typename Acessar, typename RemoverConhecido>
+Tempos medir(Lista& lista, long quantidade, int rodadas, const std::vector<long>& ids,
+             const std::vector<long>& conhecidos, Acessar acessar, RemoverConhecido removerConhecido) {
+    Tempos tempos{};
+    auto produtos = criarProdutos(quantidade);
+    std::vector<Produto*> alvos;
+    for (long id : conhecidos) {
+        alvos.push_back(produtos[id].get());
+    }
+
+    Cronometro cronometro;
+    for (auto& produto : produtos) {
+        lista.inserirNoFim(std::move(produto));
+    }
+    tempos.inserir = cronometro.decorridoMs();
+
+    cronometro.reiniciar();
+    for (int r = 0; r < rodadas; r++) {
+        lista.paraCada([&tempos, &acessar](auto& elemento) {
+            tempos.conferencia += acessar(elemento).getQuantidadeEstoque();
+        });
+    }
+    tempos.percorrer = cronometro.decorridoMs();
+
+    std::vector<std::unique_ptr<Elemento>> removidos;
+    removidos.reserve(quantidade);
+
+    cronometro.reiniciar();
+    for (long id : ids) {
+        removidos.push_back(lista.removerPeloId(id));
+    }
+    tempos.removerPeloId = cronometro.decorridoMs();
+
+    cronometro.reiniciar();
+    for (Produto* alvo : alvos) {
+        removidos.push_back(removerConhecido(lista, alvo));
+    }
+    tempos.removerConhecido = cronometro.decorridoMs();
+
+    cronometro.reiniciar();
+    while (!lista.estaVazia()) {
+        removidos.push_back(lista.removerPrimeiro());
+    }
+    tempos.removerPrimeiro = cronometro.decorridoMs();
+
+    return tempos;
+}
+
+void imprimirLinha(const std::string& operacao, double heap, double pool, double intrusiva) {
+    std::cout << std::left << std::setw(30) << operacao
+              << std::setw(14) << std::fixed << std::setprecision(2) << heap
+              << std::setw(14) << pool
+              << std::setw(16) << intrusiva
+              << heap / intrusiva << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    int rodadas = static_cast<int>(lerArgumento(argc, argv, 2, 10));
+    long remocoesPorId = lerArgumento(argc, argv, 3, 200);
+
+    // Duas amostras disjuntas de IDs: uma para cada tipo de remoção
+    std::mt19937_64 gerador(7);
+    std::vector<long> permutacao(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        permutacao[i] = i;
+    }
+    std::shuffle(permutacao.begin(), permutacao.end(), gerador);
+    std::vector<long> ids(permutacao.begin(), permutacao.begin() + remocoesPorId);
+    std::vector<long> conhecidos(permutacao.begin() + remocoesPorId, permutacao.begin() + 2 * remocoesPorId);
+    permutacao.clear();
+    permutacao.shrink_to_fit();
+
+    // A lista com nós precisa procurar o elemento pelo ID; a intrusiva o desencadeia direto
+    auto comoProduto = [](Elemento& e) -> Produto& { return static_cast<Produto&>(e); };
+    auto removerDaDupla = [](ListaDuplamenteEncadeada& lista, Produto* alvo) { return lista.removerPeloId(alvo->getID()); };
+
+    Tempos heap, pool, intrusiva;
+    {
+        ListaDuplamenteEncadeada lista(false);
+        heap = medir(lista, quantidade, rodadas, ids, conhecidos, comoProduto, removerDaDupla);
+    }
+    {
+        ListaDuplamenteEncadeada lista(true);
+        pool = medir(lista, quantidade, rodadas, ids, conhecidos, comoProduto, removerDaDupla);
+    }
+    {
+        ListaIntrusiva<Produto> lista;
+        intrusiva = medir(lista, quantidade, rodadas, ids, conhecidos,
+                          [](Produto& p) -> Produto& { return p; },
+                          [](ListaIntrusiva<Produto>& l, Produto* alvo) { return l.remover(alvo); });
+    }
+
+    std::cout << std::string(82, '=') << std::endl;
+    std::cout << "BENCHMARK: LISTA DUPLAMENTE ENCADEADA vs LISTA INTRUSIVA" << std::endl;
+    std::cout << "Elementos: " << quantidade << " | Percursos: " << rodadas
+              << " | Remoções por ID: " << remocoesPorId << std::endl;
+    std::cout << std::string(82, '=') << std::endl;
+    std::cout << std::left << std::setw(larguraExibicao("Operação (ms)", 30)) << "Operação (ms)"
+              << std::setw(14) << "Dupla (heap)"
+              << std::setw(14) << "Dupla (pool)"
+              << std::setw(16) << "Intrusiva"
+              << "Ganho vs heap" << std::endl;
+
+    imprimirLinha("inserirNoFim", heap.inserir, pool.inserir, intrusiva.inserir);
+    imprimirLinha("paraCada", heap.percorrer, pool.percorrer, intrusiva.percorrer);
+    imprimirLinha("removerPeloId", heap.removerPeloId, pool.removerPeloId, intrusiva.removerPeloId);
+    imprimirLinha("remover elemento conhecido", heap.removerConhecido, pool.removerConhecido, intrusiva.removerConhecido);
+    imprimirLinha("removerPrimeiro (esvaziar)", heap.removerPrimeiro, pool.removerPrimeiro, intrusiva.removerPrimeiro);
+
+    bool confere = heap.conferencia == intrusiva.conferencia && pool.conferencia == intrusiva.conferencia;
+    std::cout << "\nRemover elemento conhecido: dupla usa removerPeloId, intrusiva usa remover(ponteiro)" << std::endl;
+    std::cout << "Alocações por inserção: dupla = 1 nó, intrusiva = 0"
+              << " | Resultados conferem? " << (confere ? "Sim" : "Não") << std::endl;
+
+    return 0;
+}
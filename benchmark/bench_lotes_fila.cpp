@@ -0,0 +1,90 @@
+#include "../src/estruturas_sequenciais/Fila.h"
+#include "../src/estruturas_sequenciais/FilaOtimizada.h"
+#include "../src/estruturas_encadeadas/FilaEncadeada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Passa 'total' elementos pela fila, um por chamada, em rodadas de 'lote'
+ * @return Tempo em milissegundos
+ */
+template<typename Fila>
+double medirUmPorVez(Fila& fila, std::vector<std::unique_ptr<Elemento>>& elementos, int lote, long total) {
+    Cronometro cronometro;
+    for (long feitos = 0; feitos < total; feitos += lote) {
+        for (int i = 0; i < lote; i++) {
+            fila.enfileirar(std::move(elementos[i]));
+        }
+        for (int i = 0; i < lote; i++) {
+            elementos[i] = fila.desenfileirar();
+        }
+    }
+    return cronometro.decorridoMs();
+}
+
+/**
+ * @brief Passa 'total' elementos pela fila usando enfileirarLote/desenfileirarLote
+ * @return Tempo em milissegundos
+ */
+template<typename Fila>
+double medirEmLote(Fila& fila, std::vector<std::unique_ptr<Elemento>>& elementos, int lote, long total) {
+    Cronometro cronometro;
+    for (long feitos = 0; feitos < total; feitos += lote) {
+        fila.enfileirarLote(elementos.data(), lote);
+        fila.desenfileirarLote(elementos.data(), lote);
+    }
+    return cronometro.decorridoMs();
+}
+
+template<typename Fila>
+void compararFila(const std::string& nome, Fila& fila, std::vector<std::unique_ptr<Elemento>>& elementos, long total) {
+    const int lotes[] = {1, 16, 256};
+    for (int lote : lotes) {
+        double tempoUm = medirUmPorVez(fila, elementos, lote, total);
+        double tempoLote = medirEmLote(fila, elementos, lote, total);
+        std::cout << std::left << std::setw(16) << nome
+                  << std::setw(8) << lote
+                  << std::setw(20) << std::fixed << std::setprecision(2) << total / (tempoUm * 1000.0)
+                  << std::setw(20) << total / (tempoLote * 1000.0)
+                  << (tempoUm / tempoLote) << "x" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long total = lerArgumento(argc, argv, 1, 5000000);
+    const int capacidade = 256;
+
+    std::vector<std::unique_ptr<Elemento>> elementos;
+    for (int i = 0; i < capacidade; i++) {
+        elementos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << "BENCHMARK: OPERAÇÕES EM LOTE NAS FILAS" << std::endl;
+    std::cout << "Elementos que atravessam cada fila: " << total << std::endl;
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << std::left << std::setw(16) << "Fila"
+              << std::setw(8) << "Lote"
+              << std::setw(20) << "Um/vez (Melem/s)"
+              << std::setw(20) << "Em lote (Melem/s)"
+              << "Ganho" << std::endl;
+
+    Fila fila(capacidade);
+    compararFila("Fila", fila, elementos, total);
+
+    FilaOtimizada filaOtimizada(capacidade);
+    compararFila("FilaOtimizada", filaOtimizada, elementos, total);
+
+    FilaEncadeada filaEncadeada;
+    compararFila("FilaEncadeada", filaEncadeada, elementos, total);
+
+    return 0;
+}
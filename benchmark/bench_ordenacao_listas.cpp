@@ -0,0 +1,121 @@
+#include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/elementos/Aluno.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Comparadores usados nas duas abordagens
+ */
+bool menorId(const Elemento& a, const Elemento& b) {
+    return a.getID() < b.getID();
+}
+
+bool maiorNota(const Elemento& a, const Elemento& b) {
+    return static_cast<const Aluno&>(a).getNota() > static_cast<const Aluno&>(b).getNota();
+}
+
+/**
+ * @brief Preenche a lista com IDs embaralhados e notas de 0 a 10 (muitos empates)
+ */
+template<typename Lista>
+void preencher(Lista& lista, long quantidade) {
+    std::vector<long> ids(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        ids[i] = i;
+    }
+    std::mt19937 gerador(47);
+    std::shuffle(ids.begin(), ids.end(), gerador);
+    for (long id : ids) {
+        lista.inserirNoFim(std::make_unique<Aluno>(id, "Aluno", "Curso", static_cast<double>(gerador() % 11)));
+    }
+}
+
+/**
+ * @brief Ordena a lista pelo merge sort que religa os nós
+ * @return Milissegundos
+ */
+template<typename Lista, typename Comparador>
+double ordenarNaLista(Lista& lista, Comparador menor) {
+    Cronometro cronometro;
+    lista.ordenar(menor);
+    return cronometro.decorridoMs();
+}
+
+/**
+ * @brief Esvazia a lista em um vector, ordena com std::stable_sort e reinsere
+ * @return Milissegundos
+ */
+template<typename Lista, typename Comparador>
+double ordenarPorVector(Lista& lista, Comparador menor) {
+    Cronometro cronometro;
+    std::vector<std::unique_ptr<Elemento>> elementos;
+    elementos.reserve(lista.getTamanho());
+    while (!lista.estaVazia()) {
+        elementos.push_back(lista.removerPrimeiro());
+    }
+    std::stable_sort(elementos.begin(), elementos.end(),
+                     [&menor](const std::unique_ptr<Elemento>& a, const std::unique_ptr<Elemento>& b) {
+                         return menor(*a, *b);
+                     });
+    for (auto& elemento : elementos) {
+        lista.inserirNoFim(std::move(elemento));
+    }
+    return cronometro.decorridoMs();
+}
+
+template<typename Lista, typename Comparador>
+void medir(const std::string& nome, long quantidade, Comparador menor) {
+    Lista naLista, porVector;
+    preencher(naLista, quantidade);
+    preencher(porVector, quantidade);
+
+    double tempoNaLista = ordenarNaLista(naLista, menor);
+    double tempoPorVector = ordenarPorVector(porVector, menor);
+    // Segunda ordenação: a entrada já está ordenada pela mesma chave
+    double tempoNaListaOrdenada = ordenarNaLista(naLista, menor);
+
+    std::cout << "  " << std::left << std::setw(24) << nome
+              << std::setw(11) << quantidade
+              << std::fixed << std::setprecision(2)
+              << std::setw(18) << tempoPorVector
+              << std::setw(18) << tempoNaLista
+              << std::setw(20) << tempoNaListaOrdenada
+              << std::setprecision(2) << tempoPorVector / tempoNaLista << "x" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long maior = lerArgumento(argc, argv, 1, 1000000);
+    const long tamanhos[] = {std::min(1000L, maior), std::min(100000L, maior), maior};
+
+    std::cout << std::string(98, '=') << std::endl;
+    std::cout << "BENCHMARK: ORDENAÇÃO DAS LISTAS ENCADEADAS (ms por ordenação)" << std::endl;
+    std::cout << "vector + std::stable_sort: esvazia a lista, ordena os ponteiros e reinsere (novos nós)" << std::endl;
+    std::cout << "merge sort na lista: religa os nós já existentes, sem alocação" << std::endl;
+    std::cout << std::string(98, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(24) << "Lista / chave"
+              << std::setw(11) << "Elementos"
+              << std::setw(18) << "vector + sort"
+              << std::setw(18) << "merge sort"
+              << std::setw(larguraExibicao("merge (já ordenada)", 20)) << "merge (já ordenada)"
+              << "Ganho" << std::endl;
+
+    for (long quantidade : tamanhos) {
+        medir<ListaSimplesmenteEncadeada>("Simples / ID", quantidade, menorId);
+        medir<ListaSimplesmenteEncadeada>("Simples / nota", quantidade, maiorNota);
+        medir<ListaDuplamenteEncadeada>("Dupla / ID", quantidade, menorId);
+        medir<ListaDuplamenteEncadeada>("Dupla / nota", quantidade, maiorNota);
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/elementos/Funcionario.h"
+#include "../ConfigLocale.h"
+#include "ContadorAlocacoes.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Comparação por nome como era com getNome() devolvendo std::string por valor
+ *
+ * Cada chamada construía uma string nova: as cópias abaixo são exatamente
+ * o que o retorno por valor fazia.
+ */
+bool menorNomeCopiando(const Elemento& a, const Elemento& b) {
+    std::string nomeA = static_cast<const Funcionario&>(a).getNome();
+    std::string nomeB = static_cast<const Funcionario&>(b).getNome();
+    return nomeA < nomeB;
+}
+
+bool menorNome(const Elemento& a, const Elemento& b) {
+    return static_cast<const Funcionario&>(a).getNome() < static_cast<const Funcionario&>(b).getNome();
+}
+
+struct Resultado {
+    double ms;
+    long long alocacoes;
+};
+
+template<typename Ordenacao>
+Resultado medir(Ordenacao ordenacao) {
+    long long alocacoesAntes = ContadorAlocacoes::alocacoes;
+    Cronometro cronometro;
+    ordenacao();
+    return {cronometro.decorridoMs(), ContadorAlocacoes::alocacoes - alocacoesAntes};
+}
+
+void imprimirLinha(const std::string& estrutura, const std::string& nomes, const Resultado& copia, const Resultado& referencia) {
+    std::cout << "  " << std::left << std::setw(22) << estrutura
+              << std::setw(16) << nomes
+              << std::fixed << std::setprecision(0)
+              << std::setw(13) << copia.ms
+              << std::setw(17) << referencia.ms
+              << std::setw(17) << copia.alocacoes
+              << std::setw(17) << referencia.alocacoes
+              << std::setprecision(1) << copia.ms / referencia.ms << "x" << std::endl;
+}
+
+/**
+ * @brief Ordena pelo nome os mesmos funcionários com os dois comparadores
+ *
+ * Os IDs seguem a ordem de inserção (embaralhada por nome): ordenar por ID
+ * devolve a lista à ordem inicial entre uma medida e outra.
+ */
+void medirNomes(const std::string& descricao, const std::vector<std::string>& nomes) {
+    ListaDuplamenteEncadeada lista;
+    std::vector<const Elemento*> ponteiros;
+    ponteiros.reserve(nomes.size());
+    for (std::size_t i = 0; i < nomes.size(); i++) {
+        lista.inserirNoFim(std::make_unique<Funcionario>(static_cast<long>(i), nomes[i], "Analista", "Tecnologia", 5000.0));
+        ponteiros.push_back(lista.getUltimo());
+    }
+
+    std::vector<const Elemento*> vetor = ponteiros;
+    Resultado sortCopia = medir([&vetor]() {
+        std::sort(vetor.begin(), vetor.end(), [](const Elemento* a, const Elemento* b) { return menorNomeCopiando(*a, *b); });
+    });
+    vetor = ponteiros;
+    Resultado sortReferencia = medir([&vetor]() {
+        std::sort(vetor.begin(), vetor.end(), [](const Elemento* a, const Elemento* b) { return menorNome(*a, *b); });
+    });
+    imprimirLinha("vector + std::sort", descricao, sortCopia, sortReferencia);
+
+    Resultado listaCopia = medir([&lista]() { lista.ordenar(menorNomeCopiando); });
+    lista.ordenarPorId();
+    Resultado listaReferencia = medir([&lista]() { lista.ordenar(menorNome); });
+    imprimirLinha("Lista dupla (merge)", descricao, listaCopia, listaReferencia);
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = lerArgumento(argc, argv, 1, 1000000);
+    const char* sobrenomes[] = {"Silva", "Santos", "Oliveira", "Souza", "Rodrigues", "Ferreira", "Alves", "Pereira"};
+
+    // Mesma permutação de números nos dois conjuntos: só o tamanho do nome muda
+    std::vector<long> numeros(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        numeros[i] = i;
+    }
+    std::mt19937 gerador(48);
+    std::shuffle(numeros.begin(), numeros.end(), gerador);
+    std::vector<std::string> curtos, longos;
+    curtos.reserve(quantidade);
+    longos.reserve(quantidade);
+    for (long i = 0; i < quantidade; i++) {
+        curtos.push_back("F" + std::to_string(10000000 + numeros[i]));
+        longos.push_back(std::string("Maria ") + sobrenomes[numeros[i] % 8] + " de " + std::to_string(10000000 + numeros[i]));
+    }
+
+    std::cout << std::string(110, '=') << std::endl;
+    std::cout << "BENCHMARK: ORDENAÇÃO DE " << quantidade << " FUNCIONÁRIOS POR NOME" << std::endl;
+    std::cout << "Cópia: getNome() por valor (duas strings por comparação) | Referência: const std::string&" << std::endl;
+    std::cout << "Curtos: 9 bytes, cabem na string sem heap | Longos: ~25 bytes, cada cópia aloca" << std::endl;
+    std::cout << std::string(110, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "Estrutura"
+              << std::setw(16) << "Nomes"
+              << std::setw(larguraExibicao("Cópia (ms)", 13)) << "Cópia (ms)"
+              << std::setw(larguraExibicao("Referência (ms)", 17)) << "Referência (ms)"
+              << std::setw(larguraExibicao("Alocações cópia", 17)) << "Alocações cópia"
+              << std::setw(larguraExibicao("Alocações ref.", 17)) << "Alocações ref."
+              << "Ganho" << std::endl;
+
+    medirNomes("curtos", curtos);
+    medirNomes("longos", longos);
+    return 0;
+}
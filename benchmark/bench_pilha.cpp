@@ -0,0 +1,79 @@
+#include "../src/estruturas_sequenciais/Pilha.h"
+#include "../src/estruturas_sequenciais/PilhaOtimizada.h"
+#include "../src/estruturas_encadeadas/PilhaEncadeada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Empilha e desempilha 'profundidade' elementos, em rodadas, até 'total' operações
+ * @return Nanossegundos por par empilhar/desempilhar
+ */
+template<typename Pilha>
+double medirPilha(Pilha& pilha, std::vector<std::unique_ptr<Elemento>>& elementos, int profundidade, long total) {
+    long rodadas = total / profundidade;
+    long soma = 0;
+    Cronometro cronometro;
+    for (long r = 0; r < rodadas; r++) {
+        for (int i = 0; i < profundidade; i++) {
+            pilha.empilhar(std::move(elementos[i]));
+        }
+        for (int i = profundidade - 1; i >= 0; i--) {
+            elementos[i] = pilha.desempilhar();
+            soma += elementos[i]->getID();
+        }
+    }
+    double tempo = cronometro.decorridoMs();
+    // Usa a soma para que o laço não seja descartado pelo otimizador
+    if (soma < 0) {
+        std::cout << soma << std::endl;
+    }
+    return tempo * 1e6 / (rodadas * profundidade);
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long total = lerArgumento(argc, argv, 1, 20000000);
+    const int profundidades[] = {8, 16, 1024};
+
+    std::vector<std::unique_ptr<Elemento>> elementos;
+    for (int i = 0; i < 1024; i++) {
+        elementos.push_back(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << "BENCHMARK: EMPILHAR/DESEMPILHAR (ns por par)" << std::endl;
+    std::cout << "Operações por cenário: " << total << std::endl;
+    std::cout << std::string(76, '=') << std::endl;
+    std::cout << std::left << std::setw(14) << "Profundidade"
+              << std::setw(16) << "Pilha"
+              << std::setw(16) << "PilhaEncadeada"
+              << std::setw(16) << "PilhaOtimizada"
+              << "Ganho s/ Pilha" << std::endl;
+
+    for (int profundidade : profundidades) {
+        // Pilha com capacidade suficiente para a lista interna não redimensionar
+        Pilha pilha(profundidade);
+        double tempoPilha = medirPilha(pilha, elementos, profundidade, total);
+
+        PilhaEncadeada pilhaEncadeada;
+        double tempoEncadeada = medirPilha(pilhaEncadeada, elementos, profundidade, total);
+
+        PilhaOtimizada pilhaOtimizada;
+        double tempoOtimizada = medirPilha(pilhaOtimizada, elementos, profundidade, total);
+
+        std::cout << std::left << std::setw(14) << profundidade
+                  << std::setw(16) << std::fixed << std::setprecision(2) << tempoPilha
+                  << std::setw(16) << tempoEncadeada
+                  << std::setw(16) << tempoOtimizada
+                  << (tempoPilha / tempoOtimizada) << "x" << std::endl;
+    }
+
+    return 0;
+}
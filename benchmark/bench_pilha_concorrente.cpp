@@ -0,0 +1,102 @@
+#include "../src/estruturas_concorrentes/PilhaConcorrente.h"
+#include "../src/estruturas_encadeadas/PilhaEncadeada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Linha de base: PilhaEncadeada protegida por um std::mutex global
+ */
+class PilhaComTrava {
+private:
+    PilhaEncadeada pilha;
+    std::mutex mutex;
+
+public:
+    void empilhar(std::unique_ptr<Elemento> elemento) {
+        std::lock_guard<std::mutex> trava(mutex);
+        pilha.empilhar(std::move(elemento));
+    }
+
+    std::unique_ptr<Elemento> desempilhar() {
+        std::lock_guard<std::mutex> trava(mutex);
+        return pilha.desempilhar();
+    }
+};
+
+/**
+ * @brief Cada thread alterna empilhar/desempilhar em rajadas, como uma pilha de "desfazer"
+ * @return Tempo total em milissegundos
+ */
+template<typename Pilha>
+double executarCenario(Pilha& pilha, int threads, long operacoes) {
+    const int rajada = 4;
+    long porThread = operacoes / threads;
+
+    // Elementos criados antes da medição para não medir o alocador
+    std::vector<std::vector<std::unique_ptr<Elemento>>> locais(threads);
+    for (int t = 0; t < threads; t++) {
+        for (int i = 0; i < rajada; i++) {
+            locais[t].push_back(std::make_unique<Produto>(t * rajada + i, "Item", "Bench", "Marca", 1.0, 1));
+        }
+    }
+
+    std::vector<std::thread> trabalhadores;
+    Cronometro cronometro;
+    for (int t = 0; t < threads; t++) {
+        trabalhadores.emplace_back([&, t] {
+            auto& elementos = locais[t];
+            for (long feitos = 0; feitos < porThread; feitos += 2 * rajada) {
+                for (auto& elemento : elementos) {
+                    pilha.empilhar(std::move(elemento));
+                }
+                for (auto& elemento : elementos) {
+                    elemento = pilha.desempilhar();
+                }
+            }
+        });
+    }
+    for (auto& trabalhador : trabalhadores) {
+        trabalhador.join();
+    }
+    return cronometro.decorridoMs();
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long operacoes = lerArgumento(argc, argv, 1, 4000000);
+    const int contagensThreads[] = {1, 2, 4, 8, 16, 32};
+
+    std::cout << std::string(70, '=') << std::endl;
+    std::cout << "BENCHMARK: PILHA CONCORRENTE (TREIBER) vs PILHA ENCADEADA + MUTEX" << std::endl;
+    std::cout << "Operações por cenário: " << operacoes << std::endl;
+    std::cout << "Núcleos disponíveis: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::string(70, '=') << std::endl;
+
+    std::cout << std::left << std::setw(10) << "Threads"
+              << std::setw(20) << "Mutex (Mops/s)"
+              << std::setw(20) << "Treiber (Mops/s)"
+              << "Ganho" << std::endl;
+
+    for (int threads : contagensThreads) {
+        PilhaComTrava pilhaTrava;
+        double tempoTrava = executarCenario(pilhaTrava, threads, operacoes);
+
+        PilhaConcorrente pilhaConcorrente;
+        double tempoConcorrente = executarCenario(pilhaConcorrente, threads, operacoes);
+
+        std::cout << std::left << std::setw(10) << threads
+                  << std::setw(20) << std::fixed << std::setprecision(2) << operacoes / (tempoTrava * 1000.0)
+                  << std::setw(20) << operacoes / (tempoConcorrente * 1000.0)
+                  << (tempoTrava / tempoConcorrente) << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ * @brief Rotatividade em padrão de fila: insere no fim e remove do início
+ * @param lista Lista já preenchida com a quantidade de elementos em regime
+ * @param operacoes Número de pares inserção/remoção
+ * @return Tempo em milissegundos
+ */
+template<typename Lista>
+double medirRotatividade(Lista& lista, long operacoes) {
+    Cronometro cronometro;
+    for (long i = 0; i < operacoes; i++) {
+        // O elemento que sai do início volta pelo fim em um nó novo
+        lista.inserirNoFim(lista.removerPrimeiro());
+    }
+    return cronometro.decorridoMs();
+}
+
+template<typename Lista>
+void compararLista(const std::string& nome, long operacoes, int emRegime) {
+    Lista comHeap(false);
+    Lista comPool(true);
+    for (int i = 0; i < emRegime; i++) {
+        comHeap.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+        comPool.inserirNoFim(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+
+    double tempoHeap = medirRotatividade(comHeap, operacoes);
+    double tempoPool = medirRotatividade(comPool, operacoes);
+
+    std::cout << std::left << std::setw(34) << nome
+              << std::setw(14) << std::fixed << std::setprecision(1) << tempoHeap * 1e6 / operacoes
+              << std::setw(14) << tempoPool * 1e6 / operacoes
+              << std::setw(10) << std::setprecision(2) << tempoHeap / tempoPool
+              << comPool.getPoolNos()->getSlabsAlocados() << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long operacoes = lerArgumento(argc, argv, 1, 10000000);
+    int emRegime = static_cast<int>(lerArgumento(argc, argv, 2, 1000));
+
+    std::cout << std::string(80, '=') << std::endl;
+    std::cout << "BENCHMARK: NÓS COM new/delete vs POOL DE NÓS" << std::endl;
+    std::cout << "Operações (inserir no fim + remover do início): " << operacoes
+              << " | Elementos em regime: " << emRegime << std::endl;
+    std::cout << std::string(80, '=') << std::endl;
+    std::cout << std::left << std::setw(34) << "Lista"
+              << std::setw(14) << "Heap (ns/op)"
+              << std::setw(14) << "Pool (ns/op)"
+              << std::setw(10) << "Ganho"
+              << "Slabs" << std::endl;
+
+    compararLista<ListaSimplesmenteEncadeada>("ListaSimplesmenteEncadeada", operacoes, emRegime);
+    compararLista<ListaDuplamenteEncadeada>("ListaDuplamenteEncadeada", operacoes, emRegime);
+    compararLista<ListaDuplamenteEncadeadaCircular>("ListaDuplamenteEncadeadaCircular", operacoes, emRegime);
+
+    return 0;
+}
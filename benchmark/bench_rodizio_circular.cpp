@@ -0,0 +1,156 @@
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/elementos/Funcionario.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * @brief Preenche a lista com trabalhadores de IDs 0..quantidade-1
+ */
+void preencher(ListaDuplamenteEncadeadaCircular& lista, long quantidade) {
+    for (long i = 0; i < quantidade; i++) {
+        lista.inserirNoFim(std::make_unique<Funcionario>(i, "Trabalhador", "Operador", "Escala", 3000.0));
+    }
+}
+
+/**
+ * @brief Rodízio pela posição: obterElementoPorPosicao(passo % n) a cada despacho
+ * @return Nanossegundos por despacho
+ */
+double rodizioPorPosicao(const ListaDuplamenteEncadeadaCircular& lista, long passos, long& conferencia) {
+    int tamanho = lista.getTamanho();
+    Cronometro cronometro;
+    for (long passo = 0; passo < passos; passo++) {
+        conferencia += lista.obterElementoPorPosicao(static_cast<int>(passo % tamanho))->getID();
+    }
+    return cronometro.decorridoMs() * 1e6 / passos;
+}
+
+/**
+ * @brief Rodízio girando a própria lista: rotacionarDireita(1) e consulta da posição 0
+ * @return Nanossegundos por despacho
+ */
+double rodizioPorRotacao(ListaDuplamenteEncadeadaCircular& lista, long passos, long& conferencia) {
+    Cronometro cronometro;
+    for (long passo = 0; passo < passos; passo++) {
+        conferencia += lista.obterElementoPorPosicao(0)->getID();
+        lista.rotacionarDireita(1);
+    }
+    return cronometro.decorridoMs() * 1e6 / passos;
+}
+
+/**
+ * @brief Rodízio pelo cursor: atual() e avancar()
+ * @return Nanossegundos por despacho
+ */
+double rodizioPorCursor(ListaDuplamenteEncadeadaCircular& lista, long passos, long& conferencia) {
+    Cronometro cronometro;
+    for (long passo = 0; passo < passos; passo++) {
+        conferencia += lista.atual()->getID();
+        lista.avancar();
+    }
+    return cronometro.decorridoMs() * 1e6 / passos;
+}
+
+/**
+ * @brief Rodízio pelo cursor com rotatividade: a cada 64 despachos um
+ * trabalhador sai (removerAtual) e outro entra no fim da fila
+ * @return Nanossegundos por despacho
+ */
+double rodizioComRotatividade(ListaDuplamenteEncadeadaCircular& lista, long passos, long& conferencia) {
+    long proximoId = lista.getTamanho();
+    Cronometro cronometro;
+    for (long passo = 0; passo < passos; passo++) {
+        conferencia += lista.atual()->getID();
+        if ((passo & 63) == 63) {
+            lista.removerAtual();
+            lista.inserirNoFim(std::make_unique<Funcionario>(proximoId++, "Trabalhador", "Operador", "Escala", 3000.0));
+        } else {
+            lista.avancar();
+        }
+    }
+    return cronometro.decorridoMs() * 1e6 / passos;
+}
+
+/**
+ * @brief Rotações por k aleatório
+ * @param passoAPasso Se true, faz k rotações de 1 (sempre k saltos, como a
+ *                    rotação antiga); senão uma rotação de k (min(k, n - k) saltos)
+ * @return Nanossegundos por rotação
+ */
+double rotacoesAleatorias(ListaDuplamenteEncadeadaCircular& lista, long rotacoes, bool passoAPasso) {
+    std::mt19937 gerador(41);
+    std::uniform_int_distribution<int> sorteio(0, lista.getTamanho() - 1);
+    Cronometro cronometro;
+    for (long i = 0; i < rotacoes; i++) {
+        int posicoes = sorteio(gerador);
+        if (passoAPasso) {
+            for (int passo = 0; passo < posicoes; passo++) {
+                lista.rotacionarDireita(1);
+            }
+        } else {
+            lista.rotacionarDireita(posicoes);
+        }
+    }
+    return cronometro.decorridoMs() * 1e6 / rotacoes;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long passos = lerArgumento(argc, argv, 1, 10000000);
+    const long tamanhos[] = {16, 1000, 100000};
+
+    std::cout << std::string(104, '=') << std::endl;
+    std::cout << "BENCHMARK: ESCALONADOR EM RODÍZIO SOBRE A LISTA CIRCULAR" << std::endl;
+    std::cout << "Despachos por cenário: " << passos << " (rodízio por posição usa menos em listas grandes)" << std::endl;
+    std::cout << std::string(104, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "Trabalhadores"
+              << std::setw(larguraExibicao("Posição", 11)) << "Posição"
+              << std::setw(larguraExibicao("Rotação", 11)) << "Rotação"
+              << std::setw(11) << "Cursor"
+              << std::setw(larguraExibicao("Cursor + saídas", 19)) << "Cursor + saídas"
+              << std::setw(19) << "Rot. k passos"
+              << "Rot. min(k, n-k)" << std::endl;
+    std::cout << "  " << std::setw(14) << ""
+              << std::setw(11) << "(ns/op)"
+              << std::setw(11) << "(ns/op)"
+              << std::setw(11) << "(ns/op)"
+              << std::setw(19) << "(ns/op)"
+              << std::setw(19) << "(ns/op)"
+              << "(ns/op)" << std::endl;
+
+    long conferencia = 0;
+    for (long tamanho : tamanhos) {
+        ListaDuplamenteEncadeadaCircular lista(true);
+        preencher(lista, tamanho);
+
+        // O rodízio por posição custa O(n) por despacho: limita o total de saltos
+        long passosPosicao = std::max(1000L, std::min(passos, passos * 16 / tamanho));
+        long rotacoes = std::max(1000L, std::min(passos / 10, passos * 16 / tamanho));
+
+        double posicao = rodizioPorPosicao(lista, passosPosicao, conferencia);
+        double rotacao = rodizioPorRotacao(lista, passos, conferencia);
+        double cursor = rodizioPorCursor(lista, passos, conferencia);
+        double rotatividade = rodizioComRotatividade(lista, passos, conferencia);
+        double rotacaoPassoAPasso = rotacoesAleatorias(lista, rotacoes, true);
+        double rotacaoK = rotacoesAleatorias(lista, rotacoes, false);
+
+        std::cout << "  " << std::setw(14) << tamanho
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(11) << posicao
+                  << std::setw(11) << rotacao
+                  << std::setw(11) << cursor
+                  << std::setw(19) << rotatividade
+                  << std::setw(19) << rotacaoPassoAPasso
+                  << rotacaoK << std::endl;
+    }
+
+    std::cout << "\nConferência: " << conferencia << std::endl;
+    return 0;
+}
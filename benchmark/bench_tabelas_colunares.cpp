@@ -0,0 +1,289 @@
+#include "../src/estruturas_sequenciais/TabelaAlunos.h"
+#include "../src/estruturas_sequenciais/TabelaFuncionarios.h"
+#include "../src/estruturas_sequenciais/TabelaProdutos.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/elementos/Aluno.h"
+#include "../src/elementos/Funcionario.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+typedef std::vector<std::unique_ptr<Elemento>> VetorElementos;
+
+const char* CATEGORIAS[] = {"Eletrônicos", "Periféricos", "Móveis", "Papelaria", "Áudio", "Games", "Cozinha", "Jardim"};
+const char* CURSOS[] = {"Computação", "Engenharia", "Direito", "Medicina", "Física", "Letras"};
+const char* DEPARTAMENTOS[] = {"TI", "RH", "Financeiro", "Vendas", "Jurídico"};
+
+/**
+ * @brief Mede uma consulta repetindo-a algumas vezes
+ * @return Nanossegundos por registro
+ */
+template<typename Consulta>
+double medir(long registros, int repeticoes, double& conferencia, Consulta consulta) {
+    Cronometro cronometro;
+    for (int r = 0; r < repeticoes; r++) {
+        conferencia += consulta();
+    }
+    return cronometro.decorridoMs() * 1e6 / (static_cast<double>(registros) * repeticoes);
+}
+
+void imprimirLinha(const std::string& consulta, double lista, double vetor, double tabela) {
+    std::cout << "  " << std::left << std::setw(larguraExibicao(consulta, 32)) << consulta
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << lista
+              << std::setw(20) << vetor
+              << std::setw(12) << tabela
+              << std::setprecision(1) << vetor / tabela << "x" << std::endl;
+}
+
+void medirProdutos(long registros, int repeticoes, double& conferencia) {
+    std::mt19937 gerador(48);
+    ListaDuplamenteEncadeada lista;
+    VetorElementos vetor;
+    TabelaProdutos tabela;
+    vetor.reserve(registros);
+    tabela.reservar(static_cast<int>(registros));
+    for (long i = 0; i < registros; i++) {
+        const char* categoria = CATEGORIAS[gerador() % 8];
+        double preco = (gerador() % 100000) / 100.0;
+        int estoque = static_cast<int>(gerador() % 50);
+        std::string nome = "Produto " + std::to_string(i);
+        lista.inserirNoFim(std::make_unique<Produto>(i, nome, categoria, "Marca", preco, estoque));
+        vetor.push_back(std::make_unique<Produto>(i, nome, categoria, "Marca", preco, estoque));
+        tabela.adicionar(i, nome, categoria, "Marca", preco, estoque);
+    }
+
+    imprimirLinha("Valor total do estoque",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            double total = 0.0;
+            lista.paraCada([&total](Elemento& elemento) {
+                total += static_cast<const Produto&>(elemento).calcularValorTotalEstoque();
+            });
+            return total;
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            double total = 0.0;
+            for (const auto& elemento : vetor) {
+                total += static_cast<const Produto&>(*elemento).calcularValorTotalEstoque();
+            }
+            return total;
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return tabela.calcularValorTotalEstoque();
+        }));
+
+    imprimirLinha("Produtos disponíveis",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            int disponiveis = 0;
+            lista.paraCada([&disponiveis](Elemento& elemento) {
+                disponiveis += static_cast<const Produto&>(elemento).estaDisponivel();
+            });
+            return static_cast<double>(disponiveis);
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            int disponiveis = 0;
+            for (const auto& elemento : vetor) {
+                disponiveis += static_cast<const Produto&>(*elemento).estaDisponivel();
+            }
+            return static_cast<double>(disponiveis);
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return static_cast<double>(tabela.contarDisponiveis());
+        }));
+
+    imprimirLinha("Filtro de estoque < 5",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            std::vector<Elemento*> baixos;
+            lista.paraCada([&baixos](Elemento& elemento) {
+                if (static_cast<const Produto&>(elemento).getQuantidadeEstoque() < 5) {
+                    baixos.push_back(&elemento);
+                }
+            });
+            return static_cast<double>(baixos.size());
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            std::vector<Elemento*> baixos;
+            for (const auto& elemento : vetor) {
+                if (static_cast<const Produto&>(*elemento).getQuantidadeEstoque() < 5) {
+                    baixos.push_back(elemento.get());
+                }
+            }
+            return static_cast<double>(baixos.size());
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return static_cast<double>(tabela.filtrarEstoqueBaixo(5).size());
+        }));
+
+    // Agrupar objetos exige o hash da string da categoria de cada um
+    imprimirLinha("Valor por categoria (8)",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            std::unordered_map<std::string, double> porCategoria;
+            lista.paraCada([&porCategoria](Elemento& elemento) {
+                const Produto& produto = static_cast<const Produto&>(elemento);
+                porCategoria[produto.getCategoria()] += produto.calcularValorTotalEstoque();
+            });
+            return porCategoria.begin()->second;
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            std::unordered_map<std::string, double> porCategoria;
+            for (const auto& elemento : vetor) {
+                const Produto& produto = static_cast<const Produto&>(*elemento);
+                porCategoria[produto.getCategoria()] += produto.calcularValorTotalEstoque();
+            }
+            return porCategoria.begin()->second;
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return tabela.valorEstoquePorCategoria()[0];
+        }));
+}
+
+void medirAlunos(long registros, int repeticoes, double& conferencia) {
+    std::mt19937 gerador(49);
+    ListaDuplamenteEncadeada lista;
+    VetorElementos vetor;
+    TabelaAlunos tabela;
+    vetor.reserve(registros);
+    tabela.reservar(static_cast<int>(registros));
+    for (long i = 0; i < registros; i++) {
+        const char* curso = CURSOS[gerador() % 6];
+        double nota = (gerador() % 101) / 10.0;
+        std::string nome = "Aluno " + std::to_string(i);
+        lista.inserirNoFim(std::make_unique<Aluno>(i, nome, curso, nota));
+        vetor.push_back(std::make_unique<Aluno>(i, nome, curso, nota));
+        tabela.adicionar(i, nome, curso, nota);
+    }
+
+    imprimirLinha("Média das notas",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            double soma = 0.0;
+            lista.paraCada([&soma](Elemento& elemento) {
+                soma += static_cast<const Aluno&>(elemento).getNota();
+            });
+            return soma / lista.getTamanho();
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            double soma = 0.0;
+            for (const auto& elemento : vetor) {
+                soma += static_cast<const Aluno&>(*elemento).getNota();
+            }
+            return soma / vetor.size();
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return tabela.mediaNotas();
+        }));
+
+    imprimirLinha("Média por curso (6)",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            std::unordered_map<std::string, std::pair<double, int>> porCurso;
+            lista.paraCada([&porCurso](Elemento& elemento) {
+                const Aluno& aluno = static_cast<const Aluno&>(elemento);
+                std::pair<double, int>& soma = porCurso[aluno.getCurso()];
+                soma.first += aluno.getNota();
+                soma.second++;
+            });
+            return porCurso.begin()->second.first / porCurso.begin()->second.second;
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            std::unordered_map<std::string, std::pair<double, int>> porCurso;
+            for (const auto& elemento : vetor) {
+                const Aluno& aluno = static_cast<const Aluno&>(*elemento);
+                std::pair<double, int>& soma = porCurso[aluno.getCurso()];
+                soma.first += aluno.getNota();
+                soma.second++;
+            }
+            return porCurso.begin()->second.first / porCurso.begin()->second.second;
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return tabela.mediaNotasPorCurso()[0];
+        }));
+}
+
+void medirFuncionarios(long registros, int repeticoes, double& conferencia) {
+    std::mt19937 gerador(50);
+    ListaDuplamenteEncadeada lista;
+    VetorElementos vetor;
+    TabelaFuncionarios tabela;
+    vetor.reserve(registros);
+    tabela.reservar(static_cast<int>(registros));
+    for (long i = 0; i < registros; i++) {
+        const char* departamento = DEPARTAMENTOS[gerador() % 5];
+        double salario = 1500.0 + gerador() % 20000;
+        std::string nome = "Funcionário " + std::to_string(i);
+        lista.inserirNoFim(std::make_unique<Funcionario>(i, nome, "Analista", departamento, salario));
+        vetor.push_back(std::make_unique<Funcionario>(i, nome, "Analista", departamento, salario));
+        tabela.adicionar(i, nome, "Analista", departamento, salario);
+    }
+
+    imprimirLinha("Folha de pagamento",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            double soma = 0.0;
+            lista.paraCada([&soma](Elemento& elemento) {
+                soma += static_cast<const Funcionario&>(elemento).getSalario();
+            });
+            return soma;
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            double soma = 0.0;
+            for (const auto& elemento : vetor) {
+                soma += static_cast<const Funcionario&>(*elemento).getSalario();
+            }
+            return soma;
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return tabela.somaSalarios();
+        }));
+
+    imprimirLinha("Folha por departamento (5)",
+        medir(registros, repeticoes, conferencia, [&lista]() {
+            std::unordered_map<std::string, double> porDepartamento;
+            lista.paraCada([&porDepartamento](Elemento& elemento) {
+                const Funcionario& funcionario = static_cast<const Funcionario&>(elemento);
+                porDepartamento[funcionario.getDepartamento()] += funcionario.getSalario();
+            });
+            return porDepartamento.begin()->second;
+        }),
+        medir(registros, repeticoes, conferencia, [&vetor]() {
+            std::unordered_map<std::string, double> porDepartamento;
+            for (const auto& elemento : vetor) {
+                const Funcionario& funcionario = static_cast<const Funcionario&>(*elemento);
+                porDepartamento[funcionario.getDepartamento()] += funcionario.getSalario();
+            }
+            return porDepartamento.begin()->second;
+        }),
+        medir(registros, repeticoes, conferencia, [&tabela]() {
+            return tabela.folhaPorDepartamento()[0];
+        }));
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long registros = lerArgumento(argc, argv, 1, 1000000);
+    int repeticoes = static_cast<int>(lerArgumento(argc, argv, 2, 5));
+
+    std::cout << std::string(92, '=') << std::endl;
+    std::cout << "BENCHMARK: CONSULTAS DE VARREDURA - OBJETOS vs TABELAS COLUNARES (ns por registro)" << std::endl;
+    std::cout << "Registros por tipo: " << registros << " | Repetições por consulta: " << repeticoes << std::endl;
+    std::cout << "Ganho: vector<unique_ptr> / tabela" << std::endl;
+    std::cout << std::string(92, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(32) << "Consulta"
+              << std::setw(14) << "Lista dupla"
+              << std::setw(20) << "vector<unique_ptr>"
+              << std::setw(12) << "Tabela"
+              << "Ganho" << std::endl;
+
+    double conferencia = 0.0;
+    medirProdutos(registros, repeticoes, conferencia);
+    medirAlunos(registros, repeticoes, conferencia);
+    medirFuncionarios(registros, repeticoes, conferencia);
+
+    std::cout << "\nConferência: " << std::setprecision(0) << conferencia << std::endl;
+    return 0;
+}
@@ -0,0 +1,172 @@
+#include "../src/elementos/Produto.h"
+#include "../src/elementos/TextoInternado.h"
+#include "../ConfigLocale.h"
+#include "ContadorAlocacoes.h"
+#include "Cronometro.h"
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Produto como era antes do pool: categoria e marca em um std::string por objeto
+ */
+class ProdutoSemInternar : public Elemento, public GanchoLista {
+private:
+    std::string nome;
+    std::string categoria;
+    std::string marca;
+    double preco;
+    int quantidadeEstoque;
+
+public:
+    ProdutoSemInternar(long id, const std::string& nome, const std::string& categoria,
+                       const std::string& marca, double preco, int quantidadeEstoque)
+        : Elemento(id), nome(nome), categoria(categoria), marca(marca),
+          preco(preco), quantidadeEstoque(quantidadeEstoque) {}
+
+    // Referência, e não cópia: a comparação mede só o custo de usar strings como chave
+    const std::string& getCategoria() const { return categoria; }
+    double calcularValorTotalEstoque() const { return preco * quantidadeEstoque; }
+    void imprimirInfo() const override {}
+};
+
+/**
+ * @brief Poucas centenas de valores distintos, longos demais para a otimização de strings curtas
+ */
+std::vector<std::string> gerarValores(const std::string& prefixo, int quantidade) {
+    std::vector<std::string> valores;
+    for (int i = 0; i < quantidade; i++) {
+        valores.push_back(prefixo + " " + std::to_string(1000 + i) + " - Eletrônicos e Informática");
+    }
+    return valores;
+}
+
+struct Medidas {
+    double bytesPorRegistro;
+    double blocosPorRegistro;
+    double msConstrucao;
+    double msAgrupamento;
+    double msFiltro;
+};
+
+template<typename T, typename Agrupar, typename Filtrar>
+Medidas medir(long registros, const std::vector<std::string>& categorias, const std::vector<std::string>& marcas,
+              double& conferencia, Agrupar agrupar, Filtrar filtrar) {
+    Medidas medidas;
+    long long bytesAntes = ContadorAlocacoes::bytesVivos;
+    long long blocosAntes = ContadorAlocacoes::blocosVivos;
+    std::vector<std::unique_ptr<T>> produtos;
+    produtos.reserve(registros);
+
+    Cronometro construcao;
+    for (long i = 0; i < registros; i++) {
+        produtos.push_back(std::make_unique<T>(i, "Produto " + std::to_string(i % 10000000),
+                                               categorias[(i * 7) % categorias.size()],
+                                               marcas[(i * 13) % marcas.size()], 10.0, static_cast<int>(i % 50)));
+    }
+    medidas.msConstrucao = construcao.decorridoMs();
+    medidas.bytesPorRegistro = static_cast<double>(ContadorAlocacoes::bytesVivos - bytesAntes) / registros;
+    medidas.blocosPorRegistro = static_cast<double>(ContadorAlocacoes::blocosVivos - blocosAntes) / registros;
+
+    Cronometro agrupamento;
+    conferencia += agrupar(produtos);
+    medidas.msAgrupamento = agrupamento.decorridoMs();
+
+    Cronometro filtro;
+    conferencia += filtrar(produtos);
+    medidas.msFiltro = filtro.decorridoMs();
+    return medidas;
+}
+
+void imprimirLinha(const std::string& versao, const Medidas& medidas) {
+    std::cout << "  " << std::left << std::setw(22) << versao
+              << std::fixed << std::setprecision(1)
+              << std::setw(15) << medidas.bytesPorRegistro
+              << std::setw(15) << medidas.blocosPorRegistro
+              << std::setprecision(0)
+              << std::setw(17) << medidas.msConstrucao
+              << std::setw(18) << medidas.msAgrupamento
+              << medidas.msFiltro << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long registros = lerArgumento(argc, argv, 1, 10000000);
+    const std::vector<std::string> categorias = gerarValores("Categoria", 300);
+    const std::vector<std::string> marcas = gerarValores("Marca", 200);
+
+    std::cout << std::string(100, '=') << std::endl;
+    std::cout << "BENCHMARK: CATEGORIA E MARCA EM std::string POR OBJETO vs TEXTO INTERNADO" << std::endl;
+    std::cout << "Produtos: " << registros << " | Categorias: " << categorias.size() << " | Marcas: " << marcas.size()
+              << " | Cada valor tem " << categorias[0].size() << " bytes" << std::endl;
+    std::cout << "Memória: bytes pedidos ao alocador por produto (objeto + strings), sem o vector de ponteiros" << std::endl;
+    std::cout << "Agrupar: valor do estoque por categoria em um unordered_map | Filtrar: categoria == uma dada" << std::endl;
+    std::cout << std::string(100, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(larguraExibicao("Versão", 22)) << "Versão"
+              << std::setw(15) << "Bytes/reg."
+              << std::setw(15) << "Blocos/reg."
+              << std::setw(larguraExibicao("Construção (ms)", 17)) << "Construção (ms)"
+              << std::setw(18) << "Agrupar (ms)"
+              << "Filtrar (ms)" << std::endl;
+
+    double conferencia = 0.0;
+    const std::string& alvo = categorias[42];
+
+    Medidas antes = medir<ProdutoSemInternar>(registros, categorias, marcas, conferencia,
+        [](const std::vector<std::unique_ptr<ProdutoSemInternar>>& produtos) {
+            std::unordered_map<std::string, double> porCategoria;
+            for (const auto& produto : produtos) {
+                porCategoria[produto->getCategoria()] += produto->calcularValorTotalEstoque();
+            }
+            return porCategoria.begin()->second;
+        },
+        [&alvo](const std::vector<std::unique_ptr<ProdutoSemInternar>>& produtos) {
+            long iguais = 0;
+            for (const auto& produto : produtos) {
+                iguais += produto->getCategoria() == alvo;
+            }
+            return static_cast<double>(iguais);
+        });
+    imprimirLinha("std::string", antes);
+
+    // Interna as categorias antes de medir, como se já estivessem em uso no programa
+    TextoInternado alvoInternado(alvo);
+    long long bytesPool = ContadorAlocacoes::bytesVivos;
+    for (const std::string& valor : categorias) {
+        TextoInternado internado(valor);
+    }
+    for (const std::string& valor : marcas) {
+        TextoInternado internado(valor);
+    }
+    bytesPool = ContadorAlocacoes::bytesVivos - bytesPool;
+
+    Medidas depois = medir<Produto>(registros, categorias, marcas, conferencia,
+        [](const std::vector<std::unique_ptr<Produto>>& produtos) {
+            std::unordered_map<TextoInternado, double> porCategoria;
+            for (const auto& produto : produtos) {
+                porCategoria[produto->getCategoriaInternada()] += produto->calcularValorTotalEstoque();
+            }
+            return porCategoria.begin()->second;
+        },
+        [alvoInternado](const std::vector<std::unique_ptr<Produto>>& produtos) {
+            long iguais = 0;
+            for (const auto& produto : produtos) {
+                iguais += produto->getCategoriaInternada() == alvoInternado;
+            }
+            return static_cast<double>(iguais);
+        });
+    imprimirLinha("TextoInternado", depois);
+
+    std::cout << "\nObjeto: " << sizeof(ProdutoSemInternar) << " -> " << sizeof(Produto) << " bytes"
+              << " | Pool: " << TextoInternado::getQuantidadeInternados() << " textos, ~"
+              << bytesPool / 1024 << " KiB pagos uma vez" << std::endl;
+    std::cout << "Total para " << registros << " produtos: " << std::setprecision(0)
+              << antes.bytesPorRegistro * registros / (1024 * 1024) << " MiB -> "
+              << depois.bytesPorRegistro * registros / (1024 * 1024) << " MiB" << std::endl;
+    std::cout << "Conferência: " << conferencia << std::endl;
+    return 0;
+}
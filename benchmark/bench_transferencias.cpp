@@ -0,0 +1,187 @@
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/PilhaEncadeada.h"
+#include "../src/estruturas_encadeadas/FilaEncadeada.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include "Cronometro.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Preenche a lista com IDs inicio, inicio + passo, inicio + 2 * passo...
+ */
+void preencher(ListaDuplamenteEncadeada& lista, long quantidade, long inicio = 0, long passo = 1) {
+    for (long i = 0; i < quantidade; i++) {
+        lista.inserirNoFim(std::make_unique<Produto>(inicio + i * passo, "Item", "Bench", "Marca", 1.0, 1));
+    }
+}
+
+void imprimirLinha(const std::string& operacao, long elementos, double umAUm, double emBloco) {
+    std::cout << "  " << std::left << std::setw(36) << operacao
+              << std::setw(12) << elementos
+              << std::fixed << std::setprecision(3)
+              << std::setw(16) << umAUm
+              << std::setw(16) << emBloco
+              << std::setprecision(0) << umAUm / emBloco << "x" << std::endl;
+}
+
+/**
+ * @brief Lista inteira de A para B e de volta, elemento a elemento ou em bloco
+ * @return Microssegundos por transferência da lista inteira
+ */
+double medirListaInteira(long elementos, long rodadas, bool emBloco, bool usarPoolNos) {
+    ListaDuplamenteEncadeada a(usarPoolNos), b(usarPoolNos);
+    preencher(a, elementos);
+    Cronometro cronometro;
+    for (long r = 0; r < rodadas; r++) {
+        ListaDuplamenteEncadeada& origem = r % 2 == 0 ? a : b;
+        ListaDuplamenteEncadeada& destino = r % 2 == 0 ? b : a;
+        if (emBloco) {
+            destino.transferirNoFim(origem);
+        } else {
+            while (!origem.estaVazia()) {
+                destino.inserirNoFim(origem.removerPrimeiro());
+            }
+        }
+    }
+    return cronometro.decorridoMs() * 1000.0 / rodadas;
+}
+
+/**
+ * @brief Trecho central (metade dos elementos) de A para o meio de B e de volta
+ * @return Microssegundos por trecho
+ */
+double medirTrecho(long elementos, long rodadas, bool emBloco) {
+    ListaDuplamenteEncadeada a, b;
+    preencher(a, elementos);
+    preencher(b, elementos);
+    int quantidade = static_cast<int>(elementos / 2);
+    Cronometro cronometro;
+    for (long r = 0; r < rodadas; r++) {
+        ListaDuplamenteEncadeada& origem = r % 2 == 0 ? a : b;
+        ListaDuplamenteEncadeada& destino = r % 2 == 0 ? b : a;
+        int inicio = (origem.getTamanho() - quantidade) / 2;
+        int posicao = destino.getTamanho() / 2;
+        if (emBloco) {
+            destino.transferirIntervalo(posicao, origem, inicio, quantidade);
+        } else {
+            for (int i = 0; i < quantidade; i++) {
+                destino.inserirNaPosicao(posicao + i, origem.removerDaPosicao(inicio));
+            }
+        }
+    }
+    return cronometro.decorridoMs() * 1000.0 / rodadas;
+}
+
+/**
+ * @brief Esvazia uma fila em uma pilha e a pilha em outra fila, e assim por diante
+ * @return Microssegundos por esvaziamento
+ */
+double medirFilaPilha(long elementos, long rodadas, bool emBloco) {
+    FilaEncadeada fila;
+    PilhaEncadeada pilha;
+    for (long i = 0; i < elementos; i++) {
+        fila.enfileirar(std::make_unique<Produto>(i, "Item", "Bench", "Marca", 1.0, 1));
+    }
+    Cronometro cronometro;
+    for (long r = 0; r < rodadas; r++) {
+        if (r % 2 == 0) {
+            if (emBloco) {
+                pilha.empilharTudo(fila);
+            } else {
+                while (!fila.estaVazia()) {
+                    pilha.empilhar(fila.desenfileirar());
+                }
+            }
+        } else {
+            if (emBloco) {
+                fila.enfileirarTudo(pilha);
+            } else {
+                while (!pilha.estaVazia()) {
+                    fila.enfileirar(pilha.desempilhar());
+                }
+            }
+        }
+    }
+    return cronometro.decorridoMs() * 1000.0 / rodadas;
+}
+
+/**
+ * @brief Mescla duas listas ordenadas (pares e ímpares) em uma
+ * @param emBloco Se true, mesclarOrdenadoPorId; senão copia para um vector,
+ *                ordena com std::sort e reinsere na lista
+ * @return Microssegundos por mescla (a construção das listas não é medida)
+ */
+double medirMescla(long elementos, long rodadas, bool emBloco) {
+    double total = 0.0;
+    for (long r = 0; r < rodadas; r++) {
+        ListaDuplamenteEncadeada pares, impares;
+        preencher(pares, elementos / 2, 0, 2);
+        preencher(impares, elementos / 2, 1, 2);
+        Cronometro cronometro;
+        if (emBloco) {
+            pares.mesclarOrdenadoPorId(impares);
+        } else {
+            std::vector<std::unique_ptr<Elemento>> elementosMesclados;
+            elementosMesclados.reserve(elementos);
+            while (!pares.estaVazia()) {
+                elementosMesclados.push_back(pares.removerPrimeiro());
+            }
+            while (!impares.estaVazia()) {
+                elementosMesclados.push_back(impares.removerPrimeiro());
+            }
+            std::sort(elementosMesclados.begin(), elementosMesclados.end(),
+                      [](const std::unique_ptr<Elemento>& a, const std::unique_ptr<Elemento>& b) {
+                          return a->getID() < b->getID();
+                      });
+            for (auto& elemento : elementosMesclados) {
+                pares.inserirNoFim(std::move(elemento));
+            }
+        }
+        total += cronometro.decorridoMs();
+    }
+    return total * 1000.0 / rodadas;
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long movimentos = lerArgumento(argc, argv, 1, 10000000);
+    const long tamanhos[] = {1000, 100000, 1000000};
+
+    std::cout << std::string(92, '=') << std::endl;
+    std::cout << "BENCHMARK: TRANSFERÊNCIAS EM BLOCO (SPLICE) vs ELEMENTO A ELEMENTO (µs por operação)" << std::endl;
+    std::cout << "Elementos movidos um a um por cenário: ~" << movimentos << std::endl;
+    std::cout << std::string(92, '=') << std::endl;
+    std::cout << "  " << std::left << std::setw(larguraExibicao("Operação", 36)) << "Operação"
+              << std::setw(12) << "Elementos"
+              << std::setw(16) << "Um a um"
+              << std::setw(16) << "Em bloco"
+              << "Ganho" << std::endl;
+
+    for (long elementos : tamanhos) {
+        long rodadas = std::max(4L, movimentos / elementos);
+        imprimirLinha("Lista inteira (sem pool)", elementos,
+                      medirListaInteira(elementos, rodadas, false, false),
+                      medirListaInteira(elementos, rodadas * 100, true, false));
+        imprimirLinha("Lista inteira (com pools)", elementos,
+                      medirListaInteira(elementos, rodadas, false, true),
+                      medirListaInteira(elementos, rodadas, true, true));
+        imprimirLinha("Trecho central (n/2)", elementos,
+                      medirTrecho(elementos, rodadas, false),
+                      medirTrecho(elementos, rodadas, true));
+        imprimirLinha("Fila <-> Pilha", elementos,
+                      medirFilaPilha(elementos, rodadas, false),
+                      medirFilaPilha(elementos, rodadas * 100, true));
+        imprimirLinha("Mescla ordenada vs vector + sort", elementos,
+                      medirMescla(elementos, std::min(rodadas, 20L), false),
+                      medirMescla(elementos, std::min(rodadas, 20L), true));
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
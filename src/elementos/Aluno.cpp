@@ -11,13 +11,13 @@
  * @param nota
  */
 Aluno::Aluno(long id, const std::string& nome, const std::string& curso, double nota)
-    : Elemento(id), nome(nome), curso(curso), nota(nota) {}
+    : Elemento(id), nome(nome), curso(TextoInternado(curso)), nota(nota) {}
 
 /**
  * @brief Obtém o nome do aluno
  * @return Nome completo do aluno
  */
-std::string Aluno::getNome() const {
+const std::string& Aluno::getNome() const {
     return nome;
 }
 
@@ -25,7 +25,15 @@ std::string Aluno::getNome() const {
  * @brief Obtém o curso do aluno
  * @return Curso em que está matriculado
  */
-std::string Aluno::getCurso() const {
+const std::string& Aluno::getCurso() const {
+    return curso.getTexto();
+}
+
+/**
+ * @brief Obtém o curso como referência ao pool de textos
+ * @return Curso internado
+ */
+TextoInternado Aluno::getCursoInternado() const {
     return curso;
 }
 
@@ -56,7 +64,7 @@ void Aluno::imprimirInfo() const {
     std::cout << "=== INFORMAÇÕES DO ALUNO ===" << std::endl;
     std::cout << "Matrícula: " << ID << std::endl;
     std::cout << "Nome: " << nome << std::endl;
-    std::cout << "Curso: " << curso << std::endl;
+    std::cout << "Curso: " << curso.getTexto() << std::endl;
     std::cout << "Nota: " << std::fixed << std::setprecision(2) << nota << std::endl;
     std::cout << "============================" << std::endl;
 }
@@ -2,17 +2,22 @@
 #define ALUNO_H
 
 #include "Elemento.h"
+#include "GanchoLista.h"
+#include "TextoInternado.h"
 #include <string>
 
 /**
  * @brief Classe que representa um aluno, derivada de Elemento
  * Implementa a herança da classe abstrata Elemento,
  * demonstrando polimorfismo ao implementar o método virtual puro.
+ * 
+ * Herda também GanchoLista, podendo ser encadeado em uma
+ * ListaIntrusiva sem alocação de nós.
  */
-class Aluno : public Elemento {
+class Aluno : public Elemento, public GanchoLista {
 private:
     std::string nome;
-    std::string curso;
+    TextoInternado curso;   // Poucos valores distintos: guardado no pool de textos
     double nota;
 
 public:
@@ -30,15 +35,21 @@ public:
 
     /**
      * @brief Obtém o nome do aluno
-     * @return Nome completo do aluno
+     * @return Nome completo do aluno (referência, sem cópia; válida enquanto o aluno existir)
      */
-    std::string getNome() const;
+    const std::string& getNome() const;
 
     /**
      * @brief Obtém o curso do aluno
-     * @return Curso em que está matriculado
+     * @return Curso em que está matriculado (referência ao pool de textos, sem cópia)
      */
-    std::string getCurso() const;
+    const std::string& getCurso() const;
+
+    /**
+     * @brief Obtém o curso como referência ao pool de textos
+     * @return Curso internado (comparação e hash O(1))
+     */
+    TextoInternado getCursoInternado() const;
 
     /**
      * @brief Obtém a nota do aluno
@@ -10,17 +10,6 @@ Elemento::Elemento(long id) : ID(id) {
     // Construtor implementa inicialização simples do ID
 }
 
-/**
- * @brief Obtém o ID do elemento
- * @return O identificador único do elemento
- * 
- * Método const que garante que o objeto não será modificado
- * durante a consulta, implementando boas práticas de encapsulamento.
- */
-long Elemento::getID() const {
-    return ID;
-}
-
 /**
  * @brief Operador de comparação para ordenação por ID
  * @param outro Elemento a ser comparado
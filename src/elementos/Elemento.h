@@ -35,9 +35,12 @@ public:
      * @return O identificador único do elemento
      * 
      * Método público const que permite acesso controlado ao ID,
-     * implementando encapsulamento.
+     * implementando encapsulamento. Definido no cabeçalho e não virtual:
+     * as buscas das estruturas o chamam a cada comparação, e assim ele
+     * vira uma leitura direta do campo, sem chamada para outra unidade
+     * de compilação (não depende de LTO).
      */
-    long getID() const;
+    long getID() const { return ID; }
 
     /**
      * @brief Imprime as informações do elemento
@@ -61,6 +64,26 @@ public:
      * @return true se os IDs são iguais
      */
     virtual bool operator==(const Elemento& outro) const;
+
+    /**
+     * @brief Compara dois elementos pelo ID, sem despacho virtual
+     * @return true se a tem ID menor que b
+     *
+     * Caminho usado pelas estruturas internamente: os operadores acima
+     * são virtuais e uma classe derivada pode redefini-los, então o
+     * compilador não consegue expandi-los no laço de busca.
+     *
+     * Complexidade: O(1)
+     */
+    static bool menorId(const Elemento& a, const Elemento& b) { return a.ID < b.ID; }
+
+    /**
+     * @brief Igualdade de IDs sem despacho virtual
+     * @return true se a e b têm o mesmo ID
+     *
+     * Complexidade: O(1)
+     */
+    static bool mesmoId(const Elemento& a, const Elemento& b) { return a.ID == b.ID; }
 };
 
 #endif
@@ -0,0 +1,29 @@
+#include "ElementoValor.h"
+
+std::optional<ElementoValor> ElementoValor::copiarDe(const Elemento& elemento) {
+    if (const Aluno* aluno = dynamic_cast<const Aluno*>(&elemento)) {
+        return ElementoValor(*aluno);
+    }
+    if (const Funcionario* funcionario = dynamic_cast<const Funcionario*>(&elemento)) {
+        return ElementoValor(*funcionario);
+    }
+    if (const Produto* produto = dynamic_cast<const Produto*>(&elemento)) {
+        return ElementoValor(*produto);
+    }
+    return std::nullopt;
+}
+
+std::unique_ptr<Elemento> ElementoValor::paraElemento() const {
+    return std::visit([](const auto& objeto) -> std::unique_ptr<Elemento> {
+        using Tipo = std::decay_t<decltype(objeto)>;
+        return std::make_unique<Tipo>(objeto);
+    }, valor);
+}
+
+void ElementoValor::imprimirInfo() const {
+    std::visit([](const auto& objeto) {
+        // Chamada qualificada: o tipo é conhecido, não passa pela vtable
+        using Tipo = std::decay_t<decltype(objeto)>;
+        objeto.Tipo::imprimirInfo();
+    }, valor);
+}
@@ -0,0 +1,135 @@
+#ifndef ELEMENTO_VALOR_H
+#define ELEMENTO_VALOR_H
+
+#include "Elemento.h"
+#include "Aluno.h"
+#include "Funcionario.h"
+#include "Produto.h"
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+/**
+ * @brief Elemento guardado por valor: um Aluno, Funcionario ou Produto
+ *
+ * Alternativa ao std::unique_ptr<Elemento> para quando o tipo do
+ * elemento é um dos três da hierarquia (um conjunto fechado). O objeto
+ * fica dentro do próprio ElementoValor, em um std::variant, então um
+ * vetor de ElementoValor guarda os elementos contíguos, sem uma
+ * alocação por elemento e sem seguir um ponteiro a cada acesso.
+ *
+ * As operações usam std::visit: o tipo concreto sai do índice do
+ * variant e o método é chamado sem despacho virtual (imprimirInfo é
+ * chamado qualificado com a classe concreta).
+ *
+ * O objeto ocupa o tamanho do maior dos três (Produto) mais o índice,
+ * qualquer que seja o tipo guardado. Uma nova classe derivada de
+ * Elemento só cabe aqui se for acrescentada ao variant.
+ */
+class ElementoValor {
+public:
+    typedef std::variant<Aluno, Funcionario, Produto> Variante;
+
+private:
+    Variante valor;
+
+public:
+    /**
+     * @brief Guarda uma cópia do objeto (conversões implícitas de propósito:
+     * um Aluno, Funcionario ou Produto pode ser passado onde se espera um ElementoValor)
+     */
+    ElementoValor(const Aluno& aluno) : valor(aluno) {}
+    ElementoValor(const Funcionario& funcionario) : valor(funcionario) {}
+    ElementoValor(const Produto& produto) : valor(produto) {}
+
+    /**
+     * @brief Constrói o objeto direto no lugar, sem cópia
+     *
+     * Exemplo: ElementoValor(std::in_place_type<Aluno>, id, nome, curso, nota)
+     */
+    template<typename Tipo, typename... Argumentos>
+    explicit ElementoValor(std::in_place_type_t<Tipo> tipo, Argumentos&&... argumentos)
+        : valor(tipo, std::forward<Argumentos>(argumentos)...) {}
+
+    /**
+     * @brief Copia um elemento da hierarquia para um ElementoValor
+     * @return Cópia, ou vazio se o tipo não é Aluno, Funcionario nem Produto
+     *
+     * Complexidade: O(1) - um dynamic_cast por tipo candidato e a cópia
+     */
+    static std::optional<ElementoValor> copiarDe(const Elemento& elemento);
+
+    /**
+     * @brief Cria no heap uma cópia do objeto, para as estruturas de unique_ptr<Elemento>
+     */
+    std::unique_ptr<Elemento> paraElemento() const;
+
+    /**
+     * @brief ID do objeto guardado
+     *
+     * Complexidade: O(1) - todos os tipos têm o ID na base Elemento
+     */
+    long getID() const {
+        return std::visit([](const Elemento& elemento) { return elemento.getID(); }, valor);
+    }
+
+    /**
+     * @brief Imprime as informações do objeto guardado, sem chamada virtual
+     */
+    void imprimirInfo() const;
+
+    /**
+     * @brief Acesso ao objeto pela interface comum
+     */
+    const Elemento& comoElemento() const {
+        return std::visit([](const Elemento& elemento) -> const Elemento& { return elemento; }, valor);
+    }
+
+    Elemento& comoElemento() {
+        return std::visit([](Elemento& elemento) -> Elemento& { return elemento; }, valor);
+    }
+
+    /**
+     * @brief Verifica o tipo guardado
+     * @return true se o objeto é um Tipo (Aluno, Funcionario ou Produto)
+     */
+    template<typename Tipo>
+    bool guarda() const { return std::holds_alternative<Tipo>(valor); }
+
+    /**
+     * @brief Objeto como o tipo concreto
+     * @return Ponteiro para o objeto, ou nullptr se ele é de outro tipo
+     */
+    template<typename Tipo>
+    const Tipo* como() const { return std::get_if<Tipo>(&valor); }
+
+    template<typename Tipo>
+    Tipo* como() { return std::get_if<Tipo>(&valor); }
+
+    /**
+     * @brief Chama visitante(objeto) com o tipo concreto (um Aluno&, Funcionario& ou Produto&)
+     * @return O que o visitante devolver
+     */
+    template<typename Visitante>
+    decltype(auto) visitar(Visitante&& visitante) const {
+        return std::visit(std::forward<Visitante>(visitante), valor);
+    }
+
+    template<typename Visitante>
+    decltype(auto) visitar(Visitante&& visitante) {
+        return std::visit(std::forward<Visitante>(visitante), valor);
+    }
+
+    /**
+     * @brief Compara dois elementos pelo ID (mesma regra de Elemento::menorId)
+     */
+    static bool menorId(const ElementoValor& a, const ElementoValor& b) { return a.getID() < b.getID(); }
+};
+
+// Sem isto, um std::vector<ElementoValor> copiaria (e alocaria) cada nome ao crescer
+static_assert(std::is_nothrow_move_constructible<ElementoValor>::value,
+              "ElementoValor precisa ser movido sem exceção");
+
+#endif
@@ -14,14 +14,14 @@
  */
 Funcionario::Funcionario(long id, const std::string& nome, const std::string& cargo,
                          const std::string& departamento, double salario)
-    : Elemento(id), nome(nome), cargo(cargo), departamento(departamento), salario(salario) {
+    : Elemento(id), nome(nome), cargo(TextoInternado(cargo)), departamento(TextoInternado(departamento)), salario(salario) {
 }
 
 /**
  * @brief Obtém o nome do funcionário
  * @return Nome completo do funcionário
  */
-std::string Funcionario::getNome() const {
+const std::string& Funcionario::getNome() const {
     return nome;
 }
 
@@ -29,15 +29,31 @@ std::string Funcionario::getNome() const {
  * @brief Obtém o cargo do funcionário
  * @return Cargo ocupado pelo funcionário
  */
-std::string Funcionario::getCargo() const {
-    return cargo;
+const std::string& Funcionario::getCargo() const {
+    return cargo.getTexto();
 }
 
 /**
  * @brief Obtém o departamento do funcionário
  * @return Departamento onde trabalha
  */
-std::string Funcionario::getDepartamento() const {
+const std::string& Funcionario::getDepartamento() const {
+    return departamento.getTexto();
+}
+
+/**
+ * @brief Obtém o cargo como referência ao pool de textos
+ * @return Cargo internado
+ */
+TextoInternado Funcionario::getCargoInternado() const {
+    return cargo;
+}
+
+/**
+ * @brief Obtém o departamento como referência ao pool de textos
+ * @return Departamento internado
+ */
+TextoInternado Funcionario::getDepartamentoInternado() const {
     return departamento;
 }
 
@@ -62,7 +78,7 @@ void Funcionario::setSalario(double novoSalario) {
  * @param novoCargo Novo cargo a ser atribuído
  */
 void Funcionario::setCargo(const std::string& novoCargo) {
-    cargo = novoCargo;
+    cargo = TextoInternado(novoCargo);
 }
 
 /**
@@ -76,8 +92,8 @@ void Funcionario::imprimirInfo() const {
     std::cout << "=== INFORMAÇÕES DO FUNCIONÁRIO ===" << std::endl;
     std::cout << "ID: " << ID << std::endl;
     std::cout << "Nome: " << nome << std::endl;
-    std::cout << "Cargo: " << cargo << std::endl;
-    std::cout << "Departamento: " << departamento << std::endl;
+    std::cout << "Cargo: " << cargo.getTexto() << std::endl;
+    std::cout << "Departamento: " << departamento.getTexto() << std::endl;
     std::cout << "Salário: R$ " << std::fixed << std::setprecision(2) << salario << std::endl;
     std::cout << "==================================" << std::endl;
 }
@@ -2,6 +2,8 @@
 #define FUNCIONARIO_H
 
 #include "Elemento.h"
+#include "GanchoLista.h"
+#include "TextoInternado.h"
 #include <string>
 
 /**
@@ -10,12 +12,15 @@
  * Segunda implementação da herança da classe abstrata Elemento,
  * demonstrando como diferentes classes podem implementar
  * o mesmo contrato (interface) de formas distintas.
+ * 
+ * Herda também GanchoLista, podendo ser encadeado em uma
+ * ListaIntrusiva sem alocação de nós.
  */
-class Funcionario : public Elemento {
+class Funcionario : public Elemento, public GanchoLista {
 private:
     std::string nome;
-    std::string cargo;
-    std::string departamento;
+    TextoInternado cargo;          // Cargo e departamento se repetem entre
+    TextoInternado departamento;   // muitos funcionários: guardados no pool de textos
     double salario;
 
 public:
@@ -32,21 +37,33 @@ public:
 
     /**
      * @brief Obtém o nome do funcionário
-     * @return Nome completo do funcionário
+     * @return Nome completo do funcionário (referência, sem cópia; válida enquanto o funcionário existir)
      */
-    std::string getNome() const;
+    const std::string& getNome() const;
 
     /**
      * @brief Obtém o cargo do funcionário
-     * @return Cargo ocupado pelo funcionário
+     * @return Cargo ocupado pelo funcionário (referência ao pool de textos, sem cópia)
      */
-    std::string getCargo() const;
+    const std::string& getCargo() const;
 
     /**
      * @brief Obtém o departamento do funcionário
-     * @return Departamento onde trabalha
+     * @return Departamento onde trabalha (referência ao pool de textos, sem cópia)
+     */
+    const std::string& getDepartamento() const;
+
+    /**
+     * @brief Obtém o cargo como referência ao pool de textos
+     * @return Cargo internado (comparação e hash O(1))
+     */
+    TextoInternado getCargoInternado() const;
+
+    /**
+     * @brief Obtém o departamento como referência ao pool de textos
+     * @return Departamento internado (comparação e hash O(1))
      */
-    std::string getDepartamento() const;
+    TextoInternado getDepartamentoInternado() const;
 
     /**
      * @brief Obtém o salário do funcionário
@@ -0,0 +1,46 @@
+#ifndef GANCHO_LISTA_H
+#define GANCHO_LISTA_H
+
+template<typename T> class ListaIntrusiva;
+
+/**
+ * @brief Gancho (hook) para listas intrusivas
+ *
+ * Classe base auxiliar que embute no próprio objeto os ponteiros de
+ * encadeamento usados por ListaIntrusiva. Uma classe derivada de
+ * Elemento que também herda de GanchoLista pode ser encadeada sem
+ * que a lista aloque um nó separado para ela.
+ *
+ * Os ponteiros são privados: só a ListaIntrusiva os manipula.
+ * Copiar um objeto não copia o encadeamento - a cópia nasce fora
+ * de qualquer lista.
+ *
+ * O gancho também guarda a lista dona, para que uma lista recuse
+ * elementos encadeados em outra (remover(T*) com um elemento alheio
+ * desfaria o encadeamento da outra lista e corromperia as duas).
+ */
+class GanchoLista {
+private:
+    template<typename T> friend class ListaIntrusiva;
+
+    GanchoLista* anteriorGancho;    // Elemento anterior (nullptr se fora de lista)
+    GanchoLista* proximoGancho;     // Próximo elemento (nullptr se fora de lista)
+    const void* donoGancho;         // ListaIntrusiva que contém o elemento (nullptr se fora de lista)
+
+protected:
+    GanchoLista() : anteriorGancho(nullptr), proximoGancho(nullptr), donoGancho(nullptr) {}
+    GanchoLista(const GanchoLista&) noexcept : anteriorGancho(nullptr), proximoGancho(nullptr), donoGancho(nullptr) {}
+    GanchoLista& operator=(const GanchoLista&) noexcept { return *this; }
+    ~GanchoLista() = default;
+
+public:
+    /**
+     * @brief Verifica se o objeto está encadeado em alguma lista intrusiva
+     * @return true se o objeto pertence a uma lista
+     *
+     * Complexidade: O(1)
+     */
+    bool estaEncadeado() const { return donoGancho != nullptr; }
+};
+
+#endif
@@ -15,7 +15,7 @@
  */
 Produto::Produto(long id, const std::string& nome, const std::string& categoria,
                  const std::string& marca, double preco, int quantidadeEstoque)
-    : Elemento(id), nome(nome), categoria(categoria), marca(marca), 
+    : Elemento(id), nome(nome), categoria(TextoInternado(categoria)), marca(TextoInternado(marca)), 
       preco(preco), quantidadeEstoque(quantidadeEstoque) {
     // Chama o construtor da classe base e inicializa atributos específicos
 }
@@ -24,7 +24,7 @@ Produto::Produto(long id, const std::string& nome, const std::string& categoria,
  * @brief Obtém o nome do produto
  * @return Nome do produto
  */
-std::string Produto::getNome() const {
+const std::string& Produto::getNome() const {
     return nome;
 }
 
@@ -32,15 +32,31 @@ std::string Produto::getNome() const {
  * @brief Obtém a categoria do produto
  * @return Categoria do produto
  */
-std::string Produto::getCategoria() const {
-    return categoria;
+const std::string& Produto::getCategoria() const {
+    return categoria.getTexto();
 }
 
 /**
  * @brief Obtém a marca do produto
  * @return Marca do produto
  */
-std::string Produto::getMarca() const {
+const std::string& Produto::getMarca() const {
+    return marca.getTexto();
+}
+
+/**
+ * @brief Obtém a categoria como referência ao pool de textos
+ * @return Categoria internada
+ */
+TextoInternado Produto::getCategoriaInternada() const {
+    return categoria;
+}
+
+/**
+ * @brief Obtém a marca como referência ao pool de textos
+ * @return Marca internada
+ */
+TextoInternado Produto::getMarcaInternada() const {
     return marca;
 }
 
@@ -129,8 +145,8 @@ void Produto::imprimirInfo() const {
     std::cout << "=== INFORMAÇÕES DO PRODUTO ===" << std::endl;
     std::cout << "Código: " << ID << std::endl;
     std::cout << "Nome: " << nome << std::endl;
-    std::cout << "Marca: " << marca << std::endl;
-    std::cout << "Categoria: " << categoria << std::endl;
+    std::cout << "Marca: " << marca.getTexto() << std::endl;
+    std::cout << "Categoria: " << categoria.getTexto() << std::endl;
     std::cout << "Preço: R$ " << std::fixed << std::setprecision(2) << preco << std::endl;
     std::cout << "Estoque: " << quantidadeEstoque << " unidade(s)" << std::endl;
     std::cout << "Valor Total: R$ " << std::fixed << std::setprecision(2) << calcularValorTotalEstoque() << std::endl;
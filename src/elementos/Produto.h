@@ -2,6 +2,8 @@
 #define PRODUTO_H
 
 #include "Elemento.h"
+#include "GanchoLista.h"
+#include "TextoInternado.h"
 #include <string>
 
 /**
@@ -10,12 +12,15 @@
  * Terceira implementação da herança da classe abstrata Elemento,
  * demonstrando a flexibilidade da hierarquia para diferentes
  * tipos de entidades do mundo real.
+ * 
+ * Herda também GanchoLista, podendo ser encadeado em uma
+ * ListaIntrusiva sem alocação de nós.
  */
-class Produto : public Elemento {
+class Produto : public Elemento, public GanchoLista {
 private:
     std::string nome;
-    std::string categoria;
-    std::string marca;
+    TextoInternado categoria;   // Categoria e marca se repetem entre
+    TextoInternado marca;       // muitos produtos: guardadas no pool de textos
     double preco;
     int quantidadeEstoque;
 
@@ -34,21 +39,33 @@ public:
 
     /**
      * @brief Obtém o nome do produto
-     * @return Nome do produto
+     * @return Nome do produto (referência, sem cópia; válida enquanto o produto existir)
      */
-    std::string getNome() const;
+    const std::string& getNome() const;
 
     /**
      * @brief Obtém a categoria do produto
-     * @return Categoria do produto
+     * @return Categoria do produto (referência ao pool de textos, sem cópia)
      */
-    std::string getCategoria() const;
+    const std::string& getCategoria() const;
 
     /**
      * @brief Obtém a marca do produto
-     * @return Marca do produto
+     * @return Marca do produto (referência ao pool de textos, sem cópia)
+     */
+    const std::string& getMarca() const;
+
+    /**
+     * @brief Obtém a categoria como referência ao pool de textos
+     * @return Categoria internada (comparação e hash O(1))
+     */
+    TextoInternado getCategoriaInternada() const;
+
+    /**
+     * @brief Obtém a marca como referência ao pool de textos
+     * @return Marca internada (comparação e hash O(1))
      */
-    std::string getMarca() const;
+    TextoInternado getMarcaInternada() const;
 
     /**
      * @brief Obtém o preço do produto
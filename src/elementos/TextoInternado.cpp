@@ -0,0 +1,63 @@
+#include "TextoInternado.h"
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace {
+    /**
+     * @brief Pool global de textos
+     *
+     * Os textos ficam em um deque, que não move os já inseridos: os
+     * ponteiros dos TextoInternado e as chaves string_view do mapa
+     * continuam válidos para sempre.
+     */
+    struct PoolTextos {
+        std::shared_mutex trava;
+        std::deque<std::string> textos;
+        std::unordered_map<std::string_view, const std::string*> indice;
+        std::size_t bytes = 0;
+
+        const std::string* internar(std::string_view texto) {
+            {
+                std::shared_lock<std::shared_mutex> leitura(trava);
+                auto it = indice.find(texto);
+                if (it != indice.end()) {
+                    return it->second;
+                }
+            }
+            std::unique_lock<std::shared_mutex> escrita(trava);
+            // Outra thread pode ter inserido o mesmo texto entre as duas travas
+            auto it = indice.find(texto);
+            if (it != indice.end()) {
+                return it->second;
+            }
+            textos.emplace_back(texto);
+            const std::string* novo = &textos.back();
+            indice.emplace(std::string_view(*novo), novo);
+            bytes += novo->size();
+            return novo;
+        }
+    };
+
+    PoolTextos& pool() {
+        static PoolTextos instancia;
+        return instancia;
+    }
+}
+
+TextoInternado::TextoInternado() : texto(pool().internar(std::string_view())) {
+}
+
+TextoInternado::TextoInternado(std::string_view texto) : texto(pool().internar(texto)) {
+}
+
+std::size_t TextoInternado::getQuantidadeInternados() {
+    std::shared_lock<std::shared_mutex> leitura(pool().trava);
+    return pool().textos.size();
+}
+
+std::size_t TextoInternado::getBytesInternados() {
+    std::shared_lock<std::shared_mutex> leitura(pool().trava);
+    return pool().bytes;
+}
@@ -0,0 +1,76 @@
+#ifndef TEXTO_INTERNADO_H
+#define TEXTO_INTERNADO_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Referência a um texto guardado uma única vez em um pool global
+ *
+ * Usado nos campos que se repetem entre milhões de objetos com poucas
+ * centenas de valores distintos: curso (Aluno), cargo e departamento
+ * (Funcionario), categoria e marca (Produto). Cada texto distinto é
+ * copiado uma vez para o pool e todo objeto com esse valor guarda só um
+ * ponteiro (8 bytes, contra 32 de um std::string mais a alocação de
+ * textos longos).
+ *
+ * Dois TextoInternado são iguais se e somente se apontam para a mesma
+ * entrada do pool, então comparar e calcular o hash é O(1), sem olhar
+ * os caracteres. A ordem (operator<) é a dos textos.
+ *
+ * Os textos nunca saem do pool, até o fim do programa: por isso o pool
+ * serve para valores de baixa cardinalidade, não para nomes ou textos
+ * livres. Internar é seguro entre threads (leituras compartilhadas, um
+ * escritor por vez quando o texto é novo).
+ */
+class TextoInternado {
+private:
+    const std::string* texto;   // Entrada do pool (nunca nulo)
+
+public:
+    /**
+     * @brief Texto vazio
+     */
+    TextoInternado();
+
+    /**
+     * @brief Procura o texto no pool e o acrescenta se ainda não existe
+     *
+     * Complexidade: O(tamanho do texto) - um hash e, na primeira vez, uma cópia
+     */
+    explicit TextoInternado(std::string_view texto);
+
+    const std::string& getTexto() const { return *texto; }
+
+    bool operator==(const TextoInternado& outro) const { return texto == outro.texto; }
+    bool operator!=(const TextoInternado& outro) const { return texto != outro.texto; }
+    bool operator<(const TextoInternado& outro) const { return *texto < *outro.texto; }
+
+    /**
+     * @brief Hash do endereço da entrada, O(1)
+     */
+    std::size_t hash() const { return std::hash<const std::string*>()(texto); }
+
+    /**
+     * @brief Número de textos distintos no pool
+     */
+    static std::size_t getQuantidadeInternados();
+
+    /**
+     * @brief Bytes ocupados pelos caracteres dos textos do pool (sem as estruturas de busca)
+     */
+    static std::size_t getBytesInternados();
+};
+
+namespace std {
+    template<>
+    struct hash<TextoInternado> {
+        std::size_t operator()(const TextoInternado& texto) const {
+            return texto.hash();
+        }
+    };
+}
+
+#endif
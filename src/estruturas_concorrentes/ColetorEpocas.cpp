@@ -0,0 +1,85 @@
+#include "ColetorEpocas.h"
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+    // Registro global de identificadores de thread
+    std::mutex mutexIds;
+    bool idsEmUso[ColetorEpocas::MAX_THREADS] = {};
+    std::atomic<int> idsRegistrados(0);  // Maior identificador já usado + 1
+
+    struct IdThread {
+        int id;
+
+        IdThread() : id(-1) {
+            std::lock_guard<std::mutex> trava(mutexIds);
+            for (int i = 0; i < ColetorEpocas::MAX_THREADS; i++) {
+                if (!idsEmUso[i]) {
+                    idsEmUso[i] = true;
+                    id = i;
+                    break;
+                }
+            }
+            if (id < 0) {
+                throw std::runtime_error("Limite de threads do coletor de épocas atingido");
+            }
+            if (id >= idsRegistrados.load(std::memory_order_relaxed)) {
+                idsRegistrados.store(id + 1, std::memory_order_release);
+            }
+        }
+
+        ~IdThread() {
+            std::lock_guard<std::mutex> trava(mutexIds);
+            idsEmUso[id] = false;
+        }
+    };
+}
+
+ColetorEpocas::ColetorEpocas() : epocaGlobal(0) {
+    for (int i = 0; i < MAX_THREADS; i++) {
+        anuncios[i].valor.store(0, std::memory_order_relaxed);
+    }
+}
+
+int ColetorEpocas::idThreadAtual() {
+    thread_local IdThread idThread;
+    return idThread.id;
+}
+
+void ColetorEpocas::entrar(int id) {
+    std::uint64_t epoca = epocaGlobal.load(std::memory_order_relaxed);
+    // Par com a barreira de tentarAvancar: ou o anúncio é visto, ou as
+    // leituras seguintes desta thread já enxergam o que foi desligado antes
+#if defined(__x86_64__) || defined(__i386__)
+    // No x86 uma troca atômica (instrução com lock) já é barreira completa
+    // e custa bem menos que mfence
+    anuncios[id].valor.exchange((epoca << 1) | 1, std::memory_order_seq_cst);
+#else
+    anuncios[id].valor.store((epoca << 1) | 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+void ColetorEpocas::sair(int id) {
+    anuncios[id].valor.store(0, std::memory_order_release);
+}
+
+std::uint64_t ColetorEpocas::epocaAtual() const {
+    return epocaGlobal.load(std::memory_order_acquire);
+}
+
+bool ColetorEpocas::tentarAvancar() {
+    std::uint64_t epoca = epocaGlobal.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    int registrados = idsRegistrados.load(std::memory_order_acquire);
+    for (int i = 0; i < registrados; i++) {
+        std::uint64_t anuncio = anuncios[i].valor.load(std::memory_order_relaxed);
+        if ((anuncio & 1) && (anuncio >> 1) != epoca) {
+            return false;  // Thread ainda dentro de uma Guarda de época anterior
+        }
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return epocaGlobal.compare_exchange_strong(epoca, epoca + 1, std::memory_order_acq_rel);
+}
@@ -0,0 +1,105 @@
+#ifndef COLETOR_EPOCAS_H
+#define COLETOR_EPOCAS_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Recuperação de memória baseada em épocas para estruturas sem travas
+ *
+ * Uma estrutura concorrente não pode liberar um nó assim que o retira,
+ * pois outra thread pode ter lido o ponteiro antes e ainda estar usando o
+ * nó. Com o coletor, toda operação que lê ponteiros compartilhados ocorre
+ * dentro de uma Guarda, que anuncia a época global vista pela thread.
+ *
+ * A época global só avança quando todas as threads dentro de uma Guarda já
+ * anunciaram a época atual. Assim, um nó aposentado na época e só pode ser
+ * liberado (ou reutilizado) quando a época global chega a e + 2: nesse
+ * ponto nenhuma thread que o tenha visto continua dentro de uma Guarda.
+ *
+ * O coletor só controla as épocas; cada estrutura guarda sua própria lista
+ * de nós aposentados por thread (indexada por idThreadAtual()).
+ */
+class ColetorEpocas {
+public:
+    static const int MAX_THREADS = 128;  // Threads usando o coletor ao mesmo tempo
+
+    /**
+     * @brief Mantém a thread anunciada na época atual durante seu escopo
+     */
+    class Guarda {
+    private:
+        ColetorEpocas& coletor;
+        int id;
+
+    public:
+        Guarda(ColetorEpocas& coletor, int id) : coletor(coletor), id(id) { coletor.entrar(id); }
+        ~Guarda() { coletor.sair(id); }
+        Guarda(const Guarda&) = delete;
+        Guarda& operator=(const Guarda&) = delete;
+    };
+
+    ColetorEpocas();
+
+    ColetorEpocas(const ColetorEpocas& outro) = delete;
+    ColetorEpocas& operator=(const ColetorEpocas& outro) = delete;
+
+    /**
+     * @brief Identificador da thread atual, em [0, MAX_THREADS)
+     *
+     * Atribuído no primeiro uso e devolvido quando a thread termina, para
+     * ser reaproveitado por outra thread.
+     *
+     * Complexidade: O(1) após o primeiro uso
+     */
+    static int idThreadAtual();
+
+    /**
+     * @brief Anuncia que a thread 'id' vai ler ponteiros compartilhados
+     *
+     * Complexidade: O(1)
+     */
+    void entrar(int id);
+
+    /**
+     * @brief Anuncia que a thread 'id' não guarda mais ponteiros compartilhados
+     *
+     * Complexidade: O(1)
+     */
+    void sair(int id);
+
+    /**
+     * @brief Época global atual (usada para marcar nós aposentados)
+     *
+     * Complexidade: O(1)
+     */
+    std::uint64_t epocaAtual() const;
+
+    /**
+     * @brief Tenta avançar a época global
+     * @return true se a época avançou
+     *
+     * Complexidade: O(t) - verifica o anúncio de cada thread registrada
+     */
+    bool tentarAvancar();
+
+    /**
+     * @brief Indica se um nó aposentado em 'epocaAposentadoria' já pode ser liberado
+     *
+     * Complexidade: O(1)
+     */
+    bool podeLiberar(std::uint64_t epocaAposentadoria) const {
+        return epocaAtual() >= epocaAposentadoria + 2;
+    }
+
+private:
+    // Anúncio de cada thread: (época << 1) | 1 dentro de uma Guarda, 0 fora
+    struct alignas(64) Anuncio {
+        std::atomic<std::uint64_t> valor;
+    };
+
+    Anuncio anuncios[MAX_THREADS];
+    alignas(64) std::atomic<std::uint64_t> epocaGlobal;
+};
+
+#endif
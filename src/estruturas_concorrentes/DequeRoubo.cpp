@@ -0,0 +1,119 @@
+#include "DequeRoubo.h"
+#include <stdexcept>
+
+DequeRoubo::Array::Array(std::int64_t capacidade, Array* anterior)
+    : capacidade(capacidade), celulas(new std::atomic<Elemento*>[capacidade]), anterior(anterior) {
+}
+
+DequeRoubo::Array::~Array() {
+    delete[] celulas;
+}
+
+DequeRoubo::DequeRoubo(int capacidadeInicial) : inicio(0), fim(0) {
+    if (capacidadeInicial <= 0) {
+        throw std::invalid_argument("Capacidade deve ser maior que zero");
+    }
+
+    std::int64_t capacidade = 2;
+    while (capacidade < capacidadeInicial) {
+        capacidade <<= 1;
+    }
+    array.store(new Array(capacidade, nullptr), std::memory_order_relaxed);
+}
+
+DequeRoubo::~DequeRoubo() {
+    Array* atual = array.load(std::memory_order_relaxed);
+    std::int64_t posicaoFim = fim.load(std::memory_order_relaxed);
+    for (std::int64_t i = inicio.load(std::memory_order_relaxed); i < posicaoFim; i++) {
+        delete atual->ler(i);
+    }
+
+    while (atual) {
+        Array* anterior = atual->anterior;
+        delete atual;
+        atual = anterior;
+    }
+}
+
+DequeRoubo::Array* DequeRoubo::crescer(Array* atual, std::int64_t posicaoInicio, std::int64_t posicaoFim) {
+    Array* novo = new Array(atual->capacidade * 2, atual);
+    for (std::int64_t i = posicaoInicio; i < posicaoFim; i++) {
+        novo->escrever(i, atual->ler(i));
+    }
+    // Ladrões que já leram o array antigo continuam lendo dele com segurança
+    array.store(novo, std::memory_order_release);
+    return novo;
+}
+
+void DequeRoubo::inserirFim(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    std::int64_t posicaoFim = fim.load(std::memory_order_relaxed);
+    std::int64_t posicaoInicio = inicio.load(std::memory_order_acquire);
+    Array* atual = array.load(std::memory_order_relaxed);
+    if (posicaoFim - posicaoInicio > atual->capacidade - 1) {
+        atual = crescer(atual, posicaoInicio, posicaoFim);
+    }
+    atual->escrever(posicaoFim, elemento.release());
+    // Publica o elemento para os ladrões
+    fim.store(posicaoFim + 1, std::memory_order_release);
+}
+
+std::unique_ptr<Elemento> DequeRoubo::removerFim() {
+    std::int64_t posicaoFim = fim.load(std::memory_order_relaxed) - 1;
+    Array* atual = array.load(std::memory_order_relaxed);
+    fim.store(posicaoFim, std::memory_order_relaxed);
+    // Reserva a posição antes de olhar o início: ladrões que chegarem
+    // depois já veem o fim reduzido
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t posicaoInicio = inicio.load(std::memory_order_relaxed);
+
+    if (posicaoInicio > posicaoFim) {
+        // Deque vazia: desfazer a reserva
+        fim.store(posicaoFim + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Elemento* elemento = atual->ler(posicaoFim);
+    if (posicaoInicio == posicaoFim) {
+        // Último elemento: disputar com os ladrões pelo índice de início
+        if (!inicio.compare_exchange_strong(posicaoInicio, posicaoInicio + 1,
+                                            std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            elemento = nullptr;  // Um ladrão levou
+        }
+        fim.store(posicaoFim + 1, std::memory_order_relaxed);
+    }
+    return std::unique_ptr<Elemento>(elemento);
+}
+
+std::unique_ptr<Elemento> DequeRoubo::roubarInicio() {
+    std::int64_t posicaoInicio = inicio.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t posicaoFim = fim.load(std::memory_order_acquire);
+
+    if (posicaoInicio >= posicaoFim) {
+        return nullptr;  // Deque vazia
+    }
+
+    Elemento* elemento = array.load(std::memory_order_acquire)->ler(posicaoInicio);
+    if (!inicio.compare_exchange_strong(posicaoInicio, posicaoInicio + 1,
+                                        std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;  // Outra thread levou este elemento
+    }
+    return std::unique_ptr<Elemento>(elemento);
+}
+
+bool DequeRoubo::estaVazio() const {
+    return getTamanho() == 0;
+}
+
+int DequeRoubo::getTamanho() const {
+    std::int64_t tamanho = fim.load(std::memory_order_acquire) - inicio.load(std::memory_order_acquire);
+    return tamanho < 0 ? 0 : static_cast<int>(tamanho);
+}
+
+int DequeRoubo::getCapacidade() const {
+    return static_cast<int>(array.load(std::memory_order_acquire)->capacidade);
+}
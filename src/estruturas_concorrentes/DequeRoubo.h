@@ -0,0 +1,132 @@
+#ifndef DEQUE_ROUBO_H
+#define DEQUE_ROUBO_H
+
+#include "../elementos/Elemento.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Deque de roubo de trabalho (algoritmo de Chase–Lev)
+ *
+ * Mesmo formato de duas extremidades do Deque, mas com papéis fixos:
+ * a thread dona insere e remove no fim (como uma pilha, sem travas) e as
+ * demais threads "roubam" do início com um único CAS. É a estrutura usada
+ * por escalonadores fork-join: cada thread trabalha na própria deque e só
+ * quando ela esvazia rouba tarefas das outras.
+ *
+ * Os elementos ficam em um array circular que dobra de tamanho quando
+ * enche. Arrays antigos ficam encadeados até o destrutor, pois um ladrão
+ * atrasado ainda pode estar lendo deles.
+ *
+ * Operações:
+ * - inserirFim(): adiciona elemento no fim (somente a thread dona)
+ * - removerFim(): remove elemento do fim (somente a thread dona)
+ * - roubarInicio(): remove elemento do início (qualquer thread)
+ */
+class DequeRoubo {
+private:
+    /**
+     * @brief Array circular; posições lógicas são mapeadas com uma máscara
+     */
+    struct Array {
+        std::int64_t capacidade;           // Potência de 2
+        std::atomic<Elemento*>* celulas;   // Posições do array
+        Array* anterior;                   // Array substituído (liberado no destrutor)
+
+        Array(std::int64_t capacidade, Array* anterior);
+        ~Array();
+
+        Elemento* ler(std::int64_t posicao) const {
+            return celulas[posicao & (capacidade - 1)].load(std::memory_order_relaxed);
+        }
+
+        void escrever(std::int64_t posicao, Elemento* elemento) {
+            celulas[posicao & (capacidade - 1)].store(elemento, std::memory_order_relaxed);
+        }
+    };
+
+    // Início (ladrões) e fim (dona) em linhas de cache separadas
+    alignas(64) std::atomic<std::int64_t> inicio;
+    alignas(64) std::atomic<std::int64_t> fim;
+    std::atomic<Array*> array;
+
+    /**
+     * @brief Copia os elementos para um array com o dobro da capacidade
+     */
+    Array* crescer(Array* atual, std::int64_t posicaoInicio, std::int64_t posicaoFim);
+
+public:
+    /**
+     * @brief Construtor
+     * @param capacidadeInicial Capacidade inicial (padrão: 64, arredondada para potência de 2)
+     */
+    explicit DequeRoubo(int capacidadeInicial = 64);
+
+    /**
+     * @brief Destrutor - libera os elementos restantes e todos os arrays
+     *
+     * Não deve ser chamado enquanto outras threads usam a deque.
+     */
+    ~DequeRoubo();
+
+    /**
+     * @brief Construtor de cópia (removido - a deque é compartilhada, não copiada)
+     */
+    DequeRoubo(const DequeRoubo& outro) = delete;
+
+    /**
+     * @brief Operador de atribuição (removido - a deque é compartilhada, não copiada)
+     */
+    DequeRoubo& operator=(const DequeRoubo& outro) = delete;
+
+    /**
+     * @brief Insere um elemento no fim (somente a thread dona)
+     * @param elemento Ponteiro único para o elemento (nulo é ignorado)
+     *
+     * Complexidade: O(1) amortizado - sem travas nem CAS
+     */
+    void inserirFim(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Remove o elemento do fim (somente a thread dona)
+     * @return Ponteiro único para o elemento (nullptr se vazia ou se um ladrão levou o último)
+     *
+     * Complexidade: O(1) - CAS apenas quando resta um único elemento
+     */
+    std::unique_ptr<Elemento> removerFim();
+
+    /**
+     * @brief Rouba o elemento do início (qualquer thread)
+     * @return Ponteiro único para o elemento (nullptr se vazia ou se perdeu a disputa)
+     *
+     * Complexidade: O(1) - um CAS no índice de início
+     */
+    std::unique_ptr<Elemento> roubarInicio();
+
+    /**
+     * @brief Verifica se a deque está vazia (instantâneo sob concorrência)
+     * @return true se a deque está vazia
+     *
+     * Complexidade: O(1)
+     */
+    bool estaVazio() const;
+
+    /**
+     * @brief Retorna o tamanho da deque (aproximado sob concorrência)
+     * @return Número de elementos
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Retorna a capacidade do array atual
+     * @return Capacidade (potência de 2)
+     *
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const;
+};
+
+#endif
@@ -0,0 +1,186 @@
+#include "FilaConcorrente.h"
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    // Tentativas antes de dormir: primeiro giro puro, depois cedendo a CPU
+    const int GIROS_ATIVOS = 64;
+    const int GIROS_CEDENDO = 64;
+
+    void pausar(int tentativa) {
+        if (tentativa >= GIROS_ATIVOS) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+FilaConcorrente::FilaConcorrente(int capacidade)
+    : buffer(nullptr), capacidade(1), mascara(0),
+      posicaoEnfileirar(0), posicaoDesenfileirar(0),
+      consumidoresEsperando(0), produtoresEsperando(0) {
+    if (capacidade <= 0) {
+        throw std::invalid_argument("Capacidade deve ser maior que zero");
+    }
+
+    // Arredonda para potência de 2 (mínimo 2, exigido pelo algoritmo)
+    while (this->capacidade < static_cast<std::size_t>(capacidade) || this->capacidade < 2) {
+        this->capacidade <<= 1;
+    }
+    mascara = this->capacidade - 1;
+
+    buffer = new Celula[this->capacidade];
+    for (std::size_t i = 0; i < this->capacidade; i++) {
+        buffer[i].sequencia.store(i, std::memory_order_relaxed);
+        buffer[i].dados = nullptr;
+    }
+}
+
+FilaConcorrente::~FilaConcorrente() {
+    while (tryDesenfileirar()) {
+        // Elementos restantes são liberados pelo unique_ptr retornado
+    }
+    delete[] buffer;
+}
+
+bool FilaConcorrente::tryEnfileirar(std::unique_ptr<Elemento>& elemento) {
+    if (!elemento) {
+        return false;  // Proteção contra elemento nulo
+    }
+
+    Celula* celula;
+    std::size_t posicao = posicaoEnfileirar.load(std::memory_order_relaxed);
+    for (;;) {
+        celula = &buffer[posicao & mascara];
+        std::size_t sequencia = celula->sequencia.load(std::memory_order_acquire);
+        std::ptrdiff_t diferenca = static_cast<std::ptrdiff_t>(sequencia) - static_cast<std::ptrdiff_t>(posicao);
+
+        if (diferenca == 0) {
+            // Célula livre nesta volta: reservar a posição
+            if (posicaoEnfileirar.compare_exchange_weak(posicao, posicao + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diferenca < 0) {
+            // Célula ainda ocupada pela volta anterior: fila cheia
+            return false;
+        } else {
+            // Outro produtor reservou esta posição: recarregar
+            posicao = posicaoEnfileirar.load(std::memory_order_relaxed);
+        }
+    }
+
+    celula->dados = elemento.release();
+    celula->sequencia.store(posicao + 1, std::memory_order_release);
+    return true;
+}
+
+std::unique_ptr<Elemento> FilaConcorrente::tryDesenfileirar() {
+    Celula* celula;
+    std::size_t posicao = posicaoDesenfileirar.load(std::memory_order_relaxed);
+    for (;;) {
+        celula = &buffer[posicao & mascara];
+        std::size_t sequencia = celula->sequencia.load(std::memory_order_acquire);
+        std::ptrdiff_t diferenca = static_cast<std::ptrdiff_t>(sequencia) - static_cast<std::ptrdiff_t>(posicao + 1);
+
+        if (diferenca == 0) {
+            // Célula preenchida: reservar a leitura
+            if (posicaoDesenfileirar.compare_exchange_weak(posicao, posicao + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diferenca < 0) {
+            // Produtor ainda não escreveu nesta posição: fila vazia
+            return nullptr;
+        } else {
+            // Outro consumidor levou esta posição: recarregar
+            posicao = posicaoDesenfileirar.load(std::memory_order_relaxed);
+        }
+    }
+
+    std::unique_ptr<Elemento> elemento(celula->dados);
+    celula->dados = nullptr;
+    // Libera a célula para o produtor da próxima volta
+    celula->sequencia.store(posicao + mascara + 1, std::memory_order_release);
+    return elemento;
+}
+
+void FilaConcorrente::acordar(std::atomic<int>& esperando, std::condition_variable& condicao) {
+    // Par com a barreira de quem dorme: ou a thread adormecida vê o novo
+    // estado da fila, ou nós vemos o contador dela e a acordamos
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (esperando.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> trava(mutexEspera);
+        condicao.notify_one();
+    }
+}
+
+void FilaConcorrente::enfileirar(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    for (int tentativa = 0; tentativa < GIROS_ATIVOS + GIROS_CEDENDO; tentativa++) {
+        if (tryEnfileirar(elemento)) {
+            acordar(consumidoresEsperando, condicaoNaoVazia);
+            return;
+        }
+        pausar(tentativa);
+    }
+
+    // Espera longa: dormir até um consumidor liberar espaço
+    {
+        std::unique_lock<std::mutex> trava(mutexEspera);
+        produtoresEsperando.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condicaoNaoCheia.wait(trava, [&] { return tryEnfileirar(elemento); });
+        produtoresEsperando.fetch_sub(1, std::memory_order_relaxed);
+    }
+    acordar(consumidoresEsperando, condicaoNaoVazia);
+}
+
+std::unique_ptr<Elemento> FilaConcorrente::desenfileirar() {
+    std::unique_ptr<Elemento> elemento;
+
+    for (int tentativa = 0; tentativa < GIROS_ATIVOS + GIROS_CEDENDO; tentativa++) {
+        elemento = tryDesenfileirar();
+        if (elemento) {
+            acordar(produtoresEsperando, condicaoNaoCheia);
+            return elemento;
+        }
+        pausar(tentativa);
+    }
+
+    // Espera longa: dormir até um produtor publicar um elemento
+    {
+        std::unique_lock<std::mutex> trava(mutexEspera);
+        consumidoresEsperando.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condicaoNaoVazia.wait(trava, [&] {
+            elemento = tryDesenfileirar();
+            return elemento != nullptr;
+        });
+        consumidoresEsperando.fetch_sub(1, std::memory_order_relaxed);
+    }
+    acordar(produtoresEsperando, condicaoNaoCheia);
+    return elemento;
+}
+
+bool FilaConcorrente::filaVazia() const {
+    return getTamanho() == 0;
+}
+
+int FilaConcorrente::getTamanho() const {
+    std::size_t leitura = posicaoDesenfileirar.load(std::memory_order_acquire);
+    std::size_t escrita = posicaoEnfileirar.load(std::memory_order_acquire);
+    // As leituras não são simultâneas: limitar o resultado ao intervalo válido
+    std::ptrdiff_t tamanho = static_cast<std::ptrdiff_t>(escrita - leitura);
+    if (tamanho < 0) {
+        return 0;
+    }
+    if (static_cast<std::size_t>(tamanho) > capacidade) {
+        return static_cast<int>(capacidade);
+    }
+    return static_cast<int>(tamanho);
+}
+
+int FilaConcorrente::getCapacidade() const {
+    return static_cast<int>(capacidade);
+}
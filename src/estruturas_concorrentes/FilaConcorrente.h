@@ -0,0 +1,152 @@
+#ifndef FILA_CONCORRENTE_H
+#define FILA_CONCORRENTE_H
+
+#include "../elementos/Elemento.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+/**
+ * @brief Fila limitada concorrente (múltiplos produtores / múltiplos consumidores)
+ *
+ * Segue o mesmo desenho de buffer circular da FilaOtimizada, mas pode ser
+ * compartilhada entre threads sem mutex no caminho principal. Cada posição
+ * do buffer guarda um número de sequência (algoritmo de Vyukov) que indica
+ * se ela está livre para o produtor da "volta" atual ou pronta para o
+ * consumidor, de modo que produtores e consumidores só disputam os
+ * contadores de posição com um CAS.
+ *
+ * A capacidade é arredondada para a próxima potência de 2, permitindo
+ * trocar o módulo da FilaOtimizada por uma máscara de bits.
+ *
+ * Operações:
+ * - tryEnfileirar(): tenta enfileirar sem bloquear (false se cheia)
+ * - tryDesenfileirar(): tenta desenfileirar sem bloquear (nullptr se vazia)
+ * - enfileirar(): enfileira, girando e depois dormindo enquanto a fila está cheia
+ * - desenfileirar(): desenfileira, girando e depois dormindo enquanto a fila está vazia
+ */
+class FilaConcorrente {
+private:
+    /**
+     * @brief Posição do buffer circular
+     *
+     * sequencia == posição: livre para o produtor dessa posição
+     * sequencia == posição + 1: ocupada, pronta para o consumidor
+     */
+    struct Celula {
+        std::atomic<std::size_t> sequencia;  // Número de sequência da posição
+        Elemento* dados;                     // Elemento armazenado (posse da fila)
+    };
+
+    Celula* buffer;            // Array circular de células
+    std::size_t capacidade;    // Capacidade (potência de 2)
+    std::size_t mascara;       // capacidade - 1, substitui o módulo
+
+    // Contadores em linhas de cache separadas para evitar falso compartilhamento
+    alignas(64) std::atomic<std::size_t> posicaoEnfileirar;     // Próxima posição de escrita
+    alignas(64) std::atomic<std::size_t> posicaoDesenfileirar;  // Próxima posição de leitura
+
+    // Estado usado apenas quando uma thread desiste de girar e dorme
+    alignas(64) std::mutex mutexEspera;
+    std::condition_variable condicaoNaoVazia;      // Acorda consumidores
+    std::condition_variable condicaoNaoCheia;      // Acorda produtores
+    std::atomic<int> consumidoresEsperando;        // Consumidores dormindo
+    std::atomic<int> produtoresEsperando;          // Produtores dormindo
+
+    /**
+     * @brief Acorda uma thread adormecida, se houver alguma
+     * @param esperando Contador de threads dormindo na condição
+     * @param condicao Condição a ser sinalizada
+     */
+    void acordar(std::atomic<int>& esperando, std::condition_variable& condicao);
+
+public:
+    /**
+     * @brief Construtor da fila concorrente
+     * @param capacidade Capacidade mínima da fila (padrão: 1024, arredondada para potência de 2)
+     */
+    explicit FilaConcorrente(int capacidade = 1024);
+
+    /**
+     * @brief Destrutor - libera os elementos que ainda estão na fila
+     *
+     * Não deve ser chamado enquanto outras threads usam a fila.
+     */
+    ~FilaConcorrente();
+
+    /**
+     * @brief Construtor de cópia (removido - a fila é compartilhada, não copiada)
+     */
+    FilaConcorrente(const FilaConcorrente& outra) = delete;
+
+    /**
+     * @brief Operador de atribuição (removido - a fila é compartilhada, não copiada)
+     */
+    FilaConcorrente& operator=(const FilaConcorrente& outra) = delete;
+
+    /**
+     * @brief Tenta enfileirar um elemento sem bloquear
+     * @param elemento Elemento a ser enfileirado; só é movido se a operação tiver sucesso
+     * @return true se enfileirou, false se a fila está cheia (ou elemento nulo)
+     *
+     * Complexidade: O(1) - um CAS no contador de posição (lock-free)
+     */
+    bool tryEnfileirar(std::unique_ptr<Elemento>& elemento);
+
+    /**
+     * @brief Tenta desenfileirar um elemento sem bloquear
+     * @return Ponteiro único para o elemento removido (nullptr se fila vazia)
+     *
+     * Complexidade: O(1) - um CAS no contador de posição (lock-free)
+     */
+    std::unique_ptr<Elemento> tryDesenfileirar();
+
+    /**
+     * @brief Enfileira um elemento, esperando enquanto a fila estiver cheia
+     * @param elemento Ponteiro único para o elemento a ser enfileirado
+     *
+     * Gira algumas vezes antes de dormir na condição, evitando chamadas
+     * ao sistema quando a espera é curta.
+     *
+     * Complexidade: O(1) quando há espaço
+     */
+    void enfileirar(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Desenfileira um elemento, esperando enquanto a fila estiver vazia
+     * @return Ponteiro único para o elemento removido
+     *
+     * Gira algumas vezes antes de dormir na condição.
+     *
+     * Complexidade: O(1) quando há elementos
+     */
+    std::unique_ptr<Elemento> desenfileirar();
+
+    /**
+     * @brief Verifica se a fila está vazia (instantâneo aproximado sob concorrência)
+     * @return true se a fila está vazia
+     *
+     * Complexidade: O(1)
+     */
+    bool filaVazia() const;
+
+    /**
+     * @brief Retorna o tamanho atual da fila (instantâneo aproximado sob concorrência)
+     * @return Número de elementos na fila
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Retorna a capacidade real da fila (potência de 2)
+     * @return Capacidade máxima
+     *
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const;
+};
+
+#endif
@@ -0,0 +1,178 @@
+#include "FilaEncadeadaConcorrente.h"
+#include <algorithm>
+
+FilaEncadeadaConcorrente::FilaEncadeadaConcorrente() {
+    No* sentinela = new No;
+    sentinela->dados.store(nullptr, std::memory_order_relaxed);
+    sentinela->proximo.store(nullptr, std::memory_order_relaxed);
+    cabeca.store(sentinela, std::memory_order_relaxed);
+    cauda.store(sentinela, std::memory_order_relaxed);
+}
+
+FilaEncadeadaConcorrente::~FilaEncadeadaConcorrente() {
+    // Sem outras threads: percorrer a lista a partir da sentinela
+    No* no = cabeca.load(std::memory_order_relaxed);
+    No* proximo = no->proximo.load(std::memory_order_relaxed);
+    delete no;
+    for (no = proximo; no; no = proximo) {
+        proximo = no->proximo.load(std::memory_order_relaxed);
+        delete no->dados.load(std::memory_order_relaxed);
+        delete no;
+    }
+
+    for (auto& estado : estados) {
+        for (auto& aposentado : estado.aposentados) {
+            delete aposentado.no;
+        }
+        for (No* reciclado : estado.reciclados) {
+            delete reciclado;
+        }
+    }
+    for (No* reciclado : recicladosCompartilhados) {
+        delete reciclado;
+    }
+}
+
+FilaEncadeadaConcorrente::No* FilaEncadeadaConcorrente::alocarNo(int id) {
+    std::vector<No*>& reciclados = estados[id].reciclados;
+    if (reciclados.empty()) {
+        // Buscar um lote no pool compartilhado (alimentado pelos consumidores)
+        std::lock_guard<std::mutex> trava(mutexCompartilhado);
+        std::size_t quantidade = std::min(TAMANHO_LOTE, recicladosCompartilhados.size());
+        reciclados.assign(recicladosCompartilhados.end() - quantidade, recicladosCompartilhados.end());
+        recicladosCompartilhados.resize(recicladosCompartilhados.size() - quantidade);
+    }
+    if (reciclados.empty()) {
+        return new No;
+    }
+    No* no = reciclados.back();
+    reciclados.pop_back();
+    return no;
+}
+
+void FilaEncadeadaConcorrente::aposentar(int id, No* no) {
+    estados[id].aposentados.push_back({no, coletor.epocaAtual()});
+}
+
+void FilaEncadeadaConcorrente::coletar(int id) {
+    coletor.tentarAvancar();
+
+    EstadoThread& estado = estados[id];
+    std::size_t mantidos = 0;
+    for (std::size_t i = 0; i < estado.aposentados.size(); i++) {
+        if (coletor.podeLiberar(estado.aposentados[i].epoca)) {
+            estado.reciclados.push_back(estado.aposentados[i].no);
+        } else {
+            estado.aposentados[mantidos++] = estado.aposentados[i];
+        }
+    }
+    estado.aposentados.resize(mantidos);
+    estado.proximaColeta = mantidos + INTERVALO_COLETA;
+
+    // Excedente local vai em lote para o pool compartilhado
+    if (estado.reciclados.size() > 2 * TAMANHO_LOTE) {
+        std::lock_guard<std::mutex> trava(mutexCompartilhado);
+        while (estado.reciclados.size() > TAMANHO_LOTE) {
+            No* no = estado.reciclados.back();
+            estado.reciclados.pop_back();
+            if (recicladosCompartilhados.size() < LIMITE_COMPARTILHADO) {
+                recicladosCompartilhados.push_back(no);
+            } else {
+                delete no;
+            }
+        }
+    }
+}
+
+void FilaEncadeadaConcorrente::enfileirar(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    int id = ColetorEpocas::idThreadAtual();
+    No* novo = alocarNo(id);
+    novo->dados.store(elemento.release(), std::memory_order_relaxed);
+    novo->proximo.store(nullptr, std::memory_order_relaxed);
+
+    ColetorEpocas::Guarda guarda(coletor, id);
+    for (;;) {
+        No* ultimo = cauda.load(std::memory_order_acquire);
+        No* proximo = ultimo->proximo.load(std::memory_order_acquire);
+        if (ultimo != cauda.load(std::memory_order_acquire)) {
+            continue;  // Cauda mudou durante a leitura
+        }
+
+        if (proximo == nullptr) {
+            // Ligar o novo nó após o último; a cauda é ajustada em seguida
+            if (ultimo->proximo.compare_exchange_weak(proximo, novo, std::memory_order_release, std::memory_order_relaxed)) {
+                cauda.compare_exchange_strong(ultimo, novo, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        } else {
+            // Cauda atrasada: ajudar o produtor anterior a avançá-la
+            cauda.compare_exchange_weak(ultimo, proximo, std::memory_order_release, std::memory_order_relaxed);
+        }
+    }
+    EstadoThread& estado = estados[id];
+    estado.enfileirados.store(estado.enfileirados.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+std::unique_ptr<Elemento> FilaEncadeadaConcorrente::desenfileirar() {
+    int id = ColetorEpocas::idThreadAtual();
+    std::unique_ptr<Elemento> elemento;
+
+    {
+        ColetorEpocas::Guarda guarda(coletor, id);
+        for (;;) {
+            No* primeiro = cabeca.load(std::memory_order_acquire);
+            No* ultimo = cauda.load(std::memory_order_acquire);
+            No* proximo = primeiro->proximo.load(std::memory_order_acquire);
+            if (primeiro != cabeca.load(std::memory_order_acquire)) {
+                continue;  // Cabeça mudou durante a leitura
+            }
+
+            if (primeiro == ultimo) {
+                if (proximo == nullptr) {
+                    return nullptr;  // Fila vazia
+                }
+                // Cauda atrasada: avançá-la antes de retirar
+                cauda.compare_exchange_weak(ultimo, proximo, std::memory_order_release, std::memory_order_relaxed);
+            } else if (cabeca.compare_exchange_weak(primeiro, proximo, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                // 'proximo' vira a nova sentinela; a Guarda impede que ele
+                // seja reciclado antes de lermos o elemento
+                elemento.reset(proximo->dados.load(std::memory_order_relaxed));
+                aposentar(id, primeiro);
+                break;
+            }
+        }
+    }
+
+    EstadoThread& estado = estados[id];
+    estado.desenfileirados.store(estado.desenfileirados.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (estado.aposentados.size() >= estado.proximaColeta) {
+        coletar(id);
+    }
+    return elemento;
+}
+
+bool FilaEncadeadaConcorrente::estaVazia() const {
+    // A cabeça (sentinela) é lida sob Guarda: ela pode ser aposentada a qualquer momento
+    int id = ColetorEpocas::idThreadAtual();
+    ColetorEpocas::Guarda guarda(coletor, id);
+    return cabeca.load(std::memory_order_acquire)->proximo.load(std::memory_order_acquire) == nullptr;
+}
+
+int FilaEncadeadaConcorrente::getTamanho() const {
+    long total = 0;
+    for (const auto& estado : estados) {
+        total += estado.enfileirados.load(std::memory_order_relaxed)
+               - estado.desenfileirados.load(std::memory_order_relaxed);
+    }
+    return total < 0 ? 0 : static_cast<int>(total);
+}
+
+void FilaEncadeadaConcorrente::limpar() {
+    while (desenfileirar()) {
+        // Cada elemento é liberado pelo unique_ptr retornado
+    }
+}
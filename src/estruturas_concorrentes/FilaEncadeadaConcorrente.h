@@ -0,0 +1,153 @@
+#ifndef FILA_ENCADEADA_CONCORRENTE_H
+#define FILA_ENCADEADA_CONCORRENTE_H
+
+#include "../elementos/Elemento.h"
+#include "ColetorEpocas.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Fila encadeada concorrente e ilimitada (fila de Michael–Scott)
+ *
+ * Versão da FilaEncadeada que pode ser compartilhada entre vários
+ * produtores e consumidores sem travas. A lista sempre começa com um nó
+ * sentinela: a cabeça aponta para ele e o primeiro elemento real está no
+ * nó seguinte, de modo que produtores (que só mexem na cauda) e
+ * consumidores (que só mexem na cabeça) raramente disputam o mesmo CAS.
+ *
+ * Nós retirados não são liberados na hora: são aposentados no
+ * ColetorEpocas e, quando nenhuma thread pode mais estar lendo, voltam para
+ * um pool de reciclagem da própria thread. Como quem retira nós são os
+ * consumidores, o excedente passa em lotes por um pool compartilhado até
+ * os produtores. Em regime estável, enfileirar reaproveita esses nós em
+ * vez de alocar no heap.
+ *
+ * Operações:
+ * - enfileirar(): adiciona elemento no final da fila (lock-free)
+ * - desenfileirar(): remove e retorna elemento do início (lock-free, nullptr se vazia)
+ */
+class FilaEncadeadaConcorrente {
+private:
+    /**
+     * @brief Nó da fila (o primeiro nó é sempre a sentinela)
+     */
+    struct No {
+        std::atomic<Elemento*> dados;   // Elemento armazenado (posse da fila)
+        std::atomic<No*> proximo;       // Próximo nó (nullptr no último)
+    };
+
+    static constexpr std::size_t INTERVALO_COLETA = 64;         // Aposentadorias entre coletas
+    static constexpr std::size_t TAMANHO_LOTE = 256;            // Nós trocados com o pool compartilhado
+    static constexpr std::size_t LIMITE_COMPARTILHADO = 65536;  // Excedente volta ao heap
+
+    /**
+     * @brief Nó aposentado aguardando a época segura para reutilização
+     */
+    struct Aposentado {
+        No* no;
+        std::uint64_t epoca;
+    };
+
+    /**
+     * @brief Estado acessado apenas pela thread dona do identificador
+     */
+    struct alignas(64) EstadoThread {
+        std::vector<Aposentado> aposentados;  // Nós retirados da fila
+        std::vector<No*> reciclados;          // Nós prontos para reutilização
+        std::size_t proximaColeta = INTERVALO_COLETA;
+        // Contadores com um único escritor (sem RMW atômico no caminho comum)
+        std::atomic<long> enfileirados{0};
+        std::atomic<long> desenfileirados{0};
+    };
+
+    alignas(64) std::atomic<No*> cabeca;  // Sentinela (consumidores)
+    alignas(64) std::atomic<No*> cauda;   // Último nó ou quase (produtores)
+    mutable ColetorEpocas coletor;         // Mutável: estaVazia() const também entra em uma Guarda
+    EstadoThread estados[ColetorEpocas::MAX_THREADS];
+
+    // Pool compartilhado, acessado uma vez a cada TAMANHO_LOTE nós
+    std::mutex mutexCompartilhado;
+    std::vector<No*> recicladosCompartilhados;
+
+    /**
+     * @brief Obtém um nó do pool da thread, do pool compartilhado ou do heap
+     */
+    No* alocarNo(int id);
+
+    /**
+     * @brief Registra um nó desligado da fila para reutilização futura
+     */
+    void aposentar(int id, No* no);
+
+    /**
+     * @brief Move para o pool os nós aposentados que já não podem ser lidos
+     */
+    void coletar(int id);
+
+public:
+    /**
+     * @brief Construtor - cria a fila vazia (apenas a sentinela)
+     */
+    FilaEncadeadaConcorrente();
+
+    /**
+     * @brief Destrutor - libera elementos, nós e pools
+     *
+     * Não deve ser chamado enquanto outras threads usam a fila.
+     */
+    ~FilaEncadeadaConcorrente();
+
+    /**
+     * @brief Construtor de cópia (removido - a fila é compartilhada, não copiada)
+     */
+    FilaEncadeadaConcorrente(const FilaEncadeadaConcorrente& outra) = delete;
+
+    /**
+     * @brief Operador de atribuição (removido - a fila é compartilhada, não copiada)
+     */
+    FilaEncadeadaConcorrente& operator=(const FilaEncadeadaConcorrente& outra) = delete;
+
+    /**
+     * @brief Enfileira um elemento no final da fila
+     * @param elemento Ponteiro único para o elemento a ser enfileirado (nulo é ignorado)
+     *
+     * Complexidade: O(1) - CAS no último nó e na cauda (lock-free)
+     */
+    void enfileirar(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Desenfileira o elemento do início da fila
+     * @return Ponteiro único para o elemento removido (nullptr se fila vazia)
+     *
+     * Complexidade: O(1) - CAS na cabeça (lock-free)
+     */
+    std::unique_ptr<Elemento> desenfileirar();
+
+    /**
+     * @brief Verifica se a fila está vazia (instantâneo sob concorrência)
+     * @return true se a fila está vazia
+     *
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const;
+
+    /**
+     * @brief Retorna o tamanho da fila (aproximado sob concorrência)
+     * @return Número de elementos na fila
+     *
+     * Complexidade: O(t) - soma os contadores de cada thread registrada
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Desenfileira e libera todos os elementos
+     *
+     * Complexidade: O(n)
+     */
+    void limpar();
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "PilhaConcorrente.h"
+#include <new>
+
+namespace {
+    std::uint64_t marcar(std::uint32_t indice, std::uint64_t marca) {
+        return (marca << 32) | indice;
+    }
+
+    std::uint32_t indiceDe(std::uint64_t marcado) {
+        return static_cast<std::uint32_t>(marcado);
+    }
+
+    std::uint64_t marcaDe(std::uint64_t marcado) {
+        return marcado >> 32;
+    }
+
+    // Posição do bit mais significativo (valor > 0)
+    int bitMaisAlto(std::uint64_t valor) {
+        return 63 - __builtin_clzll(valor);
+    }
+}
+
+PilhaConcorrente::PilhaConcorrente()
+    : topoMarcado(marcar(NULO, 0)), livresMarcado(marcar(NULO, 0)),
+      proximoNovo(0), tamanho(0) {
+    for (int i = 0; i < MAX_BLOCOS; i++) {
+        blocos[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+PilhaConcorrente::~PilhaConcorrente() {
+    limpar();
+    for (int i = 0; i < MAX_BLOCOS; i++) {
+        delete[] blocos[i].load(std::memory_order_relaxed);
+    }
+}
+
+PilhaConcorrente::No& PilhaConcorrente::obterNo(std::uint32_t indice) const {
+    // Bloco b guarda os índices [1024 * (2^b - 1), 1024 * (2^(b+1) - 1))
+    std::uint64_t deslocado = static_cast<std::uint64_t>(indice) + (1u << BITS_BLOCO_INICIAL);
+    int bloco = bitMaisAlto(deslocado) - BITS_BLOCO_INICIAL;
+    std::uint64_t posicao = deslocado - (static_cast<std::uint64_t>(1) << (bloco + BITS_BLOCO_INICIAL));
+    return blocos[bloco].load(std::memory_order_acquire)[posicao];
+}
+
+std::uint32_t PilhaConcorrente::alocarNo() {
+    std::uint32_t indice = desempilharIndice(livresMarcado);
+    if (indice != NULO) {
+        return indice;
+    }
+
+    // Nenhum nó para reutilizar: reservar um índice novo
+    indice = proximoNovo.fetch_add(1, std::memory_order_relaxed);
+    std::uint64_t deslocado = static_cast<std::uint64_t>(indice) + (1u << BITS_BLOCO_INICIAL);
+    int bloco = bitMaisAlto(deslocado) - BITS_BLOCO_INICIAL;
+    if (bloco >= MAX_BLOCOS) {
+        throw std::bad_alloc();
+    }
+
+    if (blocos[bloco].load(std::memory_order_acquire) == nullptr) {
+        // Várias threads podem tentar criar o mesmo bloco: só uma publica
+        No* novo = new No[static_cast<std::size_t>(1) << (bloco + BITS_BLOCO_INICIAL)];
+        No* esperado = nullptr;
+        if (!blocos[bloco].compare_exchange_strong(esperado, novo, std::memory_order_acq_rel)) {
+            delete[] novo;
+        }
+    }
+    return indice;
+}
+
+void PilhaConcorrente::empilharIndice(std::atomic<std::uint64_t>& cabeca, std::uint32_t indice) {
+    No& no = obterNo(indice);
+    std::uint64_t atual = cabeca.load(std::memory_order_relaxed);
+    do {
+        no.proximo.store(indiceDe(atual), std::memory_order_relaxed);
+    } while (!cabeca.compare_exchange_weak(atual, marcar(indice, marcaDe(atual) + 1),
+                                           std::memory_order_release, std::memory_order_relaxed));
+}
+
+std::uint32_t PilhaConcorrente::desempilharIndice(std::atomic<std::uint64_t>& cabeca) {
+    std::uint64_t atual = cabeca.load(std::memory_order_acquire);
+    for (;;) {
+        std::uint32_t indice = indiceDe(atual);
+        if (indice == NULO) {
+            return NULO;
+        }
+        // Se o nó for reutilizado antes do CAS, a marca do topo muda e o CAS falha
+        std::uint32_t proximo = obterNo(indice).proximo.load(std::memory_order_relaxed);
+        if (cabeca.compare_exchange_weak(atual, marcar(proximo, marcaDe(atual) + 1),
+                                         std::memory_order_acquire, std::memory_order_acquire)) {
+            return indice;
+        }
+    }
+}
+
+void PilhaConcorrente::empilhar(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    std::uint32_t indice = alocarNo();
+    obterNo(indice).dados.store(elemento.release(), std::memory_order_relaxed);
+    empilharIndice(topoMarcado, indice);
+    tamanho.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::unique_ptr<Elemento> PilhaConcorrente::desempilhar() {
+    std::uint32_t indice = desempilharIndice(topoMarcado);
+    if (indice == NULO) {
+        return nullptr;  // Pilha vazia
+    }
+
+    // O CAS vencedor dá posse exclusiva do nó: ler o elemento e devolver o nó ao pool
+    No& no = obterNo(indice);
+    std::unique_ptr<Elemento> elemento(no.dados.load(std::memory_order_relaxed));
+    no.dados.store(nullptr, std::memory_order_relaxed);
+    empilharIndice(livresMarcado, indice);
+    tamanho.fetch_sub(1, std::memory_order_relaxed);
+    return elemento;
+}
+
+Elemento* PilhaConcorrente::topo() const {
+    std::uint32_t indice = indiceDe(topoMarcado.load(std::memory_order_acquire));
+    if (indice == NULO) {
+        return nullptr;  // Pilha vazia
+    }
+    return obterNo(indice).dados.load(std::memory_order_relaxed);
+}
+
+bool PilhaConcorrente::estaVazia() const {
+    return indiceDe(topoMarcado.load(std::memory_order_acquire)) == NULO;
+}
+
+int PilhaConcorrente::getTamanho() const {
+    int valor = tamanho.load(std::memory_order_relaxed);
+    return valor < 0 ? 0 : valor;
+}
+
+void PilhaConcorrente::limpar() {
+    while (desempilhar()) {
+        // Cada elemento é liberado pelo unique_ptr retornado
+    }
+}
@@ -0,0 +1,150 @@
+#ifndef PILHA_CONCORRENTE_H
+#define PILHA_CONCORRENTE_H
+
+#include "../elementos/Elemento.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Pilha encadeada concorrente sem travas (pilha de Treiber)
+ *
+ * Mesma interface da PilhaEncadeada (empilhar/desempilhar/topo), mas pode
+ * ser compartilhada entre threads: o topo é trocado com um único CAS.
+ *
+ * Problema ABA: os nós são identificados por um índice de 32 bits e o
+ * topo guarda, na mesma palavra de 64 bits, uma marca que é incrementada a
+ * cada troca. Se um nó sair e voltar ao topo entre a leitura e o CAS de
+ * outra thread, a marca terá mudado e o CAS falha.
+ *
+ * Recuperação de memória: os nós vêm de um pool de blocos que só é
+ * devolvido ao sistema no destrutor. Um nó desempilhado volta para uma
+ * lista de livres (também uma pilha de Treiber marcada) e é reutilizado;
+ * como o bloco continua alocado, uma thread atrasada que ainda lê o nó
+ * antigo nunca acessa memória liberada, apenas falha no CAS.
+ *
+ * Operações:
+ * - empilhar(): adiciona elemento no topo da pilha (lock-free)
+ * - desempilhar(): remove e retorna elemento do topo da pilha (lock-free)
+ * - topo(): consulta o elemento do topo sem removê-lo
+ */
+class PilhaConcorrente {
+private:
+    /**
+     * @brief Nó do pool; campos atômicos porque threads atrasadas podem
+     * lê-los enquanto o nó é reutilizado
+     */
+    struct No {
+        std::atomic<Elemento*> dados;        // Elemento armazenado (posse da pilha)
+        std::atomic<std::uint32_t> proximo;  // Índice do nó abaixo (NULO na base)
+    };
+
+    static const std::uint32_t NULO = 0xFFFFFFFFu;  // Índice que representa "nenhum nó"
+    static const int BITS_BLOCO_INICIAL = 10;       // Primeiro bloco com 1024 nós
+    static const int MAX_BLOCOS = 21;               // Cada bloco dobra o anterior
+
+    std::atomic<No*> blocos[MAX_BLOCOS];  // Blocos do pool, alocados sob demanda
+
+    // Cabeças marcadas (marca nos 32 bits altos, índice nos 32 baixos),
+    // em linhas de cache separadas para evitar falso compartilhamento
+    alignas(64) std::atomic<std::uint64_t> topoMarcado;    // Topo da pilha
+    alignas(64) std::atomic<std::uint64_t> livresMarcado;  // Nós prontos para reuso
+    alignas(64) std::atomic<std::uint32_t> proximoNovo;    // Primeiro índice nunca usado
+    std::atomic<int> tamanho;                              // Contagem aproximada
+
+    /**
+     * @brief Localiza o nó de um índice (bloco e deslocamento por operações de bits)
+     */
+    No& obterNo(std::uint32_t indice) const;
+
+    /**
+     * @brief Obtém um nó livre, reutilizando ou reservando um índice novo
+     */
+    std::uint32_t alocarNo();
+
+    /**
+     * @brief Empilha um índice em uma pilha marcada (topo ou lista de livres)
+     */
+    void empilharIndice(std::atomic<std::uint64_t>& cabeca, std::uint32_t indice);
+
+    /**
+     * @brief Desempilha um índice de uma pilha marcada
+     * @return Índice removido (NULO se vazia)
+     */
+    std::uint32_t desempilharIndice(std::atomic<std::uint64_t>& cabeca);
+
+public:
+    /**
+     * @brief Construtor - pilha vazia, o pool cresce sob demanda
+     */
+    PilhaConcorrente();
+
+    /**
+     * @brief Destrutor - libera os elementos restantes e os blocos do pool
+     *
+     * Não deve ser chamado enquanto outras threads usam a pilha.
+     */
+    ~PilhaConcorrente();
+
+    /**
+     * @brief Construtor de cópia (removido - a pilha é compartilhada, não copiada)
+     */
+    PilhaConcorrente(const PilhaConcorrente& outra) = delete;
+
+    /**
+     * @brief Operador de atribuição (removido - a pilha é compartilhada, não copiada)
+     */
+    PilhaConcorrente& operator=(const PilhaConcorrente& outra) = delete;
+
+    /**
+     * @brief Empilha um elemento no topo da pilha
+     * @param elemento Ponteiro único para o elemento a ser empilhado (nulo é ignorado)
+     *
+     * Complexidade: O(1) - um CAS no topo (lock-free)
+     */
+    void empilhar(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Desempilha o elemento do topo da pilha
+     * @return Ponteiro único para o elemento removido (nullptr se pilha vazia)
+     *
+     * Complexidade: O(1) - um CAS no topo (lock-free)
+     */
+    std::unique_ptr<Elemento> desempilhar();
+
+    /**
+     * @brief Consulta o elemento do topo sem removê-lo
+     * @return Ponteiro para o elemento do topo (nullptr se pilha vazia)
+     *
+     * O ponteiro só continua válido enquanto nenhuma outra thread
+     * desempilhar esse elemento.
+     *
+     * Complexidade: O(1)
+     */
+    Elemento* topo() const;
+
+    /**
+     * @brief Verifica se a pilha está vazia (instantâneo sob concorrência)
+     * @return true se a pilha está vazia
+     *
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const;
+
+    /**
+     * @brief Retorna o tamanho da pilha (aproximado sob concorrência)
+     * @return Número de elementos na pilha
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Desempilha e libera todos os elementos
+     *
+     * Complexidade: O(n)
+     */
+    void limpar();
+};
+
+#endif
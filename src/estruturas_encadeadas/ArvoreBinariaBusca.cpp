@@ -23,7 +23,7 @@ std::unique_ptr<ArvoreBinariaBusca::No> ArvoreBinariaBusca::inserirRecursivo(
     }
     
     long idElemento = elemento->getID();
-    long idNo = no->dados->getID();
+    long idNo = no->id;
     
     if (idElemento < idNo) {
         // Inserir na subárvore esquerda
@@ -46,7 +46,7 @@ Elemento* ArvoreBinariaBusca::buscarRecursivo(No* no, long id) const {
         return nullptr;  // Elemento não encontrado
     }
     
-    long idNo = no->dados->getID();
+    long idNo = no->id;
     
     if (id == idNo) {
         return no->dados.get();  // Elemento encontrado
@@ -75,7 +75,7 @@ ArvoreBinariaBusca::removerRecursivo(std::unique_ptr<No> no, long id) {
         return {nullptr, nullptr};  // Elemento não encontrado
     }
     
-    long idNo = no->dados->getID();
+    long idNo = no->id;
     
     if (id < idNo) {
         // Remover da subárvore esquerda
@@ -112,7 +112,7 @@ ArvoreBinariaBusca::removerRecursivo(std::unique_ptr<No> no, long id) {
         
         // Copiar os dados do sucessor para o nó atual
         // Aqui precisamos criar uma cópia do elemento do sucessor
-        long idSucessor = sucessor->dados->getID();
+        long idSucessor = sucessor->id;
         
         // Remover o sucessor da subárvore direita
         auto resultadoSucessor = removerRecursivo(std::move(no->direito), idSucessor);
@@ -120,6 +120,7 @@ ArvoreBinariaBusca::removerRecursivo(std::unique_ptr<No> no, long id) {
         
         // Substituir dados do nó atual pelos dados do sucessor
         no->dados = std::move(resultadoSucessor.second);
+        no->id = idSucessor;
         
         return {std::move(no), std::move(elementoRemovido)};
     }
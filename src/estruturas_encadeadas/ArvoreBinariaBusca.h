@@ -29,6 +29,7 @@ private:
     class No {
     public:
         std::unique_ptr<Elemento> dados;    // Elemento armazenado
+        long id;                            // Cópia de dados->getID(): a descida não visita os elementos
         std::unique_ptr<No> esquerdo;       // Filho esquerdo
         std::unique_ptr<No> direito;        // Filho direito
         
@@ -37,7 +38,7 @@ private:
          * @param elemento Elemento a ser armazenado
          */
         explicit No(std::unique_ptr<Elemento> elemento) 
-            : dados(std::move(elemento)), esquerdo(nullptr), direito(nullptr) {}
+            : dados(std::move(elemento)), id(dados->getID()), esquerdo(nullptr), direito(nullptr) {}
     };
     
     std::unique_ptr<No> raiz;    // Raiz da árvore
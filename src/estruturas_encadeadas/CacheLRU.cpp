@@ -0,0 +1,94 @@
+#include "CacheLRU.h"
+#include <stdexcept>
+
+CacheLRU::CacheLRU(int capacidade, bool usarPoolNos)
+    : lista(usarPoolNos), capacidade(capacidade), acertos(0), falhas(0), despejos(0) {
+    if (capacidade <= 0) {
+        throw std::invalid_argument("Capacidade deve ser maior que zero");
+    }
+    lista.ativarIndiceIds();
+}
+
+Elemento* CacheLRU::obter(long id) {
+    if (!lista.moverParaInicio(id)) {
+        falhas++;
+        return nullptr;
+    }
+
+    acertos++;
+    return lista.getPrimeiro();
+}
+
+bool CacheLRU::contem(long id) const {
+    return lista.buscarPeloId(id) != nullptr;
+}
+
+void CacheLRU::inserir(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    // ID já presente: substitui no lugar e promove
+    long id = elemento->getID();
+    if (lista.buscarPeloId(id)) {
+        lista.alterarPeloId(id, std::move(elemento));
+        lista.moverParaInicio(id);
+        return;
+    }
+
+    if (lista.getTamanho() == capacidade) {
+        auto despejado = lista.removerUltimo();
+        despejos++;
+        if (aoDespejar) {
+            aoDespejar(std::move(despejado));
+        }
+    }
+    lista.inserirNoInicio(std::move(elemento));
+}
+
+std::unique_ptr<Elemento> CacheLRU::remover(long id) {
+    return lista.removerPeloId(id);
+}
+
+void CacheLRU::definirCallbackRemocao(CallbackRemocao callback) {
+    aoDespejar = std::move(callback);
+}
+
+Elemento* CacheLRU::getMenosRecente() const {
+    return lista.getUltimo();
+}
+
+int CacheLRU::getTamanho() const {
+    return lista.getTamanho();
+}
+
+int CacheLRU::getCapacidade() const {
+    return capacidade;
+}
+
+long CacheLRU::getAcertos() const {
+    return acertos;
+}
+
+long CacheLRU::getFalhas() const {
+    return falhas;
+}
+
+long CacheLRU::getDespejos() const {
+    return despejos;
+}
+
+double CacheLRU::getTaxaAcertos() const {
+    long consultas = acertos + falhas;
+    return consultas == 0 ? 0.0 : static_cast<double>(acertos) / consultas;
+}
+
+void CacheLRU::zerarEstatisticas() {
+    acertos = 0;
+    falhas = 0;
+    despejos = 0;
+}
+
+void CacheLRU::limpar() {
+    lista.limpar();
+}
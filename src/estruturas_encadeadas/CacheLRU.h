@@ -0,0 +1,154 @@
+#ifndef CACHE_LRU_H
+#define CACHE_LRU_H
+
+#include "../elementos/Elemento.h"
+#include "ListaDuplamenteEncadeada.h"
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Cache LRU (Least Recently Used) de elementos, indexado pelo ID
+ *
+ * Adaptador por composição sobre ListaDuplamenteEncadeada:
+ * - A lista guarda os elementos do mais recente (início) ao menos
+ *   recente (fim), e o índice de IDs da lista faz o papel do mapa
+ * - Acerto: moverParaInicio() religa o nó na cabeça - O(1)
+ * - Inserção: inserirNoInicio() - O(1)
+ * - Despejo: removerUltimo() tira o menos recente - O(1)
+ *
+ * A capacidade é fixa. Ao inserir com o cache cheio, o elemento menos
+ * recente é despejado e entregue ao callback de remoção, se houver
+ * (por exemplo, para gravá-lo de volta na origem).
+ */
+class CacheLRU {
+public:
+    /**
+     * @brief Função chamada com cada elemento despejado pelo cache
+     */
+    using CallbackRemocao = std::function<void(std::unique_ptr<Elemento>)>;
+
+private:
+    ListaDuplamenteEncadeada lista;  // Composição: do mais ao menos recente
+    int capacidade;                  // Número máximo de elementos
+    long acertos;                    // Consultas que encontraram o ID
+    long falhas;                     // Consultas que não encontraram o ID
+    long despejos;                   // Elementos retirados por falta de espaço
+    CallbackRemocao aoDespejar;      // Recebe os elementos despejados (pode ser vazio)
+
+public:
+    /**
+     * @brief Construtor do cache
+     * @param capacidade Número máximo de elementos (deve ser maior que zero)
+     * @param usarPoolNos Se true, a lista interna aloca os nós por um pool próprio
+     * @throws std::invalid_argument se a capacidade não for positiva
+     */
+    explicit CacheLRU(int capacidade, bool usarPoolNos = true);
+
+    /**
+     * @brief Destrutor do cache (não chama o callback)
+     */
+    ~CacheLRU() = default;
+
+    CacheLRU(const CacheLRU& outro) = delete;
+    CacheLRU& operator=(const CacheLRU& outro) = delete;
+
+    /**
+     * @brief Consulta um elemento e o marca como o mais recente
+     * @param id ID procurado
+     * @return Ponteiro para o elemento (nullptr em caso de falha)
+     *
+     * Conta um acerto ou uma falha. O ponteiro vale até o elemento
+     * sair do cache.
+     *
+     * Complexidade: O(1) médio
+     */
+    Elemento* obter(long id);
+
+    /**
+     * @brief Verifica se um ID está no cache, sem alterar a ordem nem os contadores
+     *
+     * Complexidade: O(1) médio
+     */
+    bool contem(long id) const;
+
+    /**
+     * @brief Insere um elemento como o mais recente
+     * @param elemento Elemento a ser guardado (nulo é ignorado)
+     *
+     * Se o ID já estiver no cache, o elemento antigo é substituído.
+     * Caso contrário, com o cache cheio, o menos recente é despejado.
+     *
+     * Complexidade: O(1) médio
+     */
+    void inserir(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Retira um elemento do cache (invalidação), sem chamar o callback
+     * @param id ID do elemento
+     * @return Ponteiro único para o elemento (nullptr se não estava no cache)
+     *
+     * Complexidade: O(1) médio
+     */
+    std::unique_ptr<Elemento> remover(long id);
+
+    /**
+     * @brief Define a função chamada com cada elemento despejado
+     */
+    void definirCallbackRemocao(CallbackRemocao callback);
+
+    /**
+     * @brief Consulta o elemento menos recente (próximo a ser despejado)
+     * @return Ponteiro para o elemento (nullptr se vazio)
+     *
+     * Complexidade: O(1)
+     */
+    Elemento* getMenosRecente() const;
+
+    /**
+     * @brief Retorna o número de elementos no cache
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Retorna a capacidade do cache
+     *
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const;
+
+    /**
+     * @brief Retorna o número de acertos desde a última zerada
+     */
+    long getAcertos() const;
+
+    /**
+     * @brief Retorna o número de falhas desde a última zerada
+     */
+    long getFalhas() const;
+
+    /**
+     * @brief Retorna o número de despejos desde a última zerada
+     */
+    long getDespejos() const;
+
+    /**
+     * @brief Retorna a fração de consultas que acertaram (0 se não houve consultas)
+     */
+    double getTaxaAcertos() const;
+
+    /**
+     * @brief Zera os contadores de acertos, falhas e despejos
+     */
+    void zerarEstatisticas();
+
+    /**
+     * @brief Esvazia o cache sem chamar o callback
+     *
+     * Complexidade: O(n)
+     */
+    void limpar();
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "CacheSLRU.h"
+#include <stdexcept>
+
+CacheSLRU::CacheSLRU(int capacidade, double fracaoProtegida)
+    : probatorio(true), protegido(true), capacidade(capacidade), capacidadeProtegida(0),
+      acertos(0), falhas(0), despejos(0) {
+    if (capacidade < 2) {
+        throw std::invalid_argument("Capacidade deve ser maior que um");
+    }
+
+    capacidadeProtegida = static_cast<int>(capacidade * fracaoProtegida);
+    if (capacidadeProtegida < 1) {
+        capacidadeProtegida = 1;
+    } else if (capacidadeProtegida > capacidade - 1) {
+        capacidadeProtegida = capacidade - 1;
+    }
+
+    probatorio.ativarIndiceIds();
+    protegido.ativarIndiceIds();
+}
+
+Elemento* CacheSLRU::promover(long id) {
+    protegido.inserirNoInicio(probatorio.removerPeloId(id));
+
+    // Protegido lotado: o menos recente dele ganha outra chance no probatório
+    if (protegido.getTamanho() > capacidadeProtegida) {
+        probatorio.inserirNoInicio(protegido.removerUltimo());
+    }
+    return protegido.getPrimeiro();
+}
+
+Elemento* CacheSLRU::obter(long id) {
+    if (protegido.moverParaInicio(id)) {
+        acertos++;
+        return protegido.getPrimeiro();
+    }
+
+    if (probatorio.buscarPeloId(id)) {
+        acertos++;
+        return promover(id);
+    }
+
+    falhas++;
+    return nullptr;
+}
+
+bool CacheSLRU::contem(long id) const {
+    return protegido.buscarPeloId(id) || probatorio.buscarPeloId(id);
+}
+
+void CacheSLRU::inserir(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    // ID já presente: substitui no lugar e conta como acesso
+    long id = elemento->getID();
+    if (protegido.buscarPeloId(id)) {
+        protegido.alterarPeloId(id, std::move(elemento));
+        protegido.moverParaInicio(id);
+        return;
+    }
+    if (probatorio.buscarPeloId(id)) {
+        probatorio.alterarPeloId(id, std::move(elemento));
+        promover(id);
+        return;
+    }
+
+    // O protegido nunca ocupa a capacidade inteira: com o cache cheio, o probatório tem elementos
+    if (getTamanho() == capacidade) {
+        auto despejado = probatorio.removerUltimo();
+        despejos++;
+        if (aoDespejar) {
+            aoDespejar(std::move(despejado));
+        }
+    }
+    probatorio.inserirNoInicio(std::move(elemento));
+}
+
+std::unique_ptr<Elemento> CacheSLRU::remover(long id) {
+    auto elemento = protegido.removerPeloId(id);
+    if (!elemento) {
+        elemento = probatorio.removerPeloId(id);
+    }
+    return elemento;
+}
+
+void CacheSLRU::definirCallbackRemocao(CallbackRemocao callback) {
+    aoDespejar = std::move(callback);
+}
+
+int CacheSLRU::getTamanho() const {
+    return probatorio.getTamanho() + protegido.getTamanho();
+}
+
+int CacheSLRU::getTamanhoProtegido() const {
+    return protegido.getTamanho();
+}
+
+int CacheSLRU::getCapacidade() const {
+    return capacidade;
+}
+
+long CacheSLRU::getAcertos() const {
+    return acertos;
+}
+
+long CacheSLRU::getFalhas() const {
+    return falhas;
+}
+
+long CacheSLRU::getDespejos() const {
+    return despejos;
+}
+
+double CacheSLRU::getTaxaAcertos() const {
+    long consultas = acertos + falhas;
+    return consultas == 0 ? 0.0 : static_cast<double>(acertos) / consultas;
+}
+
+void CacheSLRU::zerarEstatisticas() {
+    acertos = 0;
+    falhas = 0;
+    despejos = 0;
+}
+
+void CacheSLRU::limpar() {
+    probatorio.limpar();
+    protegido.limpar();
+}
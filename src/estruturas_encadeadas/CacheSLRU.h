@@ -0,0 +1,167 @@
+#ifndef CACHE_SLRU_H
+#define CACHE_SLRU_H
+
+#include "../elementos/Elemento.h"
+#include "ListaDuplamenteEncadeada.h"
+#include <functional>
+#include <memory>
+
+/**
+ * @brief Cache LRU segmentado (SLRU) de elementos, indexado pelo ID
+ *
+ * Divide a capacidade em dois segmentos LRU, cada um uma
+ * ListaDuplamenteEncadeada com índice de IDs:
+ * - Probatório: recebe os elementos novos; o despejo sai do fim dele
+ * - Protegido: recebe os elementos acessados de novo enquanto estavam
+ *   no probatório; quando lota, o menos recente volta ao probatório
+ *
+ * Um elemento acessado uma única vez nunca chega ao protegido, então uma
+ * varredura de IDs novos não expulsa os elementos realmente populares,
+ * como aconteceria no CacheLRU.
+ *
+ * Todas as operações são O(1) médio.
+ */
+class CacheSLRU {
+public:
+    /**
+     * @brief Função chamada com cada elemento despejado pelo cache
+     */
+    using CallbackRemocao = std::function<void(std::unique_ptr<Elemento>)>;
+
+private:
+    ListaDuplamenteEncadeada probatorio;  // Acessados uma vez, do mais ao menos recente
+    ListaDuplamenteEncadeada protegido;   // Acessados mais de uma vez, idem
+    int capacidade;                       // Número máximo de elementos nos dois segmentos
+    int capacidadeProtegida;              // Número máximo de elementos no protegido
+    long acertos;                         // Consultas que encontraram o ID
+    long falhas;                          // Consultas que não encontraram o ID
+    long despejos;                        // Elementos retirados por falta de espaço
+    CallbackRemocao aoDespejar;           // Recebe os elementos despejados (pode ser vazio)
+
+    /**
+     * @brief Passa um elemento do probatório para o início do protegido
+     * @return Elemento promovido
+     *
+     * Complexidade: O(1) médio
+     */
+    Elemento* promover(long id);
+
+public:
+    /**
+     * @brief Construtor do cache
+     * @param capacidade Número máximo de elementos (deve ser maior que um)
+     * @param fracaoProtegida Fração da capacidade reservada ao segmento protegido
+     * @throws std::invalid_argument se a capacidade for menor que dois
+     *
+     * O segmento protegido fica com pelo menos um e no máximo
+     * capacidade - 1 elementos, para que o probatório nunca suma.
+     */
+    explicit CacheSLRU(int capacidade, double fracaoProtegida = 0.8);
+
+    /**
+     * @brief Destrutor do cache (não chama o callback)
+     */
+    ~CacheSLRU() = default;
+
+    CacheSLRU(const CacheSLRU& outro) = delete;
+    CacheSLRU& operator=(const CacheSLRU& outro) = delete;
+
+    /**
+     * @brief Consulta um elemento e o marca como o mais recente
+     * @param id ID procurado
+     * @return Ponteiro para o elemento (nullptr em caso de falha)
+     *
+     * Um acerto no probatório promove o elemento ao protegido.
+     *
+     * Complexidade: O(1) médio
+     */
+    Elemento* obter(long id);
+
+    /**
+     * @brief Verifica se um ID está no cache, sem alterar a ordem nem os contadores
+     *
+     * Complexidade: O(1) médio
+     */
+    bool contem(long id) const;
+
+    /**
+     * @brief Insere um elemento no cache
+     * @param elemento Elemento a ser guardado (nulo é ignorado)
+     *
+     * Um ID novo entra no início do probatório, despejando o fim do
+     * probatório se o cache estiver cheio. Um ID já presente tem o
+     * elemento substituído e conta como novo acesso.
+     *
+     * Complexidade: O(1) médio
+     */
+    void inserir(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Retira um elemento do cache (invalidação), sem chamar o callback
+     * @param id ID do elemento
+     * @return Ponteiro único para o elemento (nullptr se não estava no cache)
+     *
+     * Complexidade: O(1) médio
+     */
+    std::unique_ptr<Elemento> remover(long id);
+
+    /**
+     * @brief Define a função chamada com cada elemento despejado
+     */
+    void definirCallbackRemocao(CallbackRemocao callback);
+
+    /**
+     * @brief Retorna o número de elementos no cache
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Retorna o número de elementos no segmento protegido
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanhoProtegido() const;
+
+    /**
+     * @brief Retorna a capacidade do cache
+     *
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const;
+
+    /**
+     * @brief Retorna o número de acertos desde a última zerada
+     */
+    long getAcertos() const;
+
+    /**
+     * @brief Retorna o número de falhas desde a última zerada
+     */
+    long getFalhas() const;
+
+    /**
+     * @brief Retorna o número de despejos desde a última zerada
+     */
+    long getDespejos() const;
+
+    /**
+     * @brief Retorna a fração de consultas que acertaram (0 se não houve consultas)
+     */
+    double getTaxaAcertos() const;
+
+    /**
+     * @brief Zera os contadores de acertos, falhas e despejos
+     */
+    void zerarEstatisticas();
+
+    /**
+     * @brief Esvazia o cache sem chamar o callback
+     *
+     * Complexidade: O(n)
+     */
+    void limpar();
+};
+
+#endif
@@ -19,6 +19,16 @@ void Deque::inserirFim(std::unique_ptr<Elemento> elemento) {
     lista.inserirNoFim(std::move(elemento));
 }
 
+void Deque::inserirTudoNoInicio(Deque& outro) {
+    // Religa a lista dupla de 'outro' inteira antes da frente
+    lista.transferirNoInicio(outro.lista);
+}
+
+void Deque::inserirTudoNoFim(Deque& outro) {
+    // Religa a lista dupla de 'outro' inteira depois do final
+    lista.transferirNoFim(outro.lista);
+}
+
 std::unique_ptr<Elemento> Deque::removerInicio() {
     if (estaVazio()) {
         return nullptr;  // Deque vazio
@@ -26,8 +26,9 @@ private:
 public:
     /**
      * @brief Construtor do deque
+     * @param usarPoolNos Se true, a lista interna aloca os nós por um pool próprio
      */
-    Deque() = default;
+    explicit Deque(bool usarPoolNos = false) : lista(usarPoolNos) {}
     
     /**
      * @brief Destrutor do deque
@@ -60,6 +61,24 @@ public:
      */
     void inserirFim(std::unique_ptr<Elemento> elemento);
     
+    /**
+     * @brief Insere no início, de uma só vez, todos os elementos de outro deque
+     * @param outro Deque que será esvaziado (mantém a ordem dele)
+     * 
+     * Complexidade: O(1) - religa os nós das listas duplas (O(m) se
+     *               alguma delas usar pool de nós)
+     */
+    void inserirTudoNoInicio(Deque& outro);
+    
+    /**
+     * @brief Insere no final, de uma só vez, todos os elementos de outro deque
+     * @param outro Deque que será esvaziado (mantém a ordem dele)
+     * 
+     * Complexidade: O(1) - religa os nós das listas duplas (O(m) se
+     *               alguma delas usar pool de nós)
+     */
+    void inserirTudoNoFim(Deque& outro);
+    
     /**
      * @brief Remove um elemento do início do deque (pop_front)
      * @return Ponteiro único para o elemento removido (nullptr se vazio)
@@ -129,6 +148,17 @@ public:
      * Vantagem específica da lista duplamente encadeada!
      */
     void imprimirDequeReverso() const;
+    
+    /**
+     * @brief Aplica uma função a cada elemento, do início ao fim
+     * @param funcao Chamada como funcao(Elemento&)
+     * 
+     * Complexidade: O(n) - percorre os nós da lista dupla
+     */
+    template<typename Funcao>
+    void paraCada(Funcao funcao) const {
+        lista.paraCada(funcao);
+    }
 };
 
 #endif
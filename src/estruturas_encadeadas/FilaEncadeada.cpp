@@ -1,4 +1,5 @@
 #include "FilaEncadeada.h"
+#include "PilhaEncadeada.h"
 #include "../../ConfigLocale.h"
 
 void FilaEncadeada::enfileirar(std::unique_ptr<Elemento> elemento) {
@@ -19,6 +20,26 @@ std::unique_ptr<Elemento> FilaEncadeada::desenfileirar() {
     return lista.removerPrimeiro();
 }
 
+int FilaEncadeada::enfileirarLote(std::unique_ptr<Elemento>* lote, int quantidade) {
+    // Inserir o lote inteiro no final da lista (final da fila)
+    return lista.inserirLoteNoFim(lote, quantidade);
+}
+
+void FilaEncadeada::enfileirarTudo(FilaEncadeada& outra) {
+    // Os nós de 'outra' entram inteiros no final da lista (final da fila)
+    lista.transferirNoFim(outra.lista);
+}
+
+void FilaEncadeada::enfileirarTudo(PilhaEncadeada& pilha) {
+    // O topo da pilha é o início da lista dela: entra primeiro no final da fila
+    lista.transferirNoFim(pilha.lista);
+}
+
+int FilaEncadeada::desenfileirarLote(std::unique_ptr<Elemento>* saida, int maxN) {
+    // Remover do início da lista (frente da fila) até maxN elementos
+    return lista.removerPrimeiros(saida, maxN);
+}
+
 Elemento* FilaEncadeada::frente() const {
     if (estaVazia()) {
         return nullptr;  // Fila vazia
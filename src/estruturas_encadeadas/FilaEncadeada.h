@@ -5,6 +5,8 @@
 #include "ListaSimplesmenteEncadeada.h"
 #include <memory>
 
+class PilhaEncadeada;
+
 /**
  * @brief Adaptador de Fila usando Lista Simplesmente Encadeada
  * 
@@ -21,12 +23,15 @@
 class FilaEncadeada {
 private:
     ListaSimplesmenteEncadeada lista;  // Composição: adaptador da lista
+    
+    friend class PilhaEncadeada;       // Transferências em bloco usam a lista interna
 
 public:
     /**
      * @brief Construtor da fila
+     * @param usarPoolNos Se true, a lista interna aloca os nós por um pool próprio
      */
-    FilaEncadeada() = default;
+    explicit FilaEncadeada(bool usarPoolNos = false) : lista(usarPoolNos) {}
     
     /**
      * @brief Destrutor da fila
@@ -59,6 +64,49 @@ public:
      */
     std::unique_ptr<Elemento> desenfileirar();
     
+    /**
+     * @brief Enfileira um lote de elementos de uma só vez
+     * @param lote Array de elementos a serem enfileirados (nulos são ignorados)
+     * @param quantidade Número de elementos no array
+     * @return Número de elementos enfileirados
+     * 
+     * Complexidade: O(k) - encadeia o lote e liga à cauda uma única vez
+     */
+    int enfileirarLote(std::unique_ptr<Elemento>* lote, int quantidade);
+    
+    /**
+     * @brief Enfileira de uma só vez todos os elementos de outra fila
+     * @param outra Fila que será esvaziada
+     * 
+     * Os elementos de 'outra' entram no final, na ordem em que estavam.
+     * 
+     * Complexidade: O(1) - religa os nós das listas (O(m) se alguma
+     *               delas usar pool de nós)
+     */
+    void enfileirarTudo(FilaEncadeada& outra);
+    
+    /**
+     * @brief Enfileira de uma só vez todos os elementos de uma pilha
+     * @param pilha Pilha que será esvaziada
+     * 
+     * O topo da pilha entra primeiro, como se cada elemento fosse
+     * desempilhado e enfileirado em seguida.
+     * 
+     * Complexidade: O(1) - religa os nós das listas (O(m) se alguma
+     *               delas usar pool de nós)
+     */
+    void enfileirarTudo(PilhaEncadeada& pilha);
+    
+    /**
+     * @brief Desenfileira até maxN elementos de uma só vez
+     * @param saida Array que recebe os elementos (frente da fila primeiro)
+     * @param maxN Número máximo de elementos a remover
+     * @return Número de elementos efetivamente removidos
+     * 
+     * Complexidade: O(k) - remoções sucessivas do início
+     */
+    int desenfileirarLote(std::unique_ptr<Elemento>* saida, int maxN);
+    
     /**
      * @brief Consulta o elemento da frente sem removê-lo (front)
      * @return Ponteiro para o elemento da frente (nullptr se vazia)
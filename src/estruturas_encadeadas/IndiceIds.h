@@ -0,0 +1,119 @@
+#ifndef INDICE_IDS_H
+#define INDICE_IDS_H
+
+#include <cstddef>
+#include <unordered_map>
+
+/**
+ * @brief Índice hash ID -> nó para as listas encadeadas
+ *
+ * Mantido pela lista a cada inserção e remoção, permite achar o nó de
+ * um ID em O(1) médio. As listas aceitam IDs repetidos e, nesse caso,
+ * as operações por ID valem para a primeira ocorrência; como o índice
+ * guarda um só nó por ID, um ID que aparece repetido passa a ser
+ * marcado como ambíguo (nó nulo) e a lista volta à busca linear para
+ * ele. Com IDs únicos, que é o uso normal, isso nunca acontece.
+ *
+ * @tparam No Tipo do nó da lista; precisa de um membro 'dados' com o elemento
+ */
+template<typename No>
+class IndiceIds {
+private:
+    std::unordered_map<long, No*> nos;    // ID -> nó (nullptr = ID repetido)
+    int ambiguos;                         // IDs marcados como repetidos
+
+public:
+    IndiceIds() : ambiguos(0) {}
+
+    /**
+     * @brief Registra um nó que acabou de entrar na lista
+     *
+     * Complexidade: O(1) médio
+     */
+    void registrar(No* no) {
+        if (!no->dados) {
+            return;
+        }
+        auto resultado = nos.emplace(no->dados->getID(), no);
+        if (!resultado.second && resultado.first->second) {
+            resultado.first->second = nullptr;
+            ambiguos++;
+        }
+    }
+
+    /**
+     * @brief Retira um nó do índice (antes de o elemento sair do nó)
+     *
+     * Complexidade: O(1) médio
+     */
+    void desregistrar(No* no) {
+        if (!no->dados) {
+            return;
+        }
+        auto it = nos.find(no->dados->getID());
+        if (it != nos.end() && it->second == no) {
+            nos.erase(it);
+        }
+    }
+
+    /**
+     * @brief Informa que o elemento de um nó foi movido para outro nó
+     * @param de Nó de onde o elemento saiu
+     * @param para Nó que agora guarda o elemento
+     *
+     * Complexidade: O(1) médio
+     */
+    void mover(No* de, No* para) {
+        if (!para->dados) {
+            return;
+        }
+        auto it = nos.find(para->dados->getID());
+        if (it != nos.end() && it->second == de) {
+            it->second = para;
+        }
+    }
+
+    /**
+     * @brief Consulta o índice
+     * @param id ID procurado
+     * @param no Recebe o nó (nullptr se o ID não está na lista)
+     * @return false se o ID é ambíguo e a lista precisa buscar linearmente
+     *
+     * Complexidade: O(1) médio
+     */
+    bool procurar(long id, No*& no) const {
+        auto it = nos.find(id);
+        if (it == nos.end()) {
+            no = nullptr;
+            return true;
+        }
+        no = it->second;
+        return no != nullptr;
+    }
+
+    /**
+     * @brief Reserva espaço para uma quantidade de IDs
+     */
+    void reservar(std::size_t quantidade) {
+        nos.reserve(quantidade);
+    }
+
+    /**
+     * @brief Esvazia o índice
+     */
+    void limpar() {
+        nos.clear();
+        ambiguos = 0;
+    }
+
+    /**
+     * @brief Retorna quantos IDs foram marcados como repetidos
+     *
+     * Complexidade: O(1)
+     */
+    int getAmbiguos() const {
+        return ambiguos;
+    }
+};
+
+#endif
@@ -0,0 +1,299 @@
+#ifndef INDICE_POSICIONAL_H
+#define INDICE_POSICIONAL_H
+
+#include <memory>
+#include <random>
+
+/**
+ * @brief Índice posicional em skip list (com larguras) sobre uma lista encadeada
+ *
+ * Cada nó da lista ganha, com probabilidade 1/2, uma torre de altura
+ * geométrica. Cada nível da torre aponta para a próxima torre do mesmo
+ * nível e guarda a largura do salto (quantas posições ele avança), o que
+ * permite descer pelos níveis somando larguras até a posição pedida.
+ * O último trecho é percorrido na própria lista, a partir do nó da torre
+ * (em média dois passos).
+ *
+ * O índice não é dono dos nós: a lista chama aoInserir/aoRemover a cada
+ * mudança de estrutura para manter as larguras corretas.
+ *
+ * Posições: a cabeça do índice fica na posição -1 e o fim virtual na
+ * posição n; o último salto de cada nível vai até esse fim virtual.
+ *
+ * @tparam No Tipo do nó da lista; precisa de um membro 'proximo' com get()
+ */
+template<typename No>
+class IndicePosicional {
+public:
+    static constexpr int MAX_NIVEIS = 32;
+
+private:
+    class Torre;
+
+    /**
+     * @brief Um nível de uma torre: salto para a próxima torre e sua largura
+     */
+    struct Nivel {
+        Torre* proximo;    // Próxima torre neste nível (nullptr = fim virtual)
+        int largura;       // Posições avançadas pelo salto
+    };
+
+    /**
+     * @brief Torre de um nó indexado
+     */
+    class Torre {
+    public:
+        No* no;                             // Nó da lista (nullptr na cabeça do índice)
+        std::unique_ptr<Nivel[]> niveis;    // Um Nivel por andar da torre
+
+        Torre(No* no, int altura) : no(no), niveis(new Nivel[altura]) {
+            for (int i = 0; i < altura; i++) {
+                niveis[i].proximo = nullptr;
+                niveis[i].largura = 0;
+            }
+        }
+    };
+
+    Torre cabeca;             // Torre de altura máxima na posição -1
+    int tamanho;              // Elementos indexados (igual ao tamanho da lista)
+    int nivelMaisAlto;        // Número de níveis com alguma torre
+    std::mt19937 gerador;     // Sorteio das alturas
+
+    /**
+     * @brief Sorteia a altura de uma torre (0 = nó sem torre)
+     *
+     * Cada nível é mantido com probabilidade 1/2: conta os bits 1
+     * consecutivos a partir do menos significativo.
+     */
+    int sortearAltura() {
+        unsigned bits = static_cast<unsigned>(gerador());
+        int altura = 0;
+        while ((bits & 1u) && altura < MAX_NIVEIS) {
+            altura++;
+            bits >>= 1;
+        }
+        return altura;
+    }
+
+    /**
+     * @brief Encontra, em cada nível, a última torre antes de uma posição
+     * @param posicao Posição de referência
+     * @param atualizar Recebe a torre de cada nível
+     * @param posicoes Recebe a posição de cada torre encontrada
+     *
+     * Complexidade: O(log n) esperado
+     */
+    void localizarAntecessores(int posicao, Torre** atualizar, int* posicoes) {
+        Torre* torre = &cabeca;
+        int atual = -1;
+        for (int nivel = MAX_NIVEIS - 1; nivel >= 0; nivel--) {
+            while (torre->niveis[nivel].proximo && atual + torre->niveis[nivel].largura < posicao) {
+                atual += torre->niveis[nivel].largura;
+                torre = torre->niveis[nivel].proximo;
+            }
+            atualizar[nivel] = torre;
+            posicoes[nivel] = atual;
+        }
+    }
+
+    /**
+     * @brief Destrói todas as torres e zera as larguras da cabeça
+     */
+    void descartarTorres() {
+        Torre* torre = cabeca.niveis[0].proximo;
+        while (torre) {
+            Torre* proxima = torre->niveis[0].proximo;
+            delete torre;
+            torre = proxima;
+        }
+        for (int nivel = 0; nivel < MAX_NIVEIS; nivel++) {
+            cabeca.niveis[nivel].proximo = nullptr;
+            cabeca.niveis[nivel].largura = 1;    // Da posição -1 ao fim virtual 0
+        }
+        tamanho = 0;
+        nivelMaisAlto = 0;
+    }
+
+public:
+    /**
+     * @brief Construtor do índice vazio
+     * @param semente Semente do sorteio das alturas
+     */
+    explicit IndicePosicional(unsigned semente = 12345u)
+        : cabeca(nullptr, MAX_NIVEIS), tamanho(0), nivelMaisAlto(0), gerador(semente) {
+        descartarTorres();
+    }
+
+    /**
+     * @brief Destrutor - libera as torres (os nós pertencem à lista)
+     */
+    ~IndicePosicional() {
+        descartarTorres();
+    }
+
+    IndicePosicional(const IndicePosicional& outro) = delete;
+    IndicePosicional& operator=(const IndicePosicional& outro) = delete;
+
+    /**
+     * @brief Reconstrói o índice a partir de uma lista existente
+     * @param primeiro Primeiro nó da lista
+     * @param quantidade Número de nós da lista
+     *
+     * Complexidade: O(n)
+     */
+    void reconstruir(No* primeiro, int quantidade) {
+        descartarTorres();
+
+        Torre* ultimas[MAX_NIVEIS];
+        int posicoes[MAX_NIVEIS];
+        for (int nivel = 0; nivel < MAX_NIVEIS; nivel++) {
+            ultimas[nivel] = &cabeca;
+            posicoes[nivel] = -1;
+        }
+
+        int posicao = 0;
+        for (No* no = primeiro; no; no = no->proximo.get(), posicao++) {
+            int altura = sortearAltura();
+            if (altura == 0) {
+                continue;
+            }
+            Torre* torre = new Torre(no, altura);
+            for (int nivel = 0; nivel < altura; nivel++) {
+                ultimas[nivel]->niveis[nivel].proximo = torre;
+                ultimas[nivel]->niveis[nivel].largura = posicao - posicoes[nivel];
+                ultimas[nivel] = torre;
+                posicoes[nivel] = posicao;
+            }
+            if (altura > nivelMaisAlto) {
+                nivelMaisAlto = altura;
+            }
+        }
+
+        for (int nivel = 0; nivel < MAX_NIVEIS; nivel++) {
+            ultimas[nivel]->niveis[nivel].largura = quantidade - posicoes[nivel];
+        }
+        tamanho = quantidade;
+    }
+
+    /**
+     * @brief Localiza o nó de uma posição válida
+     * @param primeiro Primeiro nó da lista
+     * @param posicao Posição desejada (0 <= posicao < tamanho)
+     * @return Nó da posição
+     *
+     * Complexidade: O(log n) esperado
+     */
+    No* localizar(No* primeiro, int posicao) const {
+        const Torre* torre = &cabeca;
+        int atual = -1;
+        for (int nivel = nivelMaisAlto - 1; nivel >= 0; nivel--) {
+            while (torre->niveis[nivel].proximo && atual + torre->niveis[nivel].largura <= posicao) {
+                atual += torre->niveis[nivel].largura;
+                torre = torre->niveis[nivel].proximo;
+            }
+        }
+
+        // Completa o trajeto pela lista, a partir do nó da torre (ou do início)
+        No* no = primeiro;
+        if (torre != &cabeca) {
+            no = torre->no;
+        } else {
+            atual = 0;
+        }
+        for (; atual < posicao; atual++) {
+            no = no->proximo.get();
+        }
+        return no;
+    }
+
+    /**
+     * @brief Registra um nó que acabou de entrar na lista
+     * @param posicao Posição do novo nó
+     * @param no Novo nó
+     *
+     * Complexidade: O(log n) esperado
+     */
+    void aoInserir(int posicao, No* no) {
+        Torre* atualizar[MAX_NIVEIS];
+        int posicoes[MAX_NIVEIS];
+        localizarAntecessores(posicao, atualizar, posicoes);
+
+        int altura = sortearAltura();
+        Torre* nova = altura > 0 ? new Torre(no, altura) : nullptr;
+        for (int nivel = 0; nivel < MAX_NIVEIS; nivel++) {
+            Nivel& anterior = atualizar[nivel]->niveis[nivel];
+            if (nivel < altura) {
+                // A nova torre divide o salto do antecessor em dois
+                nova->niveis[nivel].proximo = anterior.proximo;
+                nova->niveis[nivel].largura = posicoes[nivel] + anterior.largura + 1 - posicao;
+                anterior.proximo = nova;
+                anterior.largura = posicao - posicoes[nivel];
+            } else {
+                anterior.largura++;
+            }
+        }
+
+        if (altura > nivelMaisAlto) {
+            nivelMaisAlto = altura;
+        }
+        tamanho++;
+    }
+
+    /**
+     * @brief Registra a saída do nó de uma posição (antes de ele ser destruído)
+     * @param posicao Posição do nó que sai
+     *
+     * Complexidade: O(log n) esperado
+     */
+    void aoRemover(int posicao) {
+        Torre* atualizar[MAX_NIVEIS];
+        int posicoes[MAX_NIVEIS];
+        localizarAntecessores(posicao, atualizar, posicoes);
+
+        Torre* removida = nullptr;
+        for (int nivel = 0; nivel < MAX_NIVEIS; nivel++) {
+            Nivel& anterior = atualizar[nivel]->niveis[nivel];
+            Torre* seguinte = anterior.proximo;
+            if (seguinte && posicoes[nivel] + anterior.largura == posicao) {
+                // O salto passa a ir direto para além da torre removida
+                anterior.largura += seguinte->niveis[nivel].largura - 1;
+                anterior.proximo = seguinte->niveis[nivel].proximo;
+                removida = seguinte;
+            } else {
+                anterior.largura--;
+            }
+        }
+
+        delete removida;
+        tamanho--;
+    }
+
+    /**
+     * @brief Remove todas as torres
+     *
+     * Complexidade: O(t) - t é o número de torres
+     */
+    void limpar() {
+        descartarTorres();
+    }
+
+    /**
+     * @brief Retorna quantos elementos o índice cobre
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const {
+        return tamanho;
+    }
+
+    /**
+     * @brief Retorna a altura da torre mais alta já criada
+     *
+     * Complexidade: O(1)
+     */
+    int getNiveis() const {
+        return nivelMaisAlto;
+    }
+};
+
+#endif
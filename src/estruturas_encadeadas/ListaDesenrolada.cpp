@@ -0,0 +1,304 @@
+#include "ListaDesenrolada.h"
+#include <iostream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+ListaDesenrolada::ListaDesenrolada()
+    : cabeca(nullptr), cauda(nullptr), tamanho(0), blocos(0) {
+}
+
+ListaDesenrolada::~ListaDesenrolada() {
+    limpar();
+}
+
+int ListaDesenrolada::procurarNoBloco(const Bloco* bloco, long id) {
+    unsigned mascara = 0;
+#if defined(__SSE2__)
+    const __m128i alvo = _mm_set1_epi64x(static_cast<long long>(id));
+    for (int i = 0; i < CAPACIDADE_BLOCO; i += 2) {
+        __m128i ids = _mm_load_si128(reinterpret_cast<const __m128i*>(&bloco->ids[i]));
+        // SSE2 só compara 32 bits por vez: as duas metades de cada ID precisam bater
+        __m128i igual32 = _mm_cmpeq_epi32(ids, alvo);
+        __m128i igual64 = _mm_and_si128(igual32, _mm_shuffle_epi32(igual32, _MM_SHUFFLE(2, 3, 0, 1)));
+        mascara |= static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(igual64))) << i;
+    }
+#else
+    for (int i = 0; i < CAPACIDADE_BLOCO; i++) {
+        mascara |= static_cast<unsigned>(bloco->ids[i] == id) << i;
+    }
+#endif
+
+    // Descarta posições fora do intervalo ocupado (podem ter IDs antigos)
+    mascara &= ((1u << bloco->quantidade) - 1) << bloco->inicio;
+    if (mascara == 0) {
+        return -1;
+    }
+    return __builtin_ctz(mascara);
+}
+
+std::unique_ptr<Elemento> ListaDesenrolada::retirar(Bloco* anterior, Bloco* bloco, int posicao) {
+    auto elementoRemovido = std::move(bloco->elementos[posicao]);
+
+    // Fecha o buraco deslocando o lado menor do bloco
+    int fim = bloco->inicio + bloco->quantidade;
+    if (posicao - bloco->inicio < fim - 1 - posicao) {
+        for (int i = posicao; i > bloco->inicio; i--) {
+            bloco->elementos[i] = std::move(bloco->elementos[i - 1]);
+            bloco->ids[i] = bloco->ids[i - 1];
+        }
+        bloco->inicio++;
+    } else {
+        for (int i = posicao; i < fim - 1; i++) {
+            bloco->elementos[i] = std::move(bloco->elementos[i + 1]);
+            bloco->ids[i] = bloco->ids[i + 1];
+        }
+    }
+    bloco->quantidade--;
+    tamanho--;
+
+    // Bloco vazio sai da lista
+    if (bloco->quantidade == 0) {
+        if (anterior) {
+            if (cauda == bloco) {
+                cauda = anterior;
+            }
+            anterior->proximo = std::move(bloco->proximo);
+        } else {
+            cabeca = std::move(cabeca->proximo);
+            if (!cabeca) {
+                cauda = nullptr;
+            }
+        }
+        blocos--;
+    } else if (bloco->quantidade < CAPACIDADE_BLOCO / 2 && bloco->proximo) {
+        reequilibrar(bloco);
+    }
+
+    return elementoRemovido;
+}
+
+void ListaDesenrolada::compactar(Bloco* bloco) {
+    if (bloco->inicio == 0) {
+        return;
+    }
+    for (int i = 0; i < bloco->quantidade; i++) {
+        bloco->elementos[i] = std::move(bloco->elementos[bloco->inicio + i]);
+        bloco->ids[i] = bloco->ids[bloco->inicio + i];
+    }
+    bloco->inicio = 0;
+}
+
+void ListaDesenrolada::reequilibrar(Bloco* bloco) {
+    Bloco* proximo = bloco->proximo.get();
+
+    // Cabem os dois: o sucessor é absorvido e sai da lista
+    // Senão: recebe metade da diferença, os dois ficam com mais de CAPACIDADE_BLOCO / 2
+    int transferidos = bloco->quantidade + proximo->quantidade <= CAPACIDADE_BLOCO
+                     ? proximo->quantidade
+                     : (proximo->quantidade - bloco->quantidade) / 2;
+
+    if (bloco->inicio + bloco->quantidade + transferidos > CAPACIDADE_BLOCO) {
+        compactar(bloco);
+    }
+    int destino = bloco->inicio + bloco->quantidade;
+    for (int i = 0; i < transferidos; i++) {
+        bloco->elementos[destino + i] = std::move(proximo->elementos[proximo->inicio + i]);
+        bloco->ids[destino + i] = proximo->ids[proximo->inicio + i];
+    }
+    bloco->quantidade += transferidos;
+    proximo->inicio += transferidos;
+    proximo->quantidade -= transferidos;
+
+    if (proximo->quantidade == 0) {
+        if (cauda == proximo) {
+            cauda = bloco;
+        }
+        bloco->proximo = std::move(proximo->proximo);
+        blocos--;
+    }
+}
+
+void ListaDesenrolada::inserirNoInicio(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    if (!cabeca || cabeca->inicio == 0) {
+        // Sem folga à esquerda: novo bloco preenchido de trás para frente
+        auto novoBloco = std::make_unique<Bloco>(CAPACIDADE_BLOCO);
+        if (!cabeca) {
+            cauda = novoBloco.get();
+        }
+        novoBloco->proximo = std::move(cabeca);
+        cabeca = std::move(novoBloco);
+        blocos++;
+    }
+
+    Bloco* bloco = cabeca.get();
+    bloco->inicio--;
+    bloco->quantidade++;
+    bloco->ids[bloco->inicio] = elemento->getID();
+    bloco->elementos[bloco->inicio] = std::move(elemento);
+    tamanho++;
+}
+
+void ListaDesenrolada::inserirNoFim(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+
+    if (!cauda || cauda->inicio + cauda->quantidade == CAPACIDADE_BLOCO) {
+        // Sem folga à direita: novo bloco preenchido da frente para trás
+        auto novoBloco = std::make_unique<Bloco>(0);
+        Bloco* novoBlocoPtr = novoBloco.get();
+        if (cauda) {
+            cauda->proximo = std::move(novoBloco);
+        } else {
+            cabeca = std::move(novoBloco);
+        }
+        cauda = novoBlocoPtr;
+        blocos++;
+    }
+
+    int posicao = cauda->inicio + cauda->quantidade;
+    cauda->ids[posicao] = elemento->getID();
+    cauda->elementos[posicao] = std::move(elemento);
+    cauda->quantidade++;
+    tamanho++;
+}
+
+std::unique_ptr<Elemento> ListaDesenrolada::removerPeloId(long id) {
+    Bloco* anterior = nullptr;
+    for (Bloco* bloco = cabeca.get(); bloco; bloco = bloco->proximo.get()) {
+        int posicao = procurarNoBloco(bloco, id);
+        if (posicao >= 0) {
+            return retirar(anterior, bloco, posicao);
+        }
+        anterior = bloco;
+    }
+    return nullptr;
+}
+
+Elemento* ListaDesenrolada::buscarPeloId(long id) const {
+    for (const Bloco* bloco = cabeca.get(); bloco; bloco = bloco->proximo.get()) {
+        int posicao = procurarNoBloco(bloco, id);
+        if (posicao >= 0) {
+            return bloco->elementos[posicao].get();
+        }
+    }
+    return nullptr;
+}
+
+bool ListaDesenrolada::alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento) {
+    if (!novoElemento) {
+        return false;
+    }
+
+    for (Bloco* bloco = cabeca.get(); bloco; bloco = bloco->proximo.get()) {
+        int posicao = procurarNoBloco(bloco, id);
+        if (posicao >= 0) {
+            // O novo elemento pode ter outro ID: atualizar o cache
+            bloco->ids[posicao] = novoElemento->getID();
+            bloco->elementos[posicao] = std::move(novoElemento);
+            return true;
+        }
+    }
+    return false;
+}
+
+Elemento* ListaDesenrolada::getPrimeiro() const {
+    if (estaVazia()) {
+        return nullptr;
+    }
+
+    return cabeca->elementos[cabeca->inicio].get();
+}
+
+std::unique_ptr<Elemento> ListaDesenrolada::removerPrimeiro() {
+    if (estaVazia()) {
+        return nullptr;
+    }
+
+    return retirar(nullptr, cabeca.get(), cabeca->inicio);
+}
+
+std::unique_ptr<Elemento> ListaDesenrolada::removerUltimo() {
+    if (estaVazia()) {
+        return nullptr;
+    }
+
+    // O bloco anterior só é necessário se a cauda for esvaziar
+    Bloco* anterior = nullptr;
+    if (cauda->quantidade == 1 && cauda != cabeca.get()) {
+        anterior = cabeca.get();
+        while (anterior->proximo.get() != cauda) {
+            anterior = anterior->proximo.get();
+        }
+    }
+
+    return retirar(anterior, cauda, cauda->inicio + cauda->quantidade - 1);
+}
+
+int ListaDesenrolada::getTamanho() const {
+    return tamanho;
+}
+
+int ListaDesenrolada::getBlocos() const {
+    return blocos;
+}
+
+bool ListaDesenrolada::estaVazia() const {
+    return cabeca == nullptr;
+}
+
+void ListaDesenrolada::imprimirLista() const {
+    if (estaVazia()) {
+        std::cout << "Lista Desenrolada vazia!" << std::endl;
+        return;
+    }
+
+    std::cout << "=== LISTA DESENROLADA ===" << std::endl;
+    std::cout << "Tamanho: " << tamanho << " | Blocos: " << blocos << std::endl;
+
+    int posicao = 0;
+    for (const Bloco* bloco = cabeca.get(); bloco; bloco = bloco->proximo.get()) {
+        int fim = bloco->inicio + bloco->quantidade;
+        for (int i = bloco->inicio; i < fim; i++) {
+            std::cout << "[" << posicao << "] ";
+            bloco->elementos[i]->imprimirInfo();
+            std::cout << std::endl;
+            posicao++;
+        }
+    }
+
+    std::cout << "=== FIM DA LISTA ===" << std::endl;
+}
+
+void ListaDesenrolada::limpar() {
+    // Cada bloco é destruído já sem sucessor, evitando a recursão em 'proximo'
+    std::unique_ptr<Bloco> atual = std::move(cabeca);
+    while (atual) {
+        atual = std::move(atual->proximo);
+    }
+
+    cauda = nullptr;
+    tamanho = 0;
+    blocos = 0;
+}
+
+Elemento* ListaDesenrolada::obterElementoPorPosicao(int posicao) const {
+    if (posicao < 0 || posicao >= tamanho) {
+        return nullptr;
+    }
+
+    // Salta blocos inteiros até o que contém a posição
+    const Bloco* bloco = cabeca.get();
+    while (posicao >= bloco->quantidade) {
+        posicao -= bloco->quantidade;
+        bloco = bloco->proximo.get();
+    }
+
+    return bloco->elementos[bloco->inicio + posicao].get();
+}
@@ -0,0 +1,258 @@
+#ifndef LISTA_DESENROLADA_H
+#define LISTA_DESENROLADA_H
+
+#include "../elementos/Elemento.h"
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Lista simplesmente encadeada desenrolada (unrolled linked list)
+ *
+ * Variante da ListaSimplesmenteEncadeada em que cada nó (bloco) guarda
+ * até CAPACIDADE_BLOCO elementos e uma cópia dos seus IDs em um array
+ * contíguo. Buscas por ID comparam os IDs do bloco em lote (SSE2 quando
+ * disponível) sem tocar nos elementos, e os percursos saltam de bloco em
+ * bloco em vez de um salto de ponteiro por elemento.
+ *
+ * Dentro do bloco os elementos ocupam o intervalo [inicio, inicio + quantidade):
+ * inserções no início preenchem o bloco da cabeça de trás para frente e
+ * inserções no fim preenchem o bloco da cauda para frente, ambas em O(1).
+ * Os IDs dos elementos não mudam depois de construídos, então o cache
+ * de IDs só é atualizado quando um elemento entra no bloco.
+ *
+ * Remoções mantêm os blocos cheios pela metade: quando um bloco que tem
+ * sucessor fica com menos de CAPACIDADE_BLOCO / 2 elementos, ele absorve
+ * o sucessor se os dois couberem em um bloco, ou recebe elementos do
+ * início dele. Sem isso, remoções espalhadas deixariam blocos de 16
+ * posições com um elemento cada, e os percursos voltariam a dar um
+ * salto de ponteiro por elemento.
+ */
+class ListaDesenrolada {
+public:
+    static constexpr int CAPACIDADE_BLOCO = 16;
+
+private:
+    /**
+     * @brief Bloco da lista - CLASSE PRIVADA (Encapsulamento)
+     */
+    class Bloco {
+    public:
+        alignas(64) std::int64_t ids[CAPACIDADE_BLOCO];          // IDs em cache, contíguos
+        std::unique_ptr<Elemento> elementos[CAPACIDADE_BLOCO];  // Elementos do bloco
+        std::unique_ptr<Bloco> proximo;                         // Próximo bloco
+        int inicio;                                             // Primeira posição ocupada
+        int quantidade;                                         // Posições ocupadas
+
+        /**
+         * @brief Construtor do bloco
+         * @param inicio Posição onde o primeiro elemento será colocado
+         */
+        explicit Bloco(int inicio) : ids(), proximo(nullptr), inicio(inicio), quantidade(0) {}
+    };
+
+    std::unique_ptr<Bloco> cabeca;    // Primeiro bloco
+    Bloco* cauda;                     // Último bloco (raw pointer para evitar ciclos)
+    int tamanho;                      // Número de elementos
+    int blocos;                       // Número de blocos
+
+    /**
+     * @brief Procura um ID entre as posições ocupadas de um bloco
+     * @return Posição no bloco (-1 se não encontrado)
+     *
+     * Complexidade: O(1) - CAPACIDADE_BLOCO comparações, duas por instrução SSE2
+     */
+    static int procurarNoBloco(const Bloco* bloco, long id);
+
+    /**
+     * @brief Retira a posição de um bloco, fechando o buraco
+     * @return Elemento retirado
+     *
+     * Desliga o bloco se ele ficar vazio; 'anterior' é o bloco que
+     * o precede (nullptr se for a cabeça). Se ele ficar abaixo da
+     * metade, chama reequilibrar.
+     */
+    std::unique_ptr<Elemento> retirar(Bloco* anterior, Bloco* bloco, int posicao);
+
+    /**
+     * @brief Junta o bloco com o sucessor, ou passa elementos do sucessor para ele
+     *
+     * Complexidade: O(CAPACIDADE_BLOCO)
+     */
+    void reequilibrar(Bloco* bloco);
+
+    /**
+     * @brief Move os elementos do bloco para o começo do array (inicio = 0)
+     */
+    static void compactar(Bloco* bloco);
+
+public:
+    /**
+     * @brief Construtor da lista
+     */
+    ListaDesenrolada();
+
+    /**
+     * @brief Destrutor da lista
+     *
+     * Complexidade: O(n) - libera os blocos de forma iterativa
+     */
+    ~ListaDesenrolada();
+
+    ListaDesenrolada(const ListaDesenrolada& outra) = delete;
+    ListaDesenrolada& operator=(const ListaDesenrolada& outra) = delete;
+
+    /**
+     * @brief Insere elemento no início da lista
+     * @param elemento Ponteiro único para o elemento a ser inserido (nulo é ignorado)
+     *
+     * Complexidade: O(1) - usa a folga do bloco da cabeça ou cria um bloco
+     */
+    void inserirNoInicio(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Insere elemento no final da lista
+     * @param elemento Ponteiro único para o elemento a ser inserido (nulo é ignorado)
+     *
+     * Complexidade: O(1) - usa a folga do bloco da cauda ou cria um bloco
+     */
+    void inserirNoFim(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Remove elemento com ID específico
+     * @param id ID do elemento a ser removido
+     * @return Ponteiro único para o elemento removido (nullptr se não encontrado)
+     *
+     * Complexidade: O(n) - busca nos IDs em cache + deslocamento dentro de um bloco
+     */
+    std::unique_ptr<Elemento> removerPeloId(long id);
+
+    /**
+     * @brief Busca elemento pelo ID
+     * @param id ID do elemento procurado
+     * @return Ponteiro para o elemento (nullptr se não encontrado)
+     *
+     * Complexidade: O(n) - mas só lê os IDs em cache, bloco a bloco
+     */
+    Elemento* buscarPeloId(long id) const;
+
+    /**
+     * @brief Altera elemento com ID específico
+     * @param id ID do elemento a ser alterado
+     * @param novoElemento Novo elemento para substituir o existente
+     * @return true se a alteração foi bem-sucedida, false se ID não encontrado
+     *
+     * Complexidade: O(n) - busca nos IDs em cache
+     */
+    bool alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento);
+
+    /**
+     * @brief Obtém o primeiro elemento da lista sem removê-lo
+     * @return Ponteiro para o primeiro elemento (nullptr se lista vazia)
+     *
+     * Complexidade: O(1)
+     */
+    Elemento* getPrimeiro() const;
+
+    /**
+     * @brief Remove o primeiro elemento da lista
+     * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Elemento> removerPrimeiro();
+
+    /**
+     * @brief Remove o último elemento da lista
+     * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
+     *
+     * Complexidade: O(1) se o bloco da cauda não esvaziar; senão O(n / CAPACIDADE_BLOCO)
+     *               para achar o penúltimo bloco
+     */
+    std::unique_ptr<Elemento> removerUltimo();
+
+    /**
+     * @brief Retorna o número de elementos na lista
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Retorna o número de blocos alocados
+     *
+     * Complexidade: O(1)
+     */
+    int getBlocos() const;
+
+    /**
+     * @brief Verifica se a lista está vazia
+     *
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const;
+
+    /**
+     * @brief Imprime todos os elementos da lista
+     *
+     * Complexidade: O(n)
+     */
+    void imprimirLista() const;
+
+    /**
+     * @brief Limpa todos os elementos da lista
+     *
+     * Complexidade: O(n) - sem recursão
+     */
+    void limpar();
+
+    /**
+     * @brief Obtém elemento por posição
+     * @param posicao Posição do elemento (0-based)
+     * @return Ponteiro para o elemento (nullptr se posição inválida)
+     *
+     * Complexidade: O(n / CAPACIDADE_BLOCO) - salta blocos inteiros
+     */
+    Elemento* obterElementoPorPosicao(int posicao) const;
+
+    /**
+     * @brief Conta quantos elementos satisfazem uma condição
+     * @param condicao Função chamada como condicao(const Elemento*)
+     * @return Número de elementos que satisfazem a condição
+     *
+     * Complexidade: O(n) - os ponteiros de cada bloco são contíguos
+     */
+    template<typename Condicao>
+    int contarElementos(Condicao condicao) const {
+        int contador = 0;
+        for (const Bloco* bloco = cabeca.get(); bloco; bloco = bloco->proximo.get()) {
+            int fim = bloco->inicio + bloco->quantidade;
+            for (int i = bloco->inicio; i < fim; i++) {
+                if (condicao(bloco->elementos[i].get())) {
+                    contador++;
+                }
+            }
+        }
+        return contador;
+    }
+
+    /**
+     * @brief Conta quantos IDs satisfazem uma condição, sem tocar nos elementos
+     * @param condicao Função chamada como condicao(long id)
+     * @return Número de elementos cujo ID satisfaz a condição
+     *
+     * Complexidade: O(n) - lê apenas os IDs em cache
+     */
+    template<typename Condicao>
+    int contarPorId(Condicao condicao) const {
+        int contador = 0;
+        for (const Bloco* bloco = cabeca.get(); bloco; bloco = bloco->proximo.get()) {
+            int fim = bloco->inicio + bloco->quantidade;
+            for (int i = bloco->inicio; i < fim; i++) {
+                contador += condicao(static_cast<long>(bloco->ids[i])) ? 1 : 0;
+            }
+        }
+        return contador;
+    }
+};
+
+#endif
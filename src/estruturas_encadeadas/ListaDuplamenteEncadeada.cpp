@@ -1,12 +1,18 @@
 #include "ListaDuplamenteEncadeada.h"
+#include <cstdlib>
 #include <iostream>
 
-ListaDuplamenteEncadeada::ListaDuplamenteEncadeada() 
-    : cabeca(nullptr), cauda(nullptr), tamanho(0) {
+ListaDuplamenteEncadeada::ListaDuplamenteEncadeada(bool usarPoolNos) 
+    : pool(usarPoolNos ? std::make_unique<PoolNos>(sizeof(No), alignof(No)) : nullptr),
+      cabeca(nullptr), cauda(nullptr), tamanho(0), dedo(nullptr), posicaoDedo(0) {
+}
+
+ListaDuplamenteEncadeada::~ListaDuplamenteEncadeada() {
+    limpar();
 }
 
 void ListaDuplamenteEncadeada::inserirNoInicio(std::unique_ptr<Elemento> elemento) {
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    auto novoNo = criarNo<No>(pool.get(), std::move(elemento));
     
     if (estaVazia()) {
         // Lista vazia - primeiro elemento é tanto cabeça quanto cauda
@@ -19,11 +25,20 @@ void ListaDuplamenteEncadeada::inserirNoInicio(std::unique_ptr<Elemento> element
         cabeca = std::move(novoNo);
     }
     
+    if (indice) {
+        indice->aoInserir(0, cabeca.get());
+    }
+    if (dedo) {
+        posicaoDedo++;
+    }
+    if (indiceIds) {
+        indiceIds->registrar(cabeca.get());
+    }
     tamanho++;
 }
 
 void ListaDuplamenteEncadeada::inserirNoFim(std::unique_ptr<Elemento> elemento) {
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    auto novoNo = criarNo<No>(pool.get(), std::move(elemento));
     
     if (estaVazia()) {
         // Lista vazia - primeiro elemento é tanto cabeça quanto cauda
@@ -36,6 +51,12 @@ void ListaDuplamenteEncadeada::inserirNoFim(std::unique_ptr<Elemento> elemento)
         cauda = cauda->proximo.get();
     }
     
+    if (indice) {
+        indice->aoInserir(tamanho, cauda);
+    }
+    if (indiceIds) {
+        indiceIds->registrar(cauda);
+    }
     tamanho++;
 }
 
@@ -44,10 +65,21 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeada::removerPeloId(long id) {
         return nullptr;
     }
     
-    // Buscar o elemento
-    No* atual = cabeca.get();
-    while (atual && atual->dados->getID() != id) {
-        atual = atual->proximo.get();
+    // Buscar o elemento (a posição é necessária para o índice posicional)
+    No* atual = nullptr;
+    int posicao = 0;
+    if (indiceIds && indiceIds->procurar(id, atual)) {
+        if (atual && indice && atual != cabeca.get() && atual != cauda) {
+            for (No* anterior = atual->anterior; anterior; anterior = anterior->anterior) {
+                posicao++;
+            }
+        }
+    } else {
+        atual = cabeca.get();
+        while (atual && atual->dados->getID() != id) {
+            atual = atual->proximo.get();
+            posicao++;
+        }
     }
     
     // Elemento não encontrado
@@ -55,9 +87,6 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeada::removerPeloId(long id) {
         return nullptr;
     }
     
-    // Elemento encontrado - salvar dados
-    auto elementoRemovido = std::move(atual->dados);
-    
     // Caso especial: remover o primeiro elemento
     if (atual == cabeca.get()) {
         return removerPrimeiro();
@@ -68,15 +97,28 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeada::removerPeloId(long id) {
         return removerUltimo();
     }
     
-    // Caso geral: remover elemento do meio
-    atual->anterior->proximo = std::move(atual->proximo);
+    // Caso geral: remover elemento do meio (a posição nem sempre é conhecida: descarta o dedo)
+    dedo = nullptr;
+    if (indice) {
+        indice->aoRemover(posicao);
+    }
+    if (indiceIds) {
+        indiceIds->desregistrar(atual);
+    }
+    auto elementoRemovido = std::move(atual->dados);
     atual->proximo->anterior = atual->anterior;
+    atual->anterior->proximo = std::move(atual->proximo);  // Libera o nó 'atual'
     
     tamanho--;
     return elementoRemovido;
 }
 
 Elemento* ListaDuplamenteEncadeada::buscarPeloId(long id) const {
+    No* encontrado;
+    if (indiceIds && indiceIds->procurar(id, encontrado)) {
+        return encontrado ? encontrado->dados.get() : nullptr;
+    }
+    
     No* atual = cabeca.get();
     while (atual) {
         if (atual->dados->getID() == id) {
@@ -88,15 +130,74 @@ Elemento* ListaDuplamenteEncadeada::buscarPeloId(long id) const {
 }
 
 bool ListaDuplamenteEncadeada::alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento) {
-    No* atual = cabeca.get();
-    while (atual) {
-        if (atual->dados->getID() == id) {
-            atual->dados = std::move(novoElemento);
-            return true;
+    No* atual = nullptr;
+    if (!indiceIds || !indiceIds->procurar(id, atual)) {
+        atual = cabeca.get();
+        while (atual && atual->dados->getID() != id) {
+            atual = atual->proximo.get();
         }
-        atual = atual->proximo.get();
     }
-    return false;
+    if (!atual) {
+        return false;
+    }
+    
+    // O novo elemento pode ter outro ID
+    if (indiceIds) {
+        indiceIds->desregistrar(atual);
+    }
+    atual->dados = std::move(novoElemento);
+    if (indiceIds) {
+        indiceIds->registrar(atual);
+    }
+    return true;
+}
+
+bool ListaDuplamenteEncadeada::moverParaInicio(long id) {
+    No* atual = nullptr;
+    int posicao = 0;
+    if (indiceIds && indiceIds->procurar(id, atual)) {
+        if (atual && indice) {
+            for (No* anterior = atual->anterior; anterior; anterior = anterior->anterior) {
+                posicao++;
+            }
+        }
+    } else {
+        atual = cabeca.get();
+        while (atual && atual->dados->getID() != id) {
+            atual = atual->proximo.get();
+            posicao++;
+        }
+    }
+    
+    if (!atual) {
+        return false;
+    }
+    if (atual == cabeca.get()) {
+        return true;  // Já está no início
+    }
+    
+    // Desliga o nó, mantendo a posse dele, e fecha o buraco
+    dedo = nullptr;
+    No* anterior = atual->anterior;
+    PonteiroNo no = std::move(anterior->proximo);
+    if (atual == cauda) {
+        cauda = anterior;
+    } else {
+        atual->proximo->anterior = anterior;
+    }
+    anterior->proximo = std::move(atual->proximo);
+    
+    // Religa o mesmo nó na cabeça
+    atual->anterior = nullptr;
+    cabeca->anterior = atual;
+    atual->proximo = std::move(cabeca);
+    cabeca = std::move(no);
+    
+    if (indice) {
+        indice->aoRemover(posicao);
+        indice->aoInserir(0, atual);
+    }
+    return true;
 }
 
 Elemento* ListaDuplamenteEncadeada::getPrimeiro() const {
@@ -120,6 +221,17 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeada::removerPrimeiro() {
         return nullptr;
     }
     
+    if (indice) {
+        indice->aoRemover(0);
+    }
+    if (dedo == cabeca.get()) {
+        dedo = nullptr;
+    } else if (dedo) {
+        posicaoDedo--;
+    }
+    if (indiceIds) {
+        indiceIds->desregistrar(cabeca.get());
+    }
     auto elementoRemovido = std::move(cabeca->dados);
     
     if (tamanho == 1) {
@@ -141,6 +253,15 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeada::removerUltimo() {
         return nullptr;
     }
     
+    if (indice) {
+        indice->aoRemover(tamanho - 1);
+    }
+    if (dedo == cauda) {
+        dedo = nullptr;
+    }
+    if (indiceIds) {
+        indiceIds->desregistrar(cauda);
+    }
     auto elementoRemovido = std::move(cauda->dados);
     
     if (tamanho == 1) {
@@ -165,6 +286,77 @@ bool ListaDuplamenteEncadeada::estaVazia() const {
     return cabeca == nullptr;
 }
 
+bool ListaDuplamenteEncadeada::usaPoolNos() const {
+    return pool != nullptr;
+}
+
+const PoolNos* ListaDuplamenteEncadeada::getPoolNos() const {
+    return pool.get();
+}
+
+void ListaDuplamenteEncadeada::ativarIndicePosicional() {
+    if (!indice) {
+        indice = std::make_unique<IndicePosicional<No>>();
+    }
+    indice->reconstruir(cabeca.get(), tamanho);
+}
+
+void ListaDuplamenteEncadeada::desativarIndicePosicional() {
+    indice.reset();
+}
+
+bool ListaDuplamenteEncadeada::usaIndicePosicional() const {
+    return indice != nullptr;
+}
+
+void ListaDuplamenteEncadeada::ativarIndiceIds() {
+    indiceIds = std::make_unique<IndiceIds<No>>();
+    indiceIds->reservar(tamanho);
+    for (No* atual = cabeca.get(); atual; atual = atual->proximo.get()) {
+        indiceIds->registrar(atual);
+    }
+}
+
+void ListaDuplamenteEncadeada::desativarIndiceIds() {
+    indiceIds.reset();
+}
+
+bool ListaDuplamenteEncadeada::usaIndiceIds() const {
+    return indiceIds != nullptr;
+}
+
+ListaDuplamenteEncadeada::No* ListaDuplamenteEncadeada::localizar(int posicao) const {
+    // Ponto de partida mais próximo: cabeça, cauda ou dedo
+    No* atual = cabeca.get();
+    int atualPosicao = 0;
+    int distancia = posicao;
+    if (tamanho - 1 - posicao < distancia) {
+        atual = cauda;
+        atualPosicao = tamanho - 1;
+        distancia = tamanho - 1 - posicao;
+    }
+    if (dedo && std::abs(posicao - posicaoDedo) < distancia) {
+        atual = dedo;
+        atualPosicao = posicaoDedo;
+        distancia = std::abs(posicao - posicaoDedo);
+    }
+    
+    if (indice && distancia > SALTOS_SEM_INDICE) {
+        atual = indice->localizar(cabeca.get(), posicao);
+    } else {
+        for (; atualPosicao < posicao; atualPosicao++) {
+            atual = atual->proximo.get();
+        }
+        for (; atualPosicao > posicao; atualPosicao--) {
+            atual = atual->anterior;
+        }
+    }
+    
+    dedo = atual;
+    posicaoDedo = posicao;
+    return atual;
+}
+
 void ListaDuplamenteEncadeada::imprimirLista() const {
     if (estaVazia()) {
         std::cout << "Lista Duplamente Encadeada vazia!" << std::endl;
@@ -210,9 +402,33 @@ void ListaDuplamenteEncadeada::imprimirListaReversa() const {
 }
 
 void ListaDuplamenteEncadeada::limpar() {
-    while (!estaVazia()) {
-        removerPrimeiro();
+    if (indice) {
+        indice->limpar();
+    }
+    if (indiceIds) {
+        indiceIds->limpar();
     }
+    
+    if (pool) {
+        // Caminho rápido: destrói os elementos e descarta todos os nós juntos
+        No* atual = cabeca.release();
+        while (atual) {
+            No* proximo = atual->proximo.release();
+            atual->~No();
+            atual = proximo;
+        }
+        pool->liberarTodos();
+    } else {
+        // Cada nó é destruído já sem sucessor, evitando a recursão em 'proximo'
+        PonteiroNo atual = std::move(cabeca);
+        while (atual) {
+            atual = std::move(atual->proximo);
+        }
+    }
+    
+    cauda = nullptr;
+    dedo = nullptr;
+    tamanho = 0;
 }
 
 Elemento* ListaDuplamenteEncadeada::obterElementoPorPosicao(int posicao) const {
@@ -220,12 +436,7 @@ Elemento* ListaDuplamenteEncadeada::obterElementoPorPosicao(int posicao) const {
         return nullptr;
     }
     
-    No* atual = cabeca.get();
-    for (int i = 0; i < posicao; i++) {
-        atual = atual->proximo.get();
-    }
-    
-    return atual->dados.get();
+    return localizar(posicao)->dados.get();
 }
 
 bool ListaDuplamenteEncadeada::inserirNaPosicao(int posicao, std::unique_ptr<Elemento> elemento) {
@@ -244,18 +455,25 @@ bool ListaDuplamenteEncadeada::inserirNaPosicao(int posicao, std::unique_ptr<Ele
     }
     
     // Inserir no meio
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    auto novoNo = criarNo<No>(pool.get(), std::move(elemento));
     
-    No* atual = cabeca.get();
-    for (int i = 0; i < posicao; i++) {
-        atual = atual->proximo.get();
-    }
+    No* atual = localizar(posicao);
     
     novoNo->anterior = atual->anterior;
     novoNo->proximo = std::move(atual->anterior->proximo);
     atual->anterior->proximo = std::move(novoNo);
     atual->anterior = atual->anterior->proximo.get();
     
+    if (indice) {
+        indice->aoInserir(posicao, atual->anterior);
+    }
+    
+    // O dedo passa para o nó novo, que ocupa a posição pedida
+    dedo = atual->anterior;
+    posicaoDedo = posicao;
+    if (indiceIds) {
+        indiceIds->registrar(atual->anterior);
+    }
     tamanho++;
     return true;
 }
@@ -274,21 +492,188 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeada::removerDaPosicao(int posicao
     }
     
     // Remover do meio
-    No* atual = cabeca.get();
-    for (int i = 0; i < posicao; i++) {
-        atual = atual->proximo.get();
+    No* atual = localizar(posicao);
+    if (indice) {
+        indice->aoRemover(posicao);
+    }
+    if (indiceIds) {
+        indiceIds->desregistrar(atual);
     }
     
     auto elementoRemovido = std::move(atual->dados);
     
-    // Conectar os nós anterior e próximo
-    if (atual->anterior) {
-        atual->anterior->proximo = std::move(atual->proximo);
-    }
-    if (atual->proximo) {
-        atual->proximo->anterior = atual->anterior;
-    }
+    // O dedo passa para o sucessor, que assume a posição removida
+    dedo = atual->proximo.get();
+    posicaoDedo = posicao;
+    
+    // Conectar os nós anterior e próximo (o nó do meio tem ambos)
+    atual->proximo->anterior = atual->anterior;
+    atual->anterior->proximo = std::move(atual->proximo);  // Libera o nó 'atual'
     
     tamanho--;
     return elementoRemovido;
 }
+
+
+ListaDuplamenteEncadeada::PonteiroNo ListaDuplamenteEncadeada::adotarCadeia(
+        ListaDuplamenteEncadeada& origem, int inicio, int quantidade, No*& ultimo) {
+    No* primeiro = origem.localizar(inicio);
+    ultimo = origem.localizar(inicio + quantidade - 1);
+    
+    if (origem.indice) {
+        if (quantidade == origem.tamanho) {
+            origem.indice->limpar();
+        } else {
+            for (int i = 0; i < quantidade; i++) {
+                origem.indice->aoRemover(inicio);
+            }
+        }
+    }
+    if (origem.indiceIds) {
+        if (quantidade == origem.tamanho) {
+            origem.indiceIds->limpar();
+        } else {
+            for (No* no = primeiro; no != ultimo->proximo.get(); no = no->proximo.get()) {
+                origem.indiceIds->desregistrar(no);
+            }
+        }
+    }
+    
+    // Desliga o trecho de 'origem', mantendo a posse do primeiro nó
+    PonteiroNo& entrada = primeiro->anterior ? primeiro->anterior->proximo : origem.cabeca;
+    PonteiroNo cadeia = std::move(entrada);
+    entrada = std::move(ultimo->proximo);
+    if (entrada) {
+        entrada->anterior = primeiro->anterior;
+    } else {
+        origem.cauda = primeiro->anterior;
+    }
+    primeiro->anterior = nullptr;
+    origem.tamanho -= quantidade;
+    origem.dedo = nullptr;
+    
+    // Nós de pool não podem mudar de lista: os elementos passam para nós desta lista
+    if (pool || origem.pool) {
+        PonteiroNo novaCadeia;
+        No* fim = nullptr;
+        while (cadeia) {
+            auto novoNo = criarNo<No>(pool.get(), std::move(cadeia->dados));
+            novoNo->anterior = fim;
+            No* novoNoPtr = novoNo.get();
+            if (fim) {
+                fim->proximo = std::move(novoNo);
+            } else {
+                novaCadeia = std::move(novoNo);
+            }
+            fim = novoNoPtr;
+            cadeia = std::move(cadeia->proximo);  // Devolve o nó antigo ao pool de origem
+        }
+        cadeia = std::move(novaCadeia);
+        ultimo = fim;
+    }
+    
+    if (indiceIds) {
+        for (No* no = cadeia.get(); no; no = no->proximo.get()) {
+            indiceIds->registrar(no);
+        }
+    }
+    return cadeia;
+}
+
+void ListaDuplamenteEncadeada::transferirNoInicio(ListaDuplamenteEncadeada& origem) {
+    transferirNaPosicao(0, origem);
+}
+
+void ListaDuplamenteEncadeada::transferirNoFim(ListaDuplamenteEncadeada& origem) {
+    transferirNaPosicao(tamanho, origem);
+}
+
+bool ListaDuplamenteEncadeada::transferirNaPosicao(int posicao, ListaDuplamenteEncadeada& origem) {
+    if (&origem == this || posicao < 0 || posicao > tamanho) {
+        return false;
+    }
+    
+    if (!origem.estaVazia()) {
+        transferirIntervalo(posicao, origem, 0, origem.tamanho);
+    }
+    return true;
+}
+
+int ListaDuplamenteEncadeada::transferirIntervalo(int posicao, ListaDuplamenteEncadeada& origem,
+                                                  int inicio, int quantidade) {
+    if (&origem == this || posicao < 0 || posicao > tamanho ||
+        inicio < 0 || quantidade <= 0 || quantidade > origem.tamanho - inicio) {
+        return 0;
+    }
+    
+    No* anterior = posicao == 0 ? nullptr : localizar(posicao - 1);
+    No* ultimo;
+    PonteiroNo cadeia = adotarCadeia(origem, inicio, quantidade, ultimo);
+    No* primeiro = cadeia.get();
+    
+    // Religa o trecho inteiro entre 'anterior' e o seu sucessor
+    PonteiroNo& entrada = anterior ? anterior->proximo : cabeca;
+    ultimo->proximo = std::move(entrada);
+    if (ultimo->proximo) {
+        ultimo->proximo->anterior = ultimo;
+    } else {
+        cauda = ultimo;
+    }
+    primeiro->anterior = anterior;
+    entrada = std::move(cadeia);
+    
+    if (indice) {
+        No* no = primeiro;
+        for (int i = 0; i < quantidade; i++, no = no->proximo.get()) {
+            indice->aoInserir(posicao + i, no);
+        }
+    }
+    dedo = ultimo;
+    posicaoDedo = posicao + quantidade - 1;
+    tamanho += quantidade;
+    return quantidade;
+}
+
+void ListaDuplamenteEncadeada::mesclarOrdenadoPorId(ListaDuplamenteEncadeada& origem) {
+    if (&origem == this || origem.estaVazia()) {
+        return;
+    }
+    
+    int quantidade = origem.tamanho;
+    No* ultimoOutra;
+    PonteiroNo outra = adotarCadeia(origem, 0, quantidade, ultimoOutra);
+    PonteiroNo minha = std::move(cabeca);
+    No* ultimaMinha = cauda;
+    
+    // Religa sempre o nó de menor ID; no empate vem o desta lista (mescla estável)
+    No* fim = nullptr;
+    while (minha && outra) {
+        PonteiroNo& menor = Elemento::menorId(*outra->dados, *minha->dados) ? outra : minha;
+        PonteiroNo no = std::move(menor);
+        menor = std::move(no->proximo);
+        no->anterior = fim;
+        No* noPtr = no.get();
+        if (fim) {
+            fim->proximo = std::move(no);
+        } else {
+            cabeca = std::move(no);
+        }
+        fim = noPtr;
+    }
+    
+    // O que sobrou de uma das cadeias já está em ordem: entra de uma vez
+    cauda = minha ? ultimaMinha : ultimoOutra;
+    PonteiroNo& resto = minha ? minha : outra;
+    resto->anterior = fim;
+    if (fim) {
+        fim->proximo = std::move(resto);
+    } else {
+        cabeca = std::move(resto);
+    }
+    
+    dedo = nullptr;
+    tamanho += quantidade;
+    if (indice) {
+        indice->reconstruir(cabeca.get(), tamanho);
+    }
+}
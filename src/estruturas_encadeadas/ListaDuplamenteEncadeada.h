@@ -2,6 +2,10 @@
 #define LISTA_DUPLAMENTE_ENCADEADA_H
 
 #include "../elementos/Elemento.h"
+#include "IndiceIds.h"
+#include "IndicePosicional.h"
+#include "OrdenacaoCadeias.h"
+#include "PoolNos.h"
 #include <memory>
 
 /**
@@ -20,34 +24,83 @@ private:
      * Esta classe é privada para garantir que o usuário não possa
      * acessar ou manipular diretamente os nós da lista.
      */
+    class No;
+    using PonteiroNo = std::unique_ptr<No, LiberadorNo<No>>;
+    
     class No {
     public:
         std::unique_ptr<Elemento> dados;    // Elemento armazenado
-        std::unique_ptr<No> proximo;        // Ponteiro para o próximo nó
+        PonteiroNo proximo;                 // Ponteiro para o próximo nó
         No* anterior;                       // Ponteiro para o nó anterior (raw pointer para evitar ciclos)
+        PoolNos* pool;                      // Pool de origem (nullptr se alocado com new)
         
         /**
          * @brief Construtor do nó
          * @param elemento Elemento a ser armazenado
          */
         explicit No(std::unique_ptr<Elemento> elemento) 
-            : dados(std::move(elemento)), proximo(nullptr), anterior(nullptr) {}
+            : dados(std::move(elemento)), proximo(nullptr), anterior(nullptr), pool(nullptr) {}
     };
     
-    std::unique_ptr<No> cabeca;    // Primeiro nó da lista
+    std::unique_ptr<PoolNos> pool; // Pool de nós (nullptr se a lista usa new/delete)
+    PonteiroNo cabeca;             // Primeiro nó da lista
     No* cauda;                     // Último nó da lista (raw pointer para evitar ciclos)
     int tamanho;                   // Número de elementos na lista
-
+    std::unique_ptr<IndicePosicional<No>> indice;  // Índice posicional (nullptr se desativado)
+    std::unique_ptr<IndiceIds<No>> indiceIds;      // Índice de IDs (nullptr se desativado)
+    mutable No* dedo;              // Último nó localizado por posição (nullptr se inválido)
+    mutable int posicaoDedo;       // Posição do 'dedo'
+    
+    /**
+     * @brief Distância a partir da qual o índice posicional compensa mais que andar pela lista
+     */
+    static constexpr int SALTOS_SEM_INDICE = 16;
+    
+    /**
+     * @brief Localiza o nó de uma posição válida
+     * 
+     * Parte do ponto mais próximo entre cabeça, cauda e o último nó
+     * localizado (o "dedo"), andando para frente ou para trás; com o índice
+     * posicional ativo, usa o índice se esse ponto estiver longe.
+     * 
+     * Complexidade: O(min(k, n - k, |k - dedo|)); O(log n) esperado com
+     *               índice posicional. Percursos sequenciais: O(1) por passo
+     */
+    No* localizar(int posicao) const;
+    
+    /**
+     * @brief Retira um trecho de outra lista e o prepara para entrar nesta
+     * @param origem Lista de onde os nós saem
+     * @param inicio Posição do primeiro nó do trecho em 'origem'
+     * @param quantidade Número de nós do trecho (trecho válido e não vazio)
+     * @param ultimo Recebe o último nó do trecho devolvido
+     * @return Cadeia com os nós do trecho, já registrados no índice de IDs desta lista
+     * 
+     * Sem pool nas duas listas, os próprios nós mudam de lista. Um nó de
+     * pool só pode viver na lista dona do pool: nesse caso cada elemento
+     * passa para um nó novo desta lista e o nó antigo volta ao pool de origem.
+     * 
+     * Complexidade: O(1) para trechos nas pontas de 'origem' (senão, o custo
+     *               de localizar as pontas); O(m) com pool ou índice de IDs
+     */
+    PonteiroNo adotarCadeia(ListaDuplamenteEncadeada& origem, int inicio, int quantidade, No*& ultimo);
+    
 public:
     /**
      * @brief Construtor da lista
+     * @param usarPoolNos Se true, os nós vêm de um pool próprio da lista
+     *                    (slabs alinhados à linha de cache com lista livre),
+     *                    evitando o alocador do sistema a cada inserção
      */
-    ListaDuplamenteEncadeada();
+    explicit ListaDuplamenteEncadeada(bool usarPoolNos = false);
     
     /**
      * @brief Destrutor da lista
+     * 
+     * Complexidade: O(n) - libera os nós um a um, de forma iterativa
+     * (o destrutor padrão encadearia uma chamada recursiva por nó)
      */
-    ~ListaDuplamenteEncadeada() = default;
+    ~ListaDuplamenteEncadeada();
     
     /**
      * @brief Construtor de cópia (removido para simplificar)
@@ -80,7 +133,9 @@ public:
      * @param id ID do elemento a ser removido
      * @return Ponteiro único para o elemento removido (nullptr se não encontrado)
      * 
-     * Complexidade: O(n) - busca linear para encontrar o elemento
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs (O(n) se o índice
+     *               posicional também estiver ativo, para achar a posição)
      */
     std::unique_ptr<Elemento> removerPeloId(long id);
     
@@ -89,7 +144,8 @@ public:
      * @param id ID do elemento procurado
      * @return Ponteiro para o elemento (nullptr se não encontrado)
      * 
-     * Complexidade: O(n) - busca linear sequencial
+     * Complexidade: O(n) - busca linear sequencial;
+     *               O(1) médio com o índice de IDs
      */
     Elemento* buscarPeloId(long id) const;
     
@@ -99,10 +155,24 @@ public:
      * @param novoElemento Novo elemento para substituir o existente
      * @return true se a alteração foi bem-sucedida, false se ID não encontrado
      * 
-     * Complexidade: O(n) - busca linear para encontrar o elemento
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs
      */
     bool alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento);
     
+    /**
+     * @brief Move o elemento com ID específico para o início da lista
+     * @param id ID do elemento a ser movido
+     * @return true se o elemento foi encontrado, false caso contrário
+     * 
+     * Apenas religa o nó: não aloca, não libera e não altera o elemento.
+     * 
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs (O(n) se o índice
+     *               posicional também estiver ativo, para achar a posição)
+     */
+    bool moverParaInicio(long id);
+    
     /**
      * @brief Obtém o primeiro elemento da lista sem removê-lo
      * @return Ponteiro para o primeiro elemento (nullptr se lista vazia)
@@ -166,10 +236,137 @@ public:
      */
     void imprimirListaReversa() const;
     
+    /**
+     * @brief Aplica uma função a cada elemento, do início ao fim
+     * @param funcao Chamada como funcao(Elemento&)
+     * 
+     * Complexidade: O(n) - percorre todos os nós
+     */
+    template<typename Funcao>
+    void paraCada(Funcao funcao) const {
+        for (No* atual = cabeca.get(); atual; atual = atual->proximo.get()) {
+            funcao(*atual->dados);
+        }
+    }
+    
+    /**
+     * @brief Ordena a lista com merge sort de baixo para cima, religando os nós
+     * @param menor Comparador menor(const Elemento&, const Elemento&), como em std::sort
+     * 
+     * Os elementos não são movidos nem copiados e nada é alocado (os níveis
+     * são um array fixo de 32 cadeias). A ordenação é estável. As mesclas
+     * religam só os ponteiros 'proximo'; uma passada final refaz os
+     * 'anterior' e a cauda. O índice de IDs continua válido (os nós são os
+     * mesmos); o índice posicional, se ativo, é reconstruído.
+     * 
+     * Complexidade: O(n log n) comparações, O(1) de memória extra
+     */
+    template<typename Comparador>
+    void ordenar(Comparador menor) {
+        if (tamanho < 2) {
+            return;
+        }
+        
+        ordenarCadeia(cabeca, menor);
+        
+        No* anterior = nullptr;
+        for (No* atual = cabeca.get(); atual; atual = atual->proximo.get()) {
+            atual->anterior = anterior;
+            anterior = atual;
+        }
+        cauda = anterior;
+        dedo = nullptr;
+        if (indice) {
+            indice->reconstruir(cabeca.get(), tamanho);
+        }
+    }
+    
+    /**
+     * @brief Ordena a lista por ID crescente (estável, religando os nós)
+     * 
+     * Complexidade: O(n log n)
+     */
+    void ordenarPorId() {
+        ordenar([](const Elemento& a, const Elemento& b) {
+            return Elemento::menorId(a, b);
+        });
+    }
+    
+    /**
+     * @brief Informa se a lista aloca seus nós pelo pool
+     * @return true se o pool de nós está em uso
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaPoolNos() const;
+    
+    /**
+     * @brief Acesso ao pool de nós da lista (para estatísticas)
+     * @return Ponteiro para o pool (nullptr se a lista usa new/delete)
+     * 
+     * Complexidade: O(1) - acesso direto ao atributo
+     */
+    const PoolNos* getPoolNos() const;
+    
+    /**
+     * @brief Ativa o índice hash de IDs
+     * 
+     * A partir daqui buscarPeloId, alterarPeloId e removerPeloId acham o
+     * nó pelo índice em O(1) médio, e toda inserção e remoção passa a
+     * atualizar o índice. IDs repetidos continuam funcionando, mas voltam
+     * à busca linear.
+     * 
+     * Complexidade: O(n) - indexa os elementos atuais
+     */
+    void ativarIndiceIds();
+    
+    /**
+     * @brief Desativa o índice de IDs e libera a tabela
+     * 
+     * Complexidade: O(n)
+     */
+    void desativarIndiceIds();
+    
+    /**
+     * @brief Informa se o índice de IDs está ativo
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaIndiceIds() const;
+    
+    /**
+     * @brief Ativa o índice posicional (skip list com larguras)
+     * 
+     * A partir daqui obterElementoPorPosicao, inserirNaPosicao e
+     * removerDaPosicao custam O(log n) esperado. Em troca, toda inserção
+     * e remoção passa a atualizar o índice (O(log n)) e cerca de metade
+     * dos nós ganha uma torre alocada à parte.
+     * 
+     * Complexidade: O(n) - constrói o índice sobre os elementos atuais
+     */
+    void ativarIndicePosicional();
+    
+    /**
+     * @brief Desativa o índice posicional e libera as torres
+     * 
+     * Complexidade: O(n) no número de torres
+     */
+    void desativarIndicePosicional();
+    
+    /**
+     * @brief Informa se o índice posicional está ativo
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaIndicePosicional() const;
+    
     /**
      * @brief Limpa todos os elementos da lista
      * 
-     * Complexidade: O(n) - libera memória de todos os elementos
+     * Com pool, destrói apenas os elementos e descarta os nós de uma vez
+     * (PoolNos::liberarTodos), sem devolvê-los um a um à lista livre.
+     * 
+     * Complexidade: O(n) - libera memória de todos os elementos, sem recursão
      */
     void limpar();
     
@@ -178,7 +375,10 @@ public:
      * @param posicao Posição do elemento (0-based)
      * @return Ponteiro para o elemento (nullptr se posição inválida)
      * 
-     * Complexidade: O(n) - percorre até a posição desejada
+     * Complexidade: O(min(k, n - k)) - parte da cabeça, da cauda ou do último
+     *               nó acessado, o que estiver mais perto (O(1) por passo em
+     *               percursos sequenciais);
+     *               O(log n) esperado com o índice posicional ativo
      */
     Elemento* obterElementoPorPosicao(int posicao) const;
     
@@ -188,7 +388,10 @@ public:
      * @param elemento Elemento a ser inserido
      * @return true se a inserção foi bem-sucedida
      * 
-     * Complexidade: O(n) - percorre até a posição desejada
+     * Complexidade: O(min(k, n - k)) - parte da cabeça, da cauda ou do último
+     *               nó acessado, o que estiver mais perto (O(1) por passo em
+     *               percursos sequenciais);
+     *               O(log n) esperado com o índice posicional ativo
      */
     bool inserirNaPosicao(int posicao, std::unique_ptr<Elemento> elemento);
     
@@ -197,9 +400,78 @@ public:
      * @param posicao Posição do elemento a ser removido (0-based)
      * @return Ponteiro único para o elemento removido (nullptr se posição inválida)
      * 
-     * Complexidade: O(n) - percorre até a posição desejada
+     * Complexidade: O(min(k, n - k)) - parte da cabeça, da cauda ou do último
+     *               nó acessado, o que estiver mais perto (O(1) por passo em
+     *               percursos sequenciais);
+     *               O(log n) esperado com o índice posicional ativo
      */
     std::unique_ptr<Elemento> removerDaPosicao(int posicao);
+    
+    /**
+     * @brief Move todos os elementos de outra lista para o início desta
+     * @param origem Lista que será esvaziada (a própria lista é ignorada)
+     * 
+     * Os nós são religados, sem alocação; 'origem' fica vazia.
+     * 
+     * Complexidade: O(1) - sem pool e sem índices nas duas listas;
+     *               O(m) com pool ou índice de IDs, O(m log n) esperado
+     *               com índice posicional
+     */
+    void transferirNoInicio(ListaDuplamenteEncadeada& origem);
+    
+    /**
+     * @brief Move todos os elementos de outra lista para o final desta
+     * @param origem Lista que será esvaziada (a própria lista é ignorada)
+     * 
+     * Complexidade: O(1) - sem pool e sem índices nas duas listas;
+     *               O(m) com pool ou índice de IDs, O(m log n) esperado
+     *               com índice posicional
+     */
+    void transferirNoFim(ListaDuplamenteEncadeada& origem);
+    
+    /**
+     * @brief Move todos os elementos de outra lista para uma posição desta
+     * @param posicao Posição onde o primeiro elemento de 'origem' vai ficar (0-based)
+     * @param origem Lista que será esvaziada
+     * @return true se a transferência foi feita (false se a posição for
+     *         inválida ou 'origem' for esta lista)
+     * 
+     * Complexidade: O(min(k, n - k)) para localizar a posição, como em
+     *               inserirNaPosicao; a religação é O(1)
+     */
+    bool transferirNaPosicao(int posicao, ListaDuplamenteEncadeada& origem);
+    
+    /**
+     * @brief Move um trecho contíguo de outra lista para uma posição desta (splice)
+     * @param posicao Posição onde o primeiro elemento do trecho vai ficar (0-based)
+     * @param origem Lista de onde o trecho sai (não pode ser esta lista)
+     * @param inicio Posição do primeiro elemento do trecho em 'origem'
+     * @param quantidade Número de elementos do trecho
+     * @return Número de elementos movidos (0 se algum argumento for inválido)
+     * 
+     * Só as pontas do trecho são localizadas e religadas: os nós do meio
+     * não são visitados, e o tamanho das duas listas é ajustado pela
+     * quantidade informada.
+     * 
+     * Complexidade: O(min(k, n - k)) para localizar a posição e as duas
+     *               pontas do trecho (O(1) nas pontas das listas); a
+     *               religação é O(1). Com pool ou índice de IDs, O(m) a
+     *               mais; com índice posicional, O(m log n) esperado
+     */
+    int transferirIntervalo(int posicao, ListaDuplamenteEncadeada& origem, int inicio, int quantidade);
+    
+    /**
+     * @brief Mescla nesta lista outra lista, ambas ordenadas por ID crescente
+     * @param origem Lista ordenada que será esvaziada (a própria lista é ignorada)
+     * 
+     * Os nós das duas listas são religados em uma única passada, sem
+     * alocação; em IDs iguais, os elementos desta lista vêm antes (mescla
+     * estável). Se alguma das listas não estiver ordenada, nenhum elemento
+     * se perde, mas o resultado também não fica ordenado.
+     * 
+     * Complexidade: O(n + m) - uma comparação por nó religado
+     */
+    void mesclarOrdenadoPorId(ListaDuplamenteEncadeada& origem);
 };
 
 #endif
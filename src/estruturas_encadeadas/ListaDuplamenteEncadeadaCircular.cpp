@@ -1,70 +1,85 @@
 #include "ListaDuplamenteEncadeadaCircular.h"
+#include <cstdlib>
 #include <iostream>
 
-ListaDuplamenteEncadeadaCircular::ListaDuplamenteEncadeadaCircular() 
-    : cabeca(nullptr), cauda(nullptr), tamanho(0) {
+ListaDuplamenteEncadeadaCircular::ListaDuplamenteEncadeadaCircular(bool usarPoolNos) 
+    : pool(usarPoolNos ? std::make_unique<PoolNos>(sizeof(No), alignof(No)) : nullptr),
+      cabeca(nullptr), cauda(nullptr), tamanho(0), cursor(nullptr),
+      dedo(nullptr), posicaoDedo(0) {
 }
 
 ListaDuplamenteEncadeadaCircular::~ListaDuplamenteEncadeadaCircular() {
     limpar();
 }
 
+ListaDuplamenteEncadeadaCircular::No* ListaDuplamenteEncadeadaCircular::criarNo(std::unique_ptr<Elemento> elemento) {
+    return ::criarNo<No>(pool.get(), std::move(elemento)).release();
+}
+
+void ListaDuplamenteEncadeadaCircular::liberarNo(No* no) {
+    LiberadorNo<No>()(no);
+}
+
 void ListaDuplamenteEncadeadaCircular::inserirNoInicio(std::unique_ptr<Elemento> elemento) {
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    No* novoNo = criarNo(std::move(elemento));
     
     if (estaVazia()) {
         // Lista vazia - criar estrutura circular com um elemento
-        cabeca = std::move(novoNo);
-        cauda = cabeca.get();
-        cabeca->proximo = cabeca.get();
-        cabeca->anterior = cabeca.get();
+        cabeca = novoNo;
+        cauda = novoNo;
+        novoNo->proximo = novoNo;
+        novoNo->anterior = novoNo;
+        cursor = novoNo;
     } else {
         // Lista não vazia - inserir no início
-        No* novoNoPtr = novoNo.get();
-        
         // Configurar ligações do novo nó
-        novoNo->proximo = cabeca.get();
+        novoNo->proximo = cabeca;
         novoNo->anterior = cauda;
         
         // Atualizar ligações existentes
-        cabeca->anterior = novoNoPtr;
-        cauda->proximo = novoNoPtr;
+        cabeca->anterior = novoNo;
+        cauda->proximo = novoNo;
         
         // Novo nó vira cabeça
-        cabeca = std::move(novoNo);
+        cabeca = novoNo;
+        if (dedo) {
+            posicaoDedo++;
+        }
     }
     
+    if (indiceIds) {
+        indiceIds->registrar(novoNo);
+    }
     tamanho++;
 }
 
 void ListaDuplamenteEncadeadaCircular::inserirNoFim(std::unique_ptr<Elemento> elemento) {
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    No* novoNo = criarNo(std::move(elemento));
     
     if (estaVazia()) {
         // Lista vazia - criar estrutura circular com um elemento
-        cabeca = std::move(novoNo);
-        cauda = cabeca.get();
-        cabeca->proximo = cabeca.get();
-        cabeca->anterior = cabeca.get();
+        cabeca = novoNo;
+        cauda = novoNo;
+        novoNo->proximo = novoNo;
+        novoNo->anterior = novoNo;
+        cursor = novoNo;
     } else {
         // Lista não vazia - inserir no final
-        No* novoNoPtr = novoNo.get();
-        
         // Configurar ligações do novo nó
         novoNo->anterior = cauda;
-        novoNo->proximo = cabeca.get();
+        novoNo->proximo = cabeca;
         
         // Atualizar ligações existentes
-        cauda->proximo = novoNoPtr;
-        cabeca->anterior = novoNoPtr;
+        cauda->proximo = novoNo;
+        cabeca->anterior = novoNo;
         
         // Novo nó vira cauda
-        cauda = novoNoPtr;
-        
-        // Transferir propriedade para o nó anterior
-        cauda->anterior->proximo = novoNo.release();
+        cauda = novoNo;
     }
     
+    if (indiceIds) {
+        indiceIds->registrar(novoNo);
+    }
     tamanho++;
 }
 
@@ -73,30 +88,42 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeadaCircular::removerNo(No* no) {
         return nullptr;
     }
     
+    if (indiceIds) {
+        indiceIds->desregistrar(no);
+    }
     auto elementoRemovido = std::move(no->dados);
     
+    // Só a remoção da cabeça ou da cauda tem efeito conhecido na posição do dedo
+    if (dedo == no || (no != cabeca && no != cauda)) {
+        dedo = nullptr;
+    } else if (dedo && no == cabeca) {
+        posicaoDedo--;
+    }
+    
     if (tamanho == 1) {
         // Apenas um elemento
         cabeca = nullptr;
         cauda = nullptr;
+        cursor = nullptr;
     } else {
         // Atualizar ligações
         no->anterior->proximo = no->proximo;
         no->proximo->anterior = no->anterior;
         
         // Atualizar cabeça ou cauda se necessário
-        if (no == cabeca.get()) {
-            cabeca.reset(no->proximo);
+        if (no == cabeca) {
+            cabeca = no->proximo;
         } else if (no == cauda) {
             cauda = no->anterior;
         }
         
-        // Se o nó não é a cabeça, precisamos deletá-lo manualmente
-        if (no != cabeca.get()) {
-            delete no;
+        // O rodízio continua a partir do seguinte
+        if (no == cursor) {
+            cursor = no->proximo;
         }
     }
     
+    liberarNo(no);
     tamanho--;
     return elementoRemovido;
 }
@@ -106,8 +133,13 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeadaCircular::removerPeloId(long i
         return nullptr;
     }
     
+    No* encontrado;
+    if (indiceIds && indiceIds->procurar(id, encontrado)) {
+        return removerNo(encontrado);
+    }
+    
     // Buscar o elemento
-    No* atual = cabeca.get();
+    No* atual = cabeca;
     for (int i = 0; i < tamanho; i++) {
         if (atual->dados->getID() == id) {
             return removerNo(atual);
@@ -123,7 +155,12 @@ Elemento* ListaDuplamenteEncadeadaCircular::buscarPeloId(long id) const {
         return nullptr;
     }
     
-    No* atual = cabeca.get();
+    No* encontrado;
+    if (indiceIds && indiceIds->procurar(id, encontrado)) {
+        return encontrado ? encontrado->dados.get() : nullptr;
+    }
+    
+    No* atual = cabeca;
     for (int i = 0; i < tamanho; i++) {
         if (atual->dados->getID() == id) {
             return atual->dados.get();
@@ -139,16 +176,29 @@ bool ListaDuplamenteEncadeadaCircular::alterarPeloId(long id, std::unique_ptr<El
         return false;
     }
     
-    No* atual = cabeca.get();
-    for (int i = 0; i < tamanho; i++) {
-        if (atual->dados->getID() == id) {
-            atual->dados = std::move(novoElemento);
-            return true;
+    No* atual = nullptr;
+    if (!indiceIds || !indiceIds->procurar(id, atual)) {
+        No* candidato = cabeca;
+        for (int i = 0; i < tamanho && !atual; i++) {
+            if (candidato->dados->getID() == id) {
+                atual = candidato;
+            }
+            candidato = candidato->proximo;
         }
-        atual = atual->proximo;
+    }
+    if (!atual) {
+        return false;
     }
     
-    return false;
+    // O novo elemento pode ter outro ID
+    if (indiceIds) {
+        indiceIds->desregistrar(atual);
+    }
+    atual->dados = std::move(novoElemento);
+    if (indiceIds) {
+        indiceIds->registrar(atual);
+    }
+    return true;
 }
 
 std::unique_ptr<Elemento> ListaDuplamenteEncadeadaCircular::removerPrimeiro() {
@@ -156,7 +206,7 @@ std::unique_ptr<Elemento> ListaDuplamenteEncadeadaCircular::removerPrimeiro() {
         return nullptr;
     }
     
-    return removerNo(cabeca.get());
+    return removerNo(cabeca);
 }
 
 std::unique_ptr<Elemento> ListaDuplamenteEncadeadaCircular::removerUltimo() {
@@ -175,6 +225,32 @@ bool ListaDuplamenteEncadeadaCircular::estaVazia() const {
     return cabeca == nullptr;
 }
 
+bool ListaDuplamenteEncadeadaCircular::usaPoolNos() const {
+    return pool != nullptr;
+}
+
+const PoolNos* ListaDuplamenteEncadeadaCircular::getPoolNos() const {
+    return pool.get();
+}
+
+void ListaDuplamenteEncadeadaCircular::ativarIndiceIds() {
+    indiceIds = std::make_unique<IndiceIds<No>>();
+    indiceIds->reservar(tamanho);
+    No* atual = cabeca;
+    for (int i = 0; i < tamanho; i++) {
+        indiceIds->registrar(atual);
+        atual = atual->proximo;
+    }
+}
+
+void ListaDuplamenteEncadeadaCircular::desativarIndiceIds() {
+    indiceIds.reset();
+}
+
+bool ListaDuplamenteEncadeadaCircular::usaIndiceIds() const {
+    return indiceIds != nullptr;
+}
+
 void ListaDuplamenteEncadeadaCircular::imprimirLista() const {
     if (estaVazia()) {
         std::cout << "Lista Duplamente Encadeada Circular vazia!" << std::endl;
@@ -184,7 +260,7 @@ void ListaDuplamenteEncadeadaCircular::imprimirLista() const {
     std::cout << "=== LISTA DUPLAMENTE ENCADEADA CIRCULAR (Início -> Fim) ===" << std::endl;
     std::cout << "Tamanho: " << tamanho << std::endl;
     
-    No* atual = cabeca.get();
+    No* atual = cabeca;
     for (int i = 0; i < tamanho; i++) {
         std::cout << "[" << i << "] ";
         atual->dados->imprimirInfo();
@@ -224,7 +300,7 @@ void ListaDuplamenteEncadeadaCircular::imprimirListaCircular(int voltas) const {
     std::cout << "=== DEMONSTRAÇÃO CIRCULAR (" << voltas << " voltas) ===" << std::endl;
     std::cout << "Tamanho: " << tamanho << std::endl;
     
-    No* atual = cabeca.get();
+    No* atual = cabeca;
     int totalElementos = tamanho * voltas;
     
     for (int i = 0; i < totalElementos; i++) {
@@ -242,9 +318,30 @@ void ListaDuplamenteEncadeadaCircular::imprimirListaCircular(int voltas) const {
 }
 
 void ListaDuplamenteEncadeadaCircular::limpar() {
-    while (!estaVazia()) {
-        removerPrimeiro();
+    if (indiceIds) {
+        indiceIds->limpar();
     }
+    
+    // Percorre o ciclo uma vez, sem religar vizinhos a cada remoção
+    No* atual = cabeca;
+    for (int i = 0; i < tamanho; i++) {
+        No* proximo = atual->proximo;
+        if (pool) {
+            atual->~No();
+        } else {
+            liberarNo(atual);
+        }
+        atual = proximo;
+    }
+    if (pool) {
+        pool->liberarTodos();
+    }
+    
+    cabeca = nullptr;
+    cauda = nullptr;
+    cursor = nullptr;
+    dedo = nullptr;
+    tamanho = 0;
 }
 
 Elemento* ListaDuplamenteEncadeadaCircular::obterElementoPorPosicao(int posicao) const {
@@ -252,11 +349,27 @@ Elemento* ListaDuplamenteEncadeadaCircular::obterElementoPorPosicao(int posicao)
         return nullptr;
     }
     
-    No* atual = cabeca.get();
-    for (int i = 0; i < posicao; i++) {
+    // Saltos a partir da cabeça e do dedo, para frente (positivo) ou para trás (negativo)
+    No* atual = cabeca;
+    int saltos = posicao <= tamanho / 2 ? posicao : posicao - tamanho;
+    if (dedo) {
+        int frente = (posicao - posicaoDedo + tamanho) % tamanho;
+        int saltosDedo = frente <= tamanho / 2 ? frente : frente - tamanho;
+        if (std::abs(saltosDedo) < std::abs(saltos)) {
+            atual = dedo;
+            saltos = saltosDedo;
+        }
+    }
+    
+    for (; saltos > 0; saltos--) {
         atual = atual->proximo;
     }
+    for (; saltos < 0; saltos++) {
+        atual = atual->anterior;
+    }
     
+    dedo = atual;
+    posicaoDedo = posicao;
     return atual->dados.get();
 }
 
@@ -265,15 +378,30 @@ void ListaDuplamenteEncadeadaCircular::rotacionarDireita(int posicoes) {
         return;
     }
     
-    posicoes = posicoes % tamanho;  // Normalizar posições
+    // Normalizar para 0..tamanho-1 (negativo equivale a rotacionar à esquerda)
+    posicoes %= tamanho;
+    if (posicoes < 0) {
+        posicoes += tamanho;
+    }
     if (posicoes == 0) {
         return;
     }
     
-    // Mover cabeça para a direita
-    for (int i = 0; i < posicoes; i++) {
-        cauda = cabeca.get();
-        cabeca.reset(cabeca->proximo);
+    // Mover cabeça pelo lado mais curto (apenas ponteiros, nenhum nó é religado)
+    if (posicoes <= tamanho / 2) {
+        for (int i = 0; i < posicoes; i++) {
+            cabeca = cabeca->proximo;
+        }
+    } else {
+        for (int i = posicoes; i < tamanho; i++) {
+            cabeca = cabeca->anterior;
+        }
+    }
+    cauda = cabeca->anterior;
+    
+    // As posições recuam junto com a cabeça
+    if (dedo) {
+        posicaoDedo = (posicaoDedo - posicoes + tamanho) % tamanho;
     }
 }
 
@@ -282,16 +410,38 @@ void ListaDuplamenteEncadeadaCircular::rotacionarEsquerda(int posicoes) {
         return;
     }
     
-    posicoes = posicoes % tamanho;  // Normalizar posições
-    if (posicoes == 0) {
-        return;
+    // Rotacionar k à esquerda equivale a rotacionar n - k à direita
+    rotacionarDireita(tamanho - posicoes % tamanho);
+}
+
+Elemento* ListaDuplamenteEncadeadaCircular::atual() const {
+    return cursor ? cursor->dados.get() : nullptr;
+}
+
+Elemento* ListaDuplamenteEncadeadaCircular::avancar() {
+    if (!cursor) {
+        return nullptr;
     }
     
-    // Mover cabeça para a esquerda
-    for (int i = 0; i < posicoes; i++) {
-        cabeca.reset(cauda);
-        cauda = cauda->anterior;
+    cursor = cursor->proximo;
+    return cursor->dados.get();
+}
+
+Elemento* ListaDuplamenteEncadeadaCircular::recuar() {
+    if (!cursor) {
+        return nullptr;
     }
+    
+    cursor = cursor->anterior;
+    return cursor->dados.get();
+}
+
+void ListaDuplamenteEncadeadaCircular::reiniciarCursor() {
+    cursor = cabeca;
+}
+
+std::unique_ptr<Elemento> ListaDuplamenteEncadeadaCircular::removerAtual() {
+    return removerNo(cursor);
 }
 
 bool ListaDuplamenteEncadeadaCircular::verificarIntegridade() const {
@@ -300,13 +450,13 @@ bool ListaDuplamenteEncadeadaCircular::verificarIntegridade() const {
     }
     
     if (tamanho == 1) {
-        return (cabeca.get() == cauda && 
-                cabeca->proximo == cabeca.get() && 
-                cabeca->anterior == cabeca.get());
+        return (cabeca == cauda && 
+                cabeca->proximo == cabeca && 
+                cabeca->anterior == cabeca);
     }
     
     // Verificar se conseguimos percorrer a lista e voltar ao início
-    No* atual = cabeca.get();
+    No* atual = cabeca;
     for (int i = 0; i < tamanho; i++) {
         if (!atual) {
             return false;
@@ -315,5 +465,5 @@ bool ListaDuplamenteEncadeadaCircular::verificarIntegridade() const {
     }
     
     // Após percorrer todos os elementos, devemos estar de volta na cabeça
-    return atual == cabeca.get();
+    return atual == cabeca;
 }
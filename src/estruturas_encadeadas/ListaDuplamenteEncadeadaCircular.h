@@ -2,6 +2,8 @@
 #define LISTA_DUPLAMENTE_ENCADEADA_CIRCULAR_H
 
 #include "../elementos/Elemento.h"
+#include "IndiceIds.h"
+#include "PoolNos.h"
 #include <memory>
 
 /**
@@ -10,7 +12,8 @@
  * Implementa uma estrutura de dados linear onde cada elemento
  * tem ponteiros para o próximo e o anterior, formando um ciclo.
  * A cauda aponta para a cabeça e a cabeça aponta para a cauda.
- * Os nós são encapsulados como classes privadas.
+ * Os nós são encapsulados como classes privadas. Como o ciclo não tem
+ * um dono natural, a própria lista cria e libera cada nó.
  */
 class ListaDuplamenteEncadeadaCircular {
 private:
@@ -25,18 +28,37 @@ private:
         std::unique_ptr<Elemento> dados;    // Elemento armazenado
         No* proximo;                        // Ponteiro para o próximo nó (raw pointer para ciclo)
         No* anterior;                       // Ponteiro para o nó anterior (raw pointer para ciclo)
+        PoolNos* pool;                      // Pool de origem (nullptr se alocado com new)
         
         /**
          * @brief Construtor do nó
          * @param elemento Elemento a ser armazenado
          */
         explicit No(std::unique_ptr<Elemento> elemento) 
-            : dados(std::move(elemento)), proximo(nullptr), anterior(nullptr) {}
+            : dados(std::move(elemento)), proximo(nullptr), anterior(nullptr), pool(nullptr) {}
     };
     
-    std::unique_ptr<No> cabeca;    // Primeiro nó da lista (único unique_ptr)
-    No* cauda;                     // Último nó da lista (raw pointer para evitar ciclos)
+    std::unique_ptr<PoolNos> pool; // Pool de nós (nullptr se a lista usa new/delete)
+    No* cabeca;                    // Primeiro nó da lista (a lista é dona de todos os nós)
+    No* cauda;                     // Último nó da lista
     int tamanho;                   // Número de elementos na lista
+    No* cursor;                    // Nó atual do rodízio (nullptr só com a lista vazia)
+    mutable No* dedo;              // Último nó localizado por posição (nullptr se inválido)
+    mutable int posicaoDedo;       // Posição do 'dedo' a partir da cabeça
+    std::unique_ptr<IndiceIds<No>> indiceIds;  // Índice de IDs (nullptr se desativado)
+
+    /**
+     * @brief Cria um nó, pelo pool se a lista usa um
+     * @param elemento Elemento a ser armazenado
+     * @return Nó com ligações nulas
+     */
+    No* criarNo(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Destrói um nó já desligado do ciclo
+     * @param no Nó a ser liberado
+     */
+    void liberarNo(No* no);
 
     /**
      * @brief Remove um nó específico da lista circular
@@ -50,8 +72,11 @@ private:
 public:
     /**
      * @brief Construtor da lista
+     * @param usarPoolNos Se true, os nós vêm de um pool próprio da lista
+     *                    (slabs alinhados à linha de cache com lista livre),
+     *                    evitando o alocador do sistema a cada inserção
      */
-    ListaDuplamenteEncadeadaCircular();
+    explicit ListaDuplamenteEncadeadaCircular(bool usarPoolNos = false);
     
     /**
      * @brief Destrutor da lista
@@ -89,7 +114,8 @@ public:
      * @param id ID do elemento a ser removido
      * @return Ponteiro único para o elemento removido (nullptr se não encontrado)
      * 
-     * Complexidade: O(n) - busca linear para encontrar o elemento
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs
      */
     std::unique_ptr<Elemento> removerPeloId(long id);
     
@@ -98,7 +124,8 @@ public:
      * @param id ID do elemento procurado
      * @return Ponteiro para o elemento (nullptr se não encontrado)
      * 
-     * Complexidade: O(n) - busca linear sequencial
+     * Complexidade: O(n) - busca linear sequencial;
+     *               O(1) médio com o índice de IDs
      */
     Elemento* buscarPeloId(long id) const;
     
@@ -108,7 +135,8 @@ public:
      * @param novoElemento Novo elemento para substituir o existente
      * @return true se a alteração foi bem-sucedida, false se ID não encontrado
      * 
-     * Complexidade: O(n) - busca linear para encontrar o elemento
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs
      */
     bool alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento);
     
@@ -167,9 +195,54 @@ public:
      */
     void imprimirListaCircular(int voltas = 2) const;
     
+    /**
+     * @brief Informa se a lista aloca seus nós pelo pool
+     * @return true se o pool de nós está em uso
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaPoolNos() const;
+    
+    /**
+     * @brief Acesso ao pool de nós da lista (para estatísticas)
+     * @return Ponteiro para o pool (nullptr se a lista usa new/delete)
+     * 
+     * Complexidade: O(1) - acesso direto ao atributo
+     */
+    const PoolNos* getPoolNos() const;
+    
+    /**
+     * @brief Ativa o índice hash de IDs
+     * 
+     * A partir daqui buscarPeloId, alterarPeloId e removerPeloId acham o
+     * nó pelo índice em O(1) médio, e toda inserção e remoção passa a
+     * atualizar o índice. IDs repetidos continuam funcionando, mas voltam
+     * à busca linear.
+     * 
+     * Complexidade: O(n) - indexa os elementos atuais
+     */
+    void ativarIndiceIds();
+    
+    /**
+     * @brief Desativa o índice de IDs e libera a tabela
+     * 
+     * Complexidade: O(n)
+     */
+    void desativarIndiceIds();
+    
+    /**
+     * @brief Informa se o índice de IDs está ativo
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaIndiceIds() const;
+    
     /**
      * @brief Limpa todos os elementos da lista
      * 
+     * Com pool, destrói apenas os elementos e descarta os nós de uma vez
+     * (PoolNos::liberarTodos), sem devolvê-los um a um à lista livre.
+     * 
      * Complexidade: O(n) - libera memória de todos os elementos
      */
     void limpar();
@@ -179,26 +252,75 @@ public:
      * @param posicao Posição do elemento (0-based)
      * @return Ponteiro para o elemento (nullptr se posição inválida)
      * 
-     * Complexidade: O(n) - percorre até a posição desejada
+     * Parte da cabeça ou do último nó localizado (o "dedo"), o que estiver
+     * mais perto em qualquer sentido do ciclo.
+     * 
+     * Complexidade: O(min(k, n - k)) - segue o ciclo pelo lado mais curto;
+     *               O(1) por passo em percursos sequenciais
      */
     Elemento* obterElementoPorPosicao(int posicao) const;
     
     /**
      * @brief Rotaciona a lista para a direita
-     * @param posicoes Número de posições para rotacionar
+     * @param posicoes Número de posições para rotacionar (negativo rotaciona à esquerda)
      * 
-     * Complexidade: O(n) - pode precisar percorrer a lista
+     * Só a cabeça e a cauda mudam de lugar: nenhum nó é religado.
+     * 
+     * Complexidade: O(min(k, n - k)) - anda pelo lado mais curto do ciclo
      */
     void rotacionarDireita(int posicoes);
     
     /**
      * @brief Rotaciona a lista para a esquerda
-     * @param posicoes Número de posições para rotacionar
+     * @param posicoes Número de posições para rotacionar (negativo rotaciona à direita)
      * 
-     * Complexidade: O(n) - pode precisar percorrer a lista
+     * Complexidade: O(min(k, n - k)) - anda pelo lado mais curto do ciclo
      */
     void rotacionarEsquerda(int posicoes);
     
+    /**
+     * @brief Elemento sob o cursor de rodízio
+     * @return Ponteiro para o elemento (nullptr se lista vazia)
+     * 
+     * O cursor é independente da cabeça: percorrer o rodízio não muda as
+     * posições da lista. Ele começa no primeiro elemento inserido e, se o
+     * seu nó for removido, passa para o seguinte.
+     * 
+     * Complexidade: O(1)
+     */
+    Elemento* atual() const;
+    
+    /**
+     * @brief Avança o cursor para o próximo elemento do ciclo
+     * @return Elemento sob o cursor após o avanço (nullptr se lista vazia)
+     * 
+     * Complexidade: O(1) - um salto de ponteiro
+     */
+    Elemento* avancar();
+    
+    /**
+     * @brief Recua o cursor para o elemento anterior do ciclo
+     * @return Elemento sob o cursor após o recuo (nullptr se lista vazia)
+     * 
+     * Complexidade: O(1) - um salto de ponteiro
+     */
+    Elemento* recuar();
+    
+    /**
+     * @brief Leva o cursor de volta ao primeiro elemento
+     * 
+     * Complexidade: O(1)
+     */
+    void reiniciarCursor();
+    
+    /**
+     * @brief Remove o elemento sob o cursor, que passa para o seguinte
+     * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
+     * 
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Elemento> removerAtual();
+    
     /**
      * @brief Verifica se a lista está corretamente circular
      * @return true se a circularidade está íntegra
@@ -0,0 +1,381 @@
+#ifndef LISTA_INTRUSIVA_H
+#define LISTA_INTRUSIVA_H
+
+#include "../elementos/Elemento.h"
+#include "../elementos/GanchoLista.h"
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+/**
+ * @brief Lista duplamente encadeada intrusiva
+ *
+ * Em vez de embrulhar cada elemento em um nó alocado à parte, usa os
+ * ponteiros do GanchoLista embutido no próprio elemento. Inserir não
+ * aloca nada e percorrer a lista salta direto de elemento em elemento.
+ *
+ * A interface segue a da ListaDuplamenteEncadeada: a lista assume a
+ * posse dos elementos inseridos (std::unique_ptr) e a devolve ao
+ * removê-los. Como o gancho é único, um elemento pertence a no máximo
+ * uma lista intrusiva por vez.
+ *
+ * Internamente a lista é circular, fechada por um gancho sentinela,
+ * o que elimina os casos especiais de cabeça e cauda.
+ *
+ * @tparam T Tipo dos elementos; deve derivar de Elemento e de GanchoLista
+ */
+template<typename T>
+class ListaIntrusiva {
+    static_assert(std::is_base_of<Elemento, T>::value, "T deve derivar de Elemento");
+    static_assert(std::is_base_of<GanchoLista, T>::value, "T deve derivar de GanchoLista");
+
+private:
+    GanchoLista sentinela;    // Antecede o primeiro e sucede o último elemento
+    int tamanho;              // Número de elementos na lista
+
+    static T* comoElemento(GanchoLista* gancho) {
+        return static_cast<T*>(gancho);
+    }
+
+    /**
+     * @brief Encadeia um elemento antes de uma posição da lista
+     *
+     * Complexidade: O(1)
+     */
+    void encadearAntes(GanchoLista* posicao, std::unique_ptr<T> elemento) {
+        if (elemento->estaEncadeado()) {
+            // O elemento pertence a outra lista: abrir mão do ponteiro sem destruí-lo
+            elemento.release();
+            throw std::invalid_argument("Elemento já está encadeado em outra lista intrusiva");
+        }
+
+        GanchoLista* gancho = elemento.release();
+        gancho->proximoGancho = posicao;
+        gancho->anteriorGancho = posicao->anteriorGancho;
+        gancho->donoGancho = this;
+        posicao->anteriorGancho->proximoGancho = gancho;
+        posicao->anteriorGancho = gancho;
+        tamanho++;
+    }
+
+    /**
+     * @brief Desencadeia um elemento e devolve a posse dele
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<T> desencadear(GanchoLista* gancho) {
+        gancho->anteriorGancho->proximoGancho = gancho->proximoGancho;
+        gancho->proximoGancho->anteriorGancho = gancho->anteriorGancho;
+        gancho->anteriorGancho = nullptr;
+        gancho->proximoGancho = nullptr;
+        gancho->donoGancho = nullptr;
+        tamanho--;
+        return std::unique_ptr<T>(comoElemento(gancho));
+    }
+
+    /**
+     * @brief Procura o gancho do elemento com o ID informado
+     * @return Gancho do elemento (nullptr se não encontrado)
+     *
+     * Complexidade: O(n)
+     */
+    GanchoLista* procurar(long id) const {
+        for (GanchoLista* atual = sentinela.proximoGancho; atual != &sentinela; atual = atual->proximoGancho) {
+            if (comoElemento(atual)->getID() == id) {
+                return atual;
+            }
+        }
+        return nullptr;
+    }
+
+public:
+    /**
+     * @brief Construtor da lista vazia
+     */
+    ListaIntrusiva() : sentinela(), tamanho(0) {
+        sentinela.anteriorGancho = &sentinela;
+        sentinela.proximoGancho = &sentinela;
+    }
+
+    /**
+     * @brief Destrutor - destrói os elementos que ainda estão na lista
+     *
+     * Complexidade: O(n) - iterativo
+     */
+    ~ListaIntrusiva() {
+        limpar();
+    }
+
+    // Os elementos apontam para a sentinela: a lista não pode ser copiada nem movida
+    ListaIntrusiva(const ListaIntrusiva& outra) = delete;
+    ListaIntrusiva& operator=(const ListaIntrusiva& outra) = delete;
+
+    /**
+     * @brief Insere elemento no início da lista
+     * @param elemento Elemento a ser inserido (nulo é ignorado)
+     * @throws std::invalid_argument se o elemento já estiver em uma lista
+     *         (o elemento continua na lista de origem)
+     *
+     * Complexidade: O(1) - nenhuma alocação
+     */
+    void inserirNoInicio(std::unique_ptr<T> elemento) {
+        if (!elemento) {
+            return;  // Proteção contra elemento nulo
+        }
+        encadearAntes(sentinela.proximoGancho, std::move(elemento));
+    }
+
+    /**
+     * @brief Insere elemento no final da lista
+     * @param elemento Elemento a ser inserido (nulo é ignorado)
+     * @throws std::invalid_argument se o elemento já estiver em uma lista
+     *         (o elemento continua na lista de origem)
+     *
+     * Complexidade: O(1) - nenhuma alocação
+     */
+    void inserirNoFim(std::unique_ptr<T> elemento) {
+        if (!elemento) {
+            return;  // Proteção contra elemento nulo
+        }
+        encadearAntes(&sentinela, std::move(elemento));
+    }
+
+    /**
+     * @brief Remove um elemento conhecido da lista
+     * @param elemento Ponteiro para um elemento desta lista
+     * @return Ponteiro único para o elemento (nullptr se nulo, fora de lista
+     *         ou encadeado em outra lista, que continua intacta)
+     *
+     * É a operação que a lista intrusiva ganha em relação à lista com
+     * nós: não há busca.
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<T> remover(T* elemento) {
+        if (!elemento || !contem(elemento)) {
+            return nullptr;
+        }
+        return desencadear(elemento);
+    }
+
+    /**
+     * @brief Verifica se o elemento está encadeado nesta lista
+     *
+     * Complexidade: O(1) - compara a lista dona guardada no gancho
+     */
+    bool contem(const T* elemento) const {
+        return static_cast<const GanchoLista*>(elemento)->donoGancho == this;
+    }
+
+    /**
+     * @brief Remove elemento com ID específico
+     * @param id ID do elemento a ser removido
+     * @return Ponteiro único para o elemento removido (nullptr se não encontrado)
+     *
+     * Complexidade: O(n) - busca linear pelo ID
+     */
+    std::unique_ptr<T> removerPeloId(long id) {
+        GanchoLista* gancho = procurar(id);
+        if (!gancho) {
+            return nullptr;
+        }
+        return desencadear(gancho);
+    }
+
+    /**
+     * @brief Busca elemento pelo ID
+     * @param id ID do elemento procurado
+     * @return Ponteiro para o elemento (nullptr se não encontrado)
+     *
+     * Complexidade: O(n) - busca linear
+     */
+    T* buscarPeloId(long id) const {
+        GanchoLista* gancho = procurar(id);
+        return gancho ? comoElemento(gancho) : nullptr;
+    }
+
+    /**
+     * @brief Substitui o elemento com ID específico, na mesma posição
+     * @param id ID do elemento a ser alterado
+     * @param novoElemento Novo elemento para substituir o existente
+     * @return true se a alteração foi bem-sucedida, false se ID não encontrado
+     *
+     * Complexidade: O(n) - busca linear pelo ID
+     */
+    bool alterarPeloId(long id, std::unique_ptr<T> novoElemento) {
+        if (!novoElemento) {
+            return false;
+        }
+
+        GanchoLista* gancho = procurar(id);
+        if (!gancho) {
+            return false;
+        }
+
+        encadearAntes(gancho, std::move(novoElemento));
+        desencadear(gancho);  // O elemento antigo é destruído aqui
+        return true;
+    }
+
+    /**
+     * @brief Obtém o primeiro elemento sem removê-lo
+     * @return Ponteiro para o primeiro elemento (nullptr se lista vazia)
+     *
+     * Complexidade: O(1)
+     */
+    T* getPrimeiro() const {
+        return estaVazia() ? nullptr : comoElemento(sentinela.proximoGancho);
+    }
+
+    /**
+     * @brief Obtém o último elemento sem removê-lo
+     * @return Ponteiro para o último elemento (nullptr se lista vazia)
+     *
+     * Complexidade: O(1)
+     */
+    T* getUltimo() const {
+        return estaVazia() ? nullptr : comoElemento(sentinela.anteriorGancho);
+    }
+
+    /**
+     * @brief Obtém o elemento seguinte a um elemento da lista
+     * @return Próximo elemento (nullptr se for o último)
+     *
+     * Complexidade: O(1)
+     */
+    T* getProximo(const T* elemento) const {
+        GanchoLista* proximo = static_cast<const GanchoLista*>(elemento)->proximoGancho;
+        return proximo == &sentinela ? nullptr : comoElemento(proximo);
+    }
+
+    /**
+     * @brief Obtém o elemento anterior a um elemento da lista
+     * @return Elemento anterior (nullptr se for o primeiro)
+     *
+     * Complexidade: O(1)
+     */
+    T* getAnterior(const T* elemento) const {
+        GanchoLista* anterior = static_cast<const GanchoLista*>(elemento)->anteriorGancho;
+        return anterior == &sentinela ? nullptr : comoElemento(anterior);
+    }
+
+    /**
+     * @brief Remove o primeiro elemento da lista
+     * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<T> removerPrimeiro() {
+        if (estaVazia()) {
+            return nullptr;
+        }
+        return desencadear(sentinela.proximoGancho);
+    }
+
+    /**
+     * @brief Remove o último elemento da lista
+     * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<T> removerUltimo() {
+        if (estaVazia()) {
+            return nullptr;
+        }
+        return desencadear(sentinela.anteriorGancho);
+    }
+
+    /**
+     * @brief Retorna o número de elementos na lista
+     *
+     * Complexidade: O(1)
+     */
+    int getTamanho() const {
+        return tamanho;
+    }
+
+    /**
+     * @brief Verifica se a lista está vazia
+     *
+     * Complexidade: O(1)
+     */
+    bool estaVazia() const {
+        return tamanho == 0;
+    }
+
+    /**
+     * @brief Aplica uma função a cada elemento, do início ao fim
+     * @param funcao Chamada como funcao(T&)
+     *
+     * Complexidade: O(n) - um salto de ponteiro por elemento
+     */
+    template<typename Funcao>
+    void paraCada(Funcao funcao) const {
+        for (GanchoLista* atual = sentinela.proximoGancho; atual != &sentinela; atual = atual->proximoGancho) {
+            funcao(*comoElemento(atual));
+        }
+    }
+
+    /**
+     * @brief Imprime todos os elementos da lista
+     *
+     * Complexidade: O(n)
+     */
+    void imprimirLista() const {
+        if (estaVazia()) {
+            std::cout << "Lista Intrusiva vazia!" << std::endl;
+            return;
+        }
+
+        std::cout << "=== LISTA INTRUSIVA (Início -> Fim) ===" << std::endl;
+        std::cout << "Tamanho: " << tamanho << std::endl;
+
+        int posicao = 0;
+        paraCada([&posicao](const T& elemento) {
+            std::cout << "[" << posicao++ << "] ";
+            elemento.imprimirInfo();
+            std::cout << std::endl;
+        });
+
+        std::cout << "=== FIM DA LISTA ===" << std::endl;
+    }
+
+    /**
+     * @brief Limpa todos os elementos da lista
+     *
+     * Complexidade: O(n) - destrói os elementos, sem recursão
+     */
+    void limpar() {
+        while (!estaVazia()) {
+            desencadear(sentinela.proximoGancho);
+        }
+    }
+
+    /**
+     * @brief Obtém elemento por posição
+     * @param posicao Posição do elemento (0-based)
+     * @return Ponteiro para o elemento (nullptr se posição inválida)
+     *
+     * Complexidade: O(min(k, n - k)) - parte da ponta mais próxima
+     */
+    T* obterElementoPorPosicao(int posicao) const {
+        if (posicao < 0 || posicao >= tamanho) {
+            return nullptr;
+        }
+
+        const GanchoLista* atual = &sentinela;
+        if (posicao < tamanho / 2) {
+            for (int i = 0; i <= posicao; i++) {
+                atual = atual->proximoGancho;
+            }
+        } else {
+            for (int i = tamanho; i > posicao; i--) {
+                atual = atual->anteriorGancho;
+            }
+        }
+        return comoElemento(const_cast<GanchoLista*>(atual));
+    }
+};
+
+#endif
@@ -1,12 +1,17 @@
 #include "ListaSimplesmenteEncadeada.h"
 #include <iostream>
 
-ListaSimplesmenteEncadeada::ListaSimplesmenteEncadeada() 
-    : cabeca(nullptr), cauda(nullptr), tamanho(0) {
+ListaSimplesmenteEncadeada::ListaSimplesmenteEncadeada(bool usarPoolNos) 
+    : pool(usarPoolNos ? std::make_unique<PoolNos>(sizeof(No), alignof(No)) : nullptr),
+      cabeca(nullptr), cauda(nullptr), tamanho(0) {
+}
+
+ListaSimplesmenteEncadeada::~ListaSimplesmenteEncadeada() {
+    limpar();
 }
 
 void ListaSimplesmenteEncadeada::inserirNoInicio(std::unique_ptr<Elemento> elemento) {
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    auto novoNo = criarNo<No>(pool.get(), std::move(elemento));
     
     if (estaVazia()) {
         // Lista vazia - primeiro elemento é tanto cabeça quanto cauda
@@ -18,11 +23,14 @@ void ListaSimplesmenteEncadeada::inserirNoInicio(std::unique_ptr<Elemento> eleme
         cabeca = std::move(novoNo);
     }
     
+    if (indiceIds) {
+        indiceIds->registrar(cabeca.get());
+    }
     tamanho++;
 }
 
 void ListaSimplesmenteEncadeada::inserirNoFim(std::unique_ptr<Elemento> elemento) {
-    auto novoNo = std::make_unique<No>(std::move(elemento));
+    auto novoNo = criarNo<No>(pool.get(), std::move(elemento));
     
     if (estaVazia()) {
         // Lista vazia - primeiro elemento é tanto cabeça quanto cauda
@@ -34,14 +42,83 @@ void ListaSimplesmenteEncadeada::inserirNoFim(std::unique_ptr<Elemento> elemento
         cauda = cauda->proximo.get();
     }
     
+    if (indiceIds) {
+        indiceIds->registrar(cauda);
+    }
     tamanho++;
 }
 
+int ListaSimplesmenteEncadeada::inserirLoteNoFim(std::unique_ptr<Elemento>* lote, int quantidade) {
+    // Encadeia o lote separadamente antes de tocar na lista
+    PonteiroNo primeiroNo;
+    No* ultimoNo = nullptr;
+    int inseridos = 0;
+    
+    for (int i = 0; i < quantidade; i++) {
+        if (!lote[i]) {
+            continue;  // Proteção contra elemento nulo
+        }
+        
+        auto novoNo = criarNo<No>(pool.get(), std::move(lote[i]));
+        No* novoNoPtr = novoNo.get();
+        if (indiceIds) {
+            indiceIds->registrar(novoNoPtr);
+        }
+        if (ultimoNo) {
+            ultimoNo->proximo = std::move(novoNo);
+        } else {
+            primeiroNo = std::move(novoNo);
+        }
+        ultimoNo = novoNoPtr;
+        inseridos++;
+    }
+    
+    if (inseridos == 0) {
+        return 0;
+    }
+    
+    // Liga o lote inteiro à cauda de uma só vez
+    if (estaVazia()) {
+        cabeca = std::move(primeiroNo);
+    } else {
+        cauda->proximo = std::move(primeiroNo);
+    }
+    cauda = ultimoNo;
+    
+    tamanho += inseridos;
+    return inseridos;
+}
+
 std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerPeloId(long id) {
     if (estaVazia()) {
         return nullptr;
     }
     
+    No* encontrado;
+    if (indiceIds && indiceIds->procurar(id, encontrado)) {
+        if (!encontrado) {
+            return nullptr;
+        }
+        if (encontrado == cabeca.get()) {
+            return removerPrimeiro();
+        }
+        if (encontrado != cauda) {
+            // Sem o anterior em mãos: o sucessor sobe para este nó e o nó dele sai
+            indiceIds->desregistrar(encontrado);
+            auto elementoRemovido = std::move(encontrado->dados);
+            PonteiroNo sucessor = std::move(encontrado->proximo);
+            encontrado->dados = std::move(sucessor->dados);
+            encontrado->proximo = std::move(sucessor->proximo);
+            indiceIds->mover(sucessor.get(), encontrado);
+            if (cauda == sucessor.get()) {
+                cauda = encontrado;
+            }
+            tamanho--;
+            return elementoRemovido;
+        }
+        // O último elemento precisa do penúltimo: segue pela busca linear
+    }
+    
     // Caso especial: remover o primeiro elemento
     if (cabeca->dados->getID() == id) {
         return removerPrimeiro();
@@ -59,6 +136,9 @@ std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerPeloId(long id) {
     }
     
     // Elemento encontrado
+    if (indiceIds) {
+        indiceIds->desregistrar(atual->proximo.get());
+    }
     auto elementoRemovido = std::move(atual->proximo->dados);
     auto noRemovido = std::move(atual->proximo);
     atual->proximo = std::move(noRemovido->proximo);
@@ -73,6 +153,11 @@ std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerPeloId(long id) {
 }
 
 Elemento* ListaSimplesmenteEncadeada::buscarPeloId(long id) const {
+    No* encontrado;
+    if (indiceIds && indiceIds->procurar(id, encontrado)) {
+        return encontrado ? encontrado->dados.get() : nullptr;
+    }
+    
     No* atual = cabeca.get();
     while (atual) {
         if (atual->dados->getID() == id) {
@@ -84,15 +169,26 @@ Elemento* ListaSimplesmenteEncadeada::buscarPeloId(long id) const {
 }
 
 bool ListaSimplesmenteEncadeada::alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento) {
-    No* atual = cabeca.get();
-    while (atual) {
-        if (atual->dados->getID() == id) {
-            atual->dados = std::move(novoElemento);
-            return true;
+    No* atual = nullptr;
+    if (!indiceIds || !indiceIds->procurar(id, atual)) {
+        atual = cabeca.get();
+        while (atual && atual->dados->getID() != id) {
+            atual = atual->proximo.get();
         }
-        atual = atual->proximo.get();
     }
-    return false;
+    if (!atual) {
+        return false;
+    }
+    
+    // O novo elemento pode ter outro ID
+    if (indiceIds) {
+        indiceIds->desregistrar(atual);
+    }
+    atual->dados = std::move(novoElemento);
+    if (indiceIds) {
+        indiceIds->registrar(atual);
+    }
+    return true;
 }
 
 Elemento* ListaSimplesmenteEncadeada::getPrimeiro() const {
@@ -108,6 +204,9 @@ std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerPrimeiro() {
         return nullptr;
     }
     
+    if (indiceIds) {
+        indiceIds->desregistrar(cabeca.get());
+    }
     auto elementoRemovido = std::move(cabeca->dados);
     auto noRemovido = std::move(cabeca);
     cabeca = std::move(noRemovido->proximo);
@@ -121,6 +220,26 @@ std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerPrimeiro() {
     return elementoRemovido;
 }
 
+int ListaSimplesmenteEncadeada::removerPrimeiros(std::unique_ptr<Elemento>* saida, int quantidade) {
+    int removidos = 0;
+    while (removidos < quantidade && cabeca) {
+        if (indiceIds) {
+            indiceIds->desregistrar(cabeca.get());
+        }
+        saida[removidos] = std::move(cabeca->dados);
+        cabeca = std::move(cabeca->proximo);
+        removidos++;
+    }
+    
+    // Atualizar cauda se a lista ficou vazia
+    if (!cabeca) {
+        cauda = nullptr;
+    }
+    
+    tamanho -= removidos;
+    return removidos;
+}
+
 std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerUltimo() {
     if (estaVazia()) {
         return nullptr;
@@ -138,6 +257,9 @@ std::unique_ptr<Elemento> ListaSimplesmenteEncadeada::removerUltimo() {
     }
     
     // Remover o último elemento
+    if (indiceIds) {
+        indiceIds->desregistrar(cauda);
+    }
     auto elementoRemovido = std::move(cauda->dados);
     atual->proximo = nullptr;
     cauda = atual;
@@ -154,6 +276,30 @@ bool ListaSimplesmenteEncadeada::estaVazia() const {
     return cabeca == nullptr;
 }
 
+bool ListaSimplesmenteEncadeada::usaPoolNos() const {
+    return pool != nullptr;
+}
+
+const PoolNos* ListaSimplesmenteEncadeada::getPoolNos() const {
+    return pool.get();
+}
+
+void ListaSimplesmenteEncadeada::ativarIndiceIds() {
+    indiceIds = std::make_unique<IndiceIds<No>>();
+    indiceIds->reservar(tamanho);
+    for (No* atual = cabeca.get(); atual; atual = atual->proximo.get()) {
+        indiceIds->registrar(atual);
+    }
+}
+
+void ListaSimplesmenteEncadeada::desativarIndiceIds() {
+    indiceIds.reset();
+}
+
+bool ListaSimplesmenteEncadeada::usaIndiceIds() const {
+    return indiceIds != nullptr;
+}
+
 void ListaSimplesmenteEncadeada::imprimirLista() const {
     if (estaVazia()) {
         std::cout << "Lista Simplesmente Encadeada vazia!" << std::endl;
@@ -177,9 +323,29 @@ void ListaSimplesmenteEncadeada::imprimirLista() const {
 }
 
 void ListaSimplesmenteEncadeada::limpar() {
-    while (!estaVazia()) {
-        removerPrimeiro();
+    if (indiceIds) {
+        indiceIds->limpar();
     }
+    
+    if (pool) {
+        // Caminho rápido: destrói os elementos e descarta todos os nós juntos
+        No* atual = cabeca.release();
+        while (atual) {
+            No* proximo = atual->proximo.release();
+            atual->~No();
+            atual = proximo;
+        }
+        pool->liberarTodos();
+    } else {
+        // Cada nó é destruído já sem sucessor, evitando a recursão em 'proximo'
+        PonteiroNo atual = std::move(cabeca);
+        while (atual) {
+            atual = std::move(atual->proximo);
+        }
+    }
+    
+    cauda = nullptr;
+    tamanho = 0;
 }
 
 Elemento* ListaSimplesmenteEncadeada::obterElementoPorPosicao(int posicao) const {
@@ -195,15 +361,114 @@ Elemento* ListaSimplesmenteEncadeada::obterElementoPorPosicao(int posicao) const
     return atual->dados.get();
 }
 
-template<typename Condicao>
-int ListaSimplesmenteEncadeada::contarElementos(Condicao condicao) const {
-    int contador = 0;
-    No* atual = cabeca.get();
-    while (atual) {
-        if (condicao(atual->dados.get())) {
-            contador++;
+
+ListaSimplesmenteEncadeada::PonteiroNo ListaSimplesmenteEncadeada::adotarNos(ListaSimplesmenteEncadeada& origem,
+                                                                             No*& ultimo) {
+    PonteiroNo cadeia = std::move(origem.cabeca);
+    ultimo = origem.cauda;
+    origem.cauda = nullptr;
+    origem.tamanho = 0;
+    if (origem.indiceIds) {
+        origem.indiceIds->limpar();
+    }
+    
+    // Nós de pool não podem mudar de lista: os elementos passam para nós desta lista
+    if (pool || origem.pool) {
+        PonteiroNo novaCadeia;
+        No* fim = nullptr;
+        while (cadeia) {
+            auto novoNo = criarNo<No>(pool.get(), std::move(cadeia->dados));
+            No* novoNoPtr = novoNo.get();
+            if (fim) {
+                fim->proximo = std::move(novoNo);
+            } else {
+                novaCadeia = std::move(novoNo);
+            }
+            fim = novoNoPtr;
+            cadeia = std::move(cadeia->proximo);  // Devolve o nó antigo ao pool de origem
         }
-        atual = atual->proximo.get();
+        cadeia = std::move(novaCadeia);
+        ultimo = fim;
+    }
+    
+    if (indiceIds) {
+        for (No* no = cadeia.get(); no; no = no->proximo.get()) {
+            indiceIds->registrar(no);
+        }
+    }
+    return cadeia;
+}
+
+void ListaSimplesmenteEncadeada::transferirNoInicio(ListaSimplesmenteEncadeada& origem) {
+    if (&origem == this || origem.estaVazia()) {
+        return;
+    }
+    
+    int quantidade = origem.tamanho;
+    No* ultimo;
+    PonteiroNo cadeia = adotarNos(origem, ultimo);
+    
+    // O último nó da cadeia passa a apontar para a antiga cabeça
+    ultimo->proximo = std::move(cabeca);
+    cabeca = std::move(cadeia);
+    if (!cauda) {
+        cauda = ultimo;
+    }
+    tamanho += quantidade;
+}
+
+void ListaSimplesmenteEncadeada::transferirNoFim(ListaSimplesmenteEncadeada& origem) {
+    if (&origem == this || origem.estaVazia()) {
+        return;
+    }
+    
+    int quantidade = origem.tamanho;
+    No* ultimo;
+    PonteiroNo cadeia = adotarNos(origem, ultimo);
+    
+    // Liga a cadeia inteira à cauda de uma só vez
+    if (estaVazia()) {
+        cabeca = std::move(cadeia);
+    } else {
+        cauda->proximo = std::move(cadeia);
+    }
+    cauda = ultimo;
+    tamanho += quantidade;
+}
+
+void ListaSimplesmenteEncadeada::mesclarOrdenadoPorId(ListaSimplesmenteEncadeada& origem) {
+    if (&origem == this || origem.estaVazia()) {
+        return;
+    }
+    
+    int quantidade = origem.tamanho;
+    No* ultimoOutra;
+    PonteiroNo outra = adotarNos(origem, ultimoOutra);
+    PonteiroNo minha = std::move(cabeca);
+    No* ultimaMinha = cauda;
+    
+    // Religa sempre o nó de menor ID; no empate vem o desta lista (mescla estável)
+    No* fim = nullptr;
+    while (minha && outra) {
+        PonteiroNo& menor = Elemento::menorId(*outra->dados, *minha->dados) ? outra : minha;
+        PonteiroNo no = std::move(menor);
+        menor = std::move(no->proximo);
+        No* noPtr = no.get();
+        if (fim) {
+            fim->proximo = std::move(no);
+        } else {
+            cabeca = std::move(no);
+        }
+        fim = noPtr;
+    }
+    
+    // O que sobrou de uma das cadeias já está em ordem: entra de uma vez
+    cauda = minha ? ultimaMinha : ultimoOutra;
+    PonteiroNo& resto = minha ? minha : outra;
+    if (fim) {
+        fim->proximo = std::move(resto);
+    } else {
+        cabeca = std::move(resto);
     }
-    return contador;
+    tamanho += quantidade;
 }
@@ -2,6 +2,9 @@
 #define LISTA_SIMPLESMENTE_ENCADEADA_H
 
 #include "../elementos/Elemento.h"
+#include "IndiceIds.h"
+#include "OrdenacaoCadeias.h"
+#include "PoolNos.h"
 #include <memory>
 
 /**
@@ -20,33 +23,59 @@ private:
      * Esta classe é privada para garantir que o usuário não possa
      * acessar ou manipular diretamente os nós da lista.
      */
+    class No;
+    using PonteiroNo = std::unique_ptr<No, LiberadorNo<No>>;
+    
     class No {
     public:
         std::unique_ptr<Elemento> dados;    // Elemento armazenado
-        std::unique_ptr<No> proximo;        // Ponteiro para o próximo nó
+        PonteiroNo proximo;                 // Ponteiro para o próximo nó
+        PoolNos* pool;                      // Pool de origem (nullptr se alocado com new)
         
         /**
          * @brief Construtor do nó
          * @param elemento Elemento a ser armazenado
          */
         explicit No(std::unique_ptr<Elemento> elemento) 
-            : dados(std::move(elemento)), proximo(nullptr) {}
+            : dados(std::move(elemento)), proximo(nullptr), pool(nullptr) {}
     };
     
-    std::unique_ptr<No> cabeca;    // Primeiro nó da lista
+    std::unique_ptr<PoolNos> pool; // Pool de nós (nullptr se a lista usa new/delete)
+    PonteiroNo cabeca;             // Primeiro nó da lista
     No* cauda;                     // Último nó da lista (raw pointer para evitar ciclos)
     int tamanho;                   // Número de elementos na lista
-
+    std::unique_ptr<IndiceIds<No>> indiceIds;  // Índice de IDs (nullptr se desativado)
+    
+    /**
+     * @brief Retira todos os nós de outra lista e os prepara para entrar nesta
+     * @param origem Lista que será esvaziada (não vazia e diferente desta)
+     * @param ultimo Recebe o último nó da cadeia devolvida
+     * @return Cadeia com os nós, já registrados no índice de IDs desta lista
+     * 
+     * Sem pool nas duas listas, os próprios nós mudam de lista. Um nó de
+     * pool só pode viver na lista dona do pool: nesse caso cada elemento
+     * passa para um nó novo desta lista e o nó antigo volta ao pool de origem.
+     * 
+     * Complexidade: O(1) sem pool e sem índice de IDs; O(m) com algum deles
+     */
+    PonteiroNo adotarNos(ListaSimplesmenteEncadeada& origem, No*& ultimo);
+    
 public:
     /**
      * @brief Construtor da lista
+     * @param usarPoolNos Se true, os nós vêm de um pool próprio da lista
+     *                    (slabs alinhados à linha de cache com lista livre),
+     *                    evitando o alocador do sistema a cada inserção
      */
-    ListaSimplesmenteEncadeada();
+    explicit ListaSimplesmenteEncadeada(bool usarPoolNos = false);
     
     /**
      * @brief Destrutor da lista
+     * 
+     * Complexidade: O(n) - libera os nós um a um, de forma iterativa
+     * (o destrutor padrão encadearia uma chamada recursiva por nó)
      */
-    ~ListaSimplesmenteEncadeada() = default;
+    ~ListaSimplesmenteEncadeada();
     
     /**
      * @brief Construtor de cópia (removido para simplificar)
@@ -74,12 +103,25 @@ public:
      */
     void inserirNoFim(std::unique_ptr<Elemento> elemento);
     
+    /**
+     * @brief Insere um lote de elementos no final da lista
+     * @param lote Array de elementos a serem inseridos (nulos são ignorados)
+     * @param quantidade Número de elementos no array
+     * @return Número de elementos inseridos
+     * 
+     * Complexidade: O(k) - os nós são encadeados entre si e ligados
+     *               à cauda uma única vez
+     */
+    int inserirLoteNoFim(std::unique_ptr<Elemento>* lote, int quantidade);
+    
     /**
      * @brief Remove elemento com ID específico
      * @param id ID do elemento a ser removido
      * @return Ponteiro único para o elemento removido (nullptr se não encontrado)
      * 
-     * Complexidade: O(n) - busca linear para encontrar o elemento
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs (O(n) se for o último
+     *               elemento, para achar o penúltimo)
      */
     std::unique_ptr<Elemento> removerPeloId(long id);
     
@@ -88,7 +130,8 @@ public:
      * @param id ID do elemento procurado
      * @return Ponteiro para o elemento (nullptr se não encontrado)
      * 
-     * Complexidade: O(n) - busca linear sequencial
+     * Complexidade: O(n) - busca linear sequencial;
+     *               O(1) médio com o índice de IDs
      */
     Elemento* buscarPeloId(long id) const;
     
@@ -98,7 +141,8 @@ public:
      * @param novoElemento Novo elemento para substituir o existente
      * @return true se a alteração foi bem-sucedida, false se ID não encontrado
      * 
-     * Complexidade: O(n) - busca linear para encontrar o elemento
+     * Complexidade: O(n) - busca linear para encontrar o elemento;
+     *               O(1) médio com o índice de IDs
      */
     bool alterarPeloId(long id, std::unique_ptr<Elemento> novoElemento);
     
@@ -118,6 +162,16 @@ public:
      */
     std::unique_ptr<Elemento> removerPrimeiro();
     
+    /**
+     * @brief Remove os primeiros elementos da lista de uma só vez
+     * @param saida Array que recebe os elementos removidos
+     * @param quantidade Número máximo de elementos a remover
+     * @return Número de elementos efetivamente removidos
+     * 
+     * Complexidade: O(k) - remoções sucessivas do início
+     */
+    int removerPrimeiros(std::unique_ptr<Elemento>* saida, int quantidade);
+    
     /**
      * @brief Remove o último elemento da lista
      * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
@@ -126,6 +180,40 @@ public:
      */
     std::unique_ptr<Elemento> removerUltimo();
     
+    /**
+     * @brief Move todos os elementos de outra lista para o início desta
+     * @param origem Lista que será esvaziada (a própria lista é ignorada)
+     * 
+     * Os nós são religados, sem alocação; 'origem' fica vazia e a ordem
+     * dos elementos dela é mantida.
+     * 
+     * Complexidade: O(1) - sem pool e sem índice de IDs nas duas listas;
+     *               O(m) caso contrário
+     */
+    void transferirNoInicio(ListaSimplesmenteEncadeada& origem);
+    
+    /**
+     * @brief Move todos os elementos de outra lista para o final desta
+     * @param origem Lista que será esvaziada (a própria lista é ignorada)
+     * 
+     * Complexidade: O(1) - sem pool e sem índice de IDs nas duas listas
+     *               (com ponteiro cauda); O(m) caso contrário
+     */
+    void transferirNoFim(ListaSimplesmenteEncadeada& origem);
+    
+    /**
+     * @brief Mescla nesta lista outra lista, ambas ordenadas por ID crescente
+     * @param origem Lista ordenada que será esvaziada (a própria lista é ignorada)
+     * 
+     * Os nós das duas listas são religados em uma única passada, sem
+     * alocação; em IDs iguais, os elementos desta lista vêm antes (mescla
+     * estável). Se alguma das listas não estiver ordenada, nenhum elemento
+     * se perde, mas o resultado também não fica ordenado.
+     * 
+     * Complexidade: O(n + m) - uma comparação por nó religado
+     */
+    void mesclarOrdenadoPorId(ListaSimplesmenteEncadeada& origem);
+    
     /**
      * @brief Retorna o número de elementos na lista
      * @return Tamanho atual da lista
@@ -149,10 +237,55 @@ public:
      */
     void imprimirLista() const;
     
+    /**
+     * @brief Informa se a lista aloca seus nós pelo pool
+     * @return true se o pool de nós está em uso
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaPoolNos() const;
+    
+    /**
+     * @brief Acesso ao pool de nós da lista (para estatísticas)
+     * @return Ponteiro para o pool (nullptr se a lista usa new/delete)
+     * 
+     * Complexidade: O(1) - acesso direto ao atributo
+     */
+    const PoolNos* getPoolNos() const;
+    
+    /**
+     * @brief Ativa o índice hash de IDs
+     * 
+     * A partir daqui buscarPeloId, alterarPeloId e removerPeloId acham o
+     * nó pelo índice em O(1) médio, e toda inserção e remoção passa a
+     * atualizar o índice. IDs repetidos continuam funcionando, mas voltam
+     * à busca linear.
+     * 
+     * Complexidade: O(n) - indexa os elementos atuais
+     */
+    void ativarIndiceIds();
+    
+    /**
+     * @brief Desativa o índice de IDs e libera a tabela
+     * 
+     * Complexidade: O(n)
+     */
+    void desativarIndiceIds();
+    
+    /**
+     * @brief Informa se o índice de IDs está ativo
+     * 
+     * Complexidade: O(1) - verificação simples
+     */
+    bool usaIndiceIds() const;
+    
     /**
      * @brief Limpa todos os elementos da lista
      * 
-     * Complexidade: O(n) - libera memória de todos os elementos
+     * Com pool, destrói apenas os elementos e descarta os nós de uma vez
+     * (PoolNos::liberarTodos), sem devolvê-los um a um à lista livre.
+     * 
+     * Complexidade: O(n) - libera memória de todos os elementos, sem recursão
      */
     void limpar();
     
@@ -173,7 +306,55 @@ public:
      * Complexidade: O(n) - percorre todos os elementos
      */
     template<typename Condicao>
-    int contarElementos(Condicao condicao) const;
+    int contarElementos(Condicao condicao) const {
+        int contador = 0;
+        No* atual = cabeca.get();
+        while (atual) {
+            if (condicao(atual->dados.get())) {
+                contador++;
+            }
+            atual = atual->proximo.get();
+        }
+        return contador;
+    }
+    
+    /**
+     * @brief Ordena a lista com merge sort de baixo para cima, religando os nós
+     * @param menor Comparador menor(const Elemento&, const Elemento&), como em std::sort
+     * 
+     * Os elementos não são movidos nem copiados: só os ponteiros 'proximo'
+     * mudam, e nada é alocado (os níveis são um array fixo de 32 cadeias).
+     * A ordenação é estável: elementos equivalentes mantêm a ordem relativa.
+     * Cada trecho já ordenado da lista (corrida) vira uma cadeia, e duas
+     * cadeias do mesmo nível são mescladas e sobem um nível. O índice de
+     * IDs continua válido, pois os nós são os mesmos.
+     * 
+     * Complexidade: O(n log n) comparações, O(1) de memória extra
+     */
+    template<typename Comparador>
+    void ordenar(Comparador menor) {
+        if (tamanho < 2) {
+            return;
+        }
+        
+        ordenarCadeia(cabeca, menor);
+        
+        cauda = cabeca.get();
+        while (cauda->proximo) {
+            cauda = cauda->proximo.get();
+        }
+    }
+    
+    /**
+     * @brief Ordena a lista por ID crescente (estável, religando os nós)
+     * 
+     * Complexidade: O(n log n)
+     */
+    void ordenarPorId() {
+        ordenar([](const Elemento& a, const Elemento& b) {
+            return Elemento::menorId(a, b);
+        });
+    }
 };
 
 #endif
@@ -0,0 +1,90 @@
+#ifndef ORDENACAO_CADEIAS_H
+#define ORDENACAO_CADEIAS_H
+
+#include "PoolNos.h"
+#include <memory>
+#include <utility>
+
+/**
+ * @brief Merge sort das listas encadeadas, sobre cadeias de nós ligadas por 'proximo'
+ *
+ * Compartilhado pela lista simples e pela dupla: as duas guardam os nós
+ * em std::unique_ptr<No, LiberadorNo<No>> e ordenam só religando os
+ * ponteiros 'proximo'. O que cada lista precisa refazer depois (cauda,
+ * ponteiros 'anterior', índices) fica com ela.
+ */
+
+/**
+ * @brief Mescla duas cadeias ordenadas, religando só os ponteiros 'proximo'
+ * @param primeira Cadeia com os nós que vinham antes na lista (vence os empates)
+ * @param segunda Cadeia com os nós que vinham depois
+ * @param menor Comparador menor(const Elemento&, const Elemento&)
+ * @return Cadeia mesclada
+ *
+ * Complexidade: O(a + b)
+ */
+template<typename No, typename Comparador>
+std::unique_ptr<No, LiberadorNo<No>> mesclarCadeias(std::unique_ptr<No, LiberadorNo<No>> primeira,
+                                                    std::unique_ptr<No, LiberadorNo<No>> segunda,
+                                                    Comparador& menor) {
+    using PonteiroNo = std::unique_ptr<No, LiberadorNo<No>>;
+    PonteiroNo resultado;
+    PonteiroNo* fim = &resultado;
+    while (primeira && segunda) {
+        // Só passa a segunda na frente se for estritamente menor (ordenação estável)
+        PonteiroNo& escolhida = menor(*segunda->dados, *primeira->dados) ? segunda : primeira;
+        *fim = std::move(escolhida);
+        escolhida = std::move((*fim)->proximo);
+        fim = &(*fim)->proximo;
+    }
+    *fim = primeira ? std::move(primeira) : std::move(segunda);
+    return resultado;
+}
+
+/**
+ * @brief Ordena uma cadeia com merge sort de baixo para cima (estável, sem alocar)
+ * @param cabeca Primeiro nó da cadeia; no fim, primeiro nó da cadeia ordenada
+ * @param menor Comparador menor(const Elemento&, const Elemento&), como em std::sort
+ *
+ * Os níveis são um array fixo de 32 cadeias. Cada cadeia nova é o trecho
+ * já ordenado que começa no próximo nó, e duas cadeias do mesmo nível são
+ * mescladas e sobem um nível: o nível i guarda a mescla de 2^i corridas,
+ * que podem ter qualquer tamanho. Só os ponteiros 'proximo' mudam.
+ *
+ * Complexidade: O(n log n) comparações, O(1) de memória extra
+ */
+template<typename No, typename Comparador>
+void ordenarCadeia(std::unique_ptr<No, LiberadorNo<No>>& cabeca, Comparador& menor) {
+    using PonteiroNo = std::unique_ptr<No, LiberadorNo<No>>;
+    PonteiroNo niveis[32];    // niveis[i]: mescla de 2^i corridas (ou vazia)
+    int usados = 0;
+    PonteiroNo restante = std::move(cabeca);
+    while (restante) {
+        // A cadeia nova é o trecho já ordenado que começa aqui (corrida natural)
+        PonteiroNo cadeia = std::move(restante);
+        No* fimCorrida = cadeia.get();
+        while (fimCorrida->proximo && !menor(*fimCorrida->proximo->dados, *fimCorrida->dados)) {
+            fimCorrida = fimCorrida->proximo.get();
+        }
+        restante = std::move(fimCorrida->proximo);
+
+        // Os níveis guardam nós anteriores aos da cadeia nova: vão na frente
+        int nivel = 0;
+        for (; nivel < usados && niveis[nivel]; nivel++) {
+            cadeia = mesclarCadeias(std::move(niveis[nivel]), std::move(cadeia), menor);
+        }
+        niveis[nivel] = std::move(cadeia);
+        if (nivel == usados) {
+            usados++;
+        }
+    }
+
+    // Níveis mais altos têm os nós mais antigos
+    for (int nivel = 0; nivel < usados; nivel++) {
+        if (niveis[nivel]) {
+            cabeca = mesclarCadeias(std::move(niveis[nivel]), std::move(cabeca), menor);
+        }
+    }
+}
+
+#endif
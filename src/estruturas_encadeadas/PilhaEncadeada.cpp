@@ -1,4 +1,5 @@
 #include "PilhaEncadeada.h"
+#include "FilaEncadeada.h"
 #include "../../ConfigLocale.h"
 
 void PilhaEncadeada::empilhar(std::unique_ptr<Elemento> elemento) {
@@ -28,6 +29,16 @@ Elemento* PilhaEncadeada::topo() const {
     return lista.getPrimeiro();
 }
 
+void PilhaEncadeada::empilharTudo(PilhaEncadeada& outra) {
+    // Os nós de 'outra' entram inteiros no início da lista (topo da pilha)
+    lista.transferirNoInicio(outra.lista);
+}
+
+void PilhaEncadeada::empilharTudo(FilaEncadeada& fila) {
+    // A frente da fila é o início da lista dela: vira o topo da pilha
+    lista.transferirNoInicio(fila.lista);
+}
+
 bool PilhaEncadeada::estaVazia() const {
     return lista.getTamanho() == 0;
 }
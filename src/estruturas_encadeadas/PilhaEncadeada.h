@@ -5,6 +5,8 @@
 #include "ListaSimplesmenteEncadeada.h"
 #include <memory>
 
+class FilaEncadeada;
+
 /**
  * @brief Adaptador de Pilha usando Lista Simplesmente Encadeada
  * 
@@ -21,12 +23,15 @@
 class PilhaEncadeada {
 private:
     ListaSimplesmenteEncadeada lista;  // Composição: adaptador da lista
+    
+    friend class FilaEncadeada;        // Transferências em bloco usam a lista interna
 
 public:
     /**
      * @brief Construtor da pilha
+     * @param usarPoolNos Se true, a lista interna aloca os nós por um pool próprio
      */
-    PilhaEncadeada() = default;
+    explicit PilhaEncadeada(bool usarPoolNos = false) : lista(usarPoolNos) {}
     
     /**
      * @brief Destrutor da pilha
@@ -67,6 +72,31 @@ public:
      */
     Elemento* topo() const;
     
+    /**
+     * @brief Empilha de uma só vez todos os elementos de outra pilha
+     * @param outra Pilha que será esvaziada
+     * 
+     * Os elementos de 'outra' ficam por cima, na mesma ordem em que
+     * estavam: o topo de 'outra' passa a ser o topo desta pilha.
+     * 
+     * Complexidade: O(1) - religa os nós das listas (O(m) se alguma
+     *               delas usar pool de nós)
+     */
+    void empilharTudo(PilhaEncadeada& outra);
+    
+    /**
+     * @brief Empilha de uma só vez todos os elementos de uma fila
+     * @param fila Fila que será esvaziada
+     * 
+     * A frente da fila passa a ser o topo da pilha, ou seja, os elementos
+     * saem da pilha na mesma ordem em que sairiam da fila. (Desenfileirar
+     * e empilhar um a um inverteria essa ordem, a O(1) por elemento.)
+     * 
+     * Complexidade: O(1) - religa os nós das listas (O(m) se alguma
+     *               delas usar pool de nós)
+     */
+    void empilharTudo(FilaEncadeada& fila);
+    
     /**
      * @brief Verifica se a pilha está vazia
      * @return true se a pilha está vazia
@@ -0,0 +1,65 @@
+#include "PoolNos.h"
+#include <stdexcept>
+
+PoolNos::PoolNos(std::size_t tamanhoNo, std::size_t alinhamentoNo, int nosPorSlab)
+    : tamanhoSlot(tamanhoNo), nosPorSlab(nosPorSlab), livres(nullptr),
+      cursor(nullptr), fimSlab(nullptr), ultimoSlab(nullptr),
+      slabsAlocados(0), nosEmUso(0) {
+    if (nosPorSlab <= 0) {
+        throw std::invalid_argument("Quantidade de nós por slab deve ser maior que zero");
+    }
+    if (alinhamentoNo > TAMANHO_LINHA_CACHE) {
+        throw std::invalid_argument("Alinhamento do nó maior que a linha de cache");
+    }
+
+    // Cada slot precisa comportar o encadeamento da lista livre e manter
+    // o alinhamento dos nós vizinhos (os slabs começam na linha de cache)
+    if (tamanhoSlot < sizeof(NoLivre)) {
+        tamanhoSlot = sizeof(NoLivre);
+    }
+    std::size_t alinhamento = alinhamentoNo < alignof(NoLivre) ? alignof(NoLivre) : alinhamentoNo;
+    tamanhoSlot = (tamanhoSlot + alinhamento - 1) / alinhamento * alinhamento;
+}
+
+PoolNos::~PoolNos() {
+    while (ultimoSlab) {
+        Slab* anterior = ultimoSlab->anterior;
+        ::operator delete(ultimoSlab, std::align_val_t(TAMANHO_LINHA_CACHE));
+        ultimoSlab = anterior;
+    }
+}
+
+void PoolNos::liberarTodos() {
+    if (!ultimoSlab) {
+        return;
+    }
+
+    // Mantém o slab mais recente para as próximas inserções
+    Slab* slab = ultimoSlab->anterior;
+    while (slab) {
+        Slab* anterior = slab->anterior;
+        ::operator delete(slab, std::align_val_t(TAMANHO_LINHA_CACHE));
+        slab = anterior;
+    }
+    ultimoSlab->anterior = nullptr;
+    slabsAlocados = 1;
+
+    livres = nullptr;
+    cursor = reinterpret_cast<char*>(ultimoSlab) + sizeof(Slab);
+    fimSlab = cursor + tamanhoSlot * static_cast<std::size_t>(nosPorSlab);
+    nosEmUso = 0;
+}
+
+void PoolNos::novoSlab() {
+    std::size_t bytes = sizeof(Slab) + tamanhoSlot * static_cast<std::size_t>(nosPorSlab);
+    void* memoria = ::operator new(bytes, std::align_val_t(TAMANHO_LINHA_CACHE));
+
+    Slab* slab = static_cast<Slab*>(memoria);
+    slab->anterior = ultimoSlab;
+    ultimoSlab = slab;
+    slabsAlocados++;
+
+    // Os nós começam logo após o cabeçalho, também alinhados à linha de cache
+    cursor = static_cast<char*>(memoria) + sizeof(Slab);
+    fimSlab = cursor + tamanhoSlot * static_cast<std::size_t>(nosPorSlab);
+}
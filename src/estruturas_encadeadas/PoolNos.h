@@ -0,0 +1,193 @@
+#ifndef POOL_NOS_H
+#define POOL_NOS_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Pool de nós de tamanho fixo para as listas encadeadas
+ *
+ * Os nós são recortados, em sequência, de slabs alinhados à linha de
+ * cache (64 bytes). Um nó liberado vai para uma lista livre intrusiva
+ * (o próprio nó guarda o ponteiro para o próximo livre) e é o primeiro
+ * a ser reaproveitado, sem passar pelo alocador do sistema. Os slabs só
+ * são devolvidos ao sistema no destrutor do pool.
+ *
+ * Cada lista que opta pelo pool possui o seu próprio PoolNos, portanto
+ * não há compartilhamento entre threads nem necessidade de travas.
+ */
+class PoolNos {
+private:
+    /**
+     * @brief Nó livre: reaproveita a memória do nó para encadear a lista livre
+     */
+    struct NoLivre {
+        NoLivre* proximo;
+    };
+
+    /**
+     * @brief Cabeçalho de um slab, ocupando sozinho a primeira linha de cache
+     */
+    struct alignas(64) Slab {
+        Slab* anterior;    // Slab alocado antes deste
+    };
+
+    std::size_t tamanhoSlot;    // Tamanho de cada nó, arredondado para alinhamento
+    int nosPorSlab;             // Quantidade de nós recortados de cada slab
+
+    NoLivre* livres;            // Nós devolvidos, prontos para reuso
+    char* cursor;               // Próximo nó ainda não usado do slab atual
+    char* fimSlab;              // Fim da área de nós do slab atual
+    Slab* ultimoSlab;           // Slab mais recente (encadeia todos os slabs)
+
+    int slabsAlocados;          // Número de slabs obtidos do sistema
+    int nosEmUso;               // Nós entregues e ainda não devolvidos
+
+    /**
+     * @brief Obtém um novo slab alinhado e passa a recortar nós dele
+     *
+     * Complexidade: O(1) - uma alocação do sistema
+     */
+    void novoSlab();
+
+public:
+    static constexpr std::size_t TAMANHO_LINHA_CACHE = 64;
+    static constexpr int NOS_POR_SLAB_PADRAO = 1024;
+
+    /**
+     * @brief Construtor do pool
+     * @param tamanhoNo Tamanho em bytes de cada nó (sizeof do tipo do nó)
+     * @param alinhamentoNo Alinhamento exigido pelo nó (alignof do tipo, até 64)
+     * @param nosPorSlab Quantos nós cada slab comporta
+     */
+    PoolNos(std::size_t tamanhoNo, std::size_t alinhamentoNo, int nosPorSlab = NOS_POR_SLAB_PADRAO);
+
+    /**
+     * @brief Destrutor - devolve todos os slabs ao sistema
+     *
+     * Os nós ainda em uso deixam de ser válidos; a lista dona do pool
+     * deve destruí-los antes.
+     */
+    ~PoolNos();
+
+    PoolNos(const PoolNos& outro) = delete;
+    PoolNos& operator=(const PoolNos& outro) = delete;
+
+    /**
+     * @brief Entrega memória para um nó
+     * @return Ponteiro para memória não inicializada de tamanhoNo bytes
+     *
+     * Complexidade: O(1) - lista livre, ou recorte do slab atual
+     */
+    void* alocar() {
+        nosEmUso++;
+        if (livres) {
+            NoLivre* no = livres;
+            livres = no->proximo;
+            return no;
+        }
+        if (cursor == fimSlab) {
+            novoSlab();
+        }
+        void* no = cursor;
+        cursor += tamanhoSlot;
+        return no;
+    }
+
+    /**
+     * @brief Devolve a memória de um nó já destruído ao pool
+     * @param memoria Ponteiro obtido de alocar()
+     *
+     * Complexidade: O(1) - empilha na lista livre
+     */
+    void liberar(void* memoria) {
+        NoLivre* no = static_cast<NoLivre*>(memoria);
+        no->proximo = livres;
+        livres = no;
+        nosEmUso--;
+    }
+
+    /**
+     * @brief Descarta de uma vez todos os nós entregues pelo pool
+     *
+     * Caminho rápido para esvaziar uma lista: em vez de devolver nó a nó
+     * para a lista livre, devolve ao sistema todos os slabs menos o mais
+     * recente, que volta a ser recortado do início. Os nós já devem ter
+     * sido destruídos (ou nunca mais serem usados).
+     *
+     * Complexidade: O(s) - s é o número de slabs
+     */
+    void liberarTodos();
+
+    /**
+     * @brief Retorna o número de slabs obtidos do sistema
+     *
+     * Complexidade: O(1)
+     */
+    int getSlabsAlocados() const { return slabsAlocados; }
+
+    /**
+     * @brief Retorna o número de nós entregues e ainda não devolvidos
+     *
+     * Complexidade: O(1)
+     */
+    int getNosEmUso() const { return nosEmUso; }
+
+    /**
+     * @brief Retorna o tamanho efetivo de cada nó dentro do slab
+     *
+     * Complexidade: O(1)
+     */
+    std::size_t getTamanhoSlot() const { return tamanhoSlot; }
+};
+
+/**
+ * @brief Deleter de nós para std::unique_ptr
+ *
+ * O nó precisa ter um membro 'PoolNos* pool' com o pool de origem.
+ * Sem pool, equivale a delete; com pool, destrói o nó e devolve a
+ * memória ao pool. O deleter não tem estado, então o unique_ptr
+ * continua do tamanho de um ponteiro.
+ */
+template<typename No>
+struct LiberadorNo {
+    void operator()(No* no) const {
+        PoolNos* pool = no->pool;
+        if (pool) {
+            no->~No();
+            pool->liberar(no);
+        } else {
+            delete no;
+        }
+    }
+};
+
+/**
+ * @brief Cria um nó no pool informado (ou no heap, se pool for nulo)
+ * @param pool Pool de origem do nó (nullptr para usar new)
+ * @param argumentos Argumentos repassados ao construtor do nó
+ * @return Ponteiro único com o deleter correspondente
+ *
+ * Complexidade: O(1)
+ */
+template<typename No, typename... Argumentos>
+std::unique_ptr<No, LiberadorNo<No>> criarNo(PoolNos* pool, Argumentos&&... argumentos) {
+    No* no;
+    if (!pool) {
+        no = new No(std::forward<Argumentos>(argumentos)...);
+    } else {
+        void* memoria = pool->alocar();
+        try {
+            no = new (memoria) No(std::forward<Argumentos>(argumentos)...);
+        } catch (...) {
+            pool->liberar(memoria);
+            throw;
+        }
+    }
+    no->pool = pool;
+    return std::unique_ptr<No, LiberadorNo<No>>(no);
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef COLUNAS_H
+#define COLUNAS_H
+
+#include "../elementos/TextoInternado.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Coluna de textos livres (nomes) guardados lado a lado em um só buffer
+ *
+ * Em vez de um std::string por linha (um objeto de 32 bytes e, para
+ * textos longos, uma alocação própria), os caracteres de todas as linhas
+ * ficam em um único vetor e cada linha guarda só onde o seu texto começa.
+ * O texto da linha i é [inicios[i], inicios[i + 1]).
+ */
+class ColunaTexto {
+private:
+    std::vector<char> caracteres;        // Textos de todas as linhas, sem separador
+    std::vector<std::uint32_t> inicios;  // Início de cada linha, mais o fim da última
+
+public:
+    ColunaTexto() : inicios(1, 0) {}
+
+    /**
+     * @brief Acrescenta o texto de uma nova linha
+     *
+     * Complexidade: O(tamanho do texto) amortizado
+     */
+    void adicionar(std::string_view texto) {
+        caracteres.insert(caracteres.end(), texto.begin(), texto.end());
+        inicios.push_back(static_cast<std::uint32_t>(caracteres.size()));
+    }
+
+    /**
+     * @brief Texto de uma linha (válido até a próxima inserção na coluna)
+     *
+     * Complexidade: O(1)
+     */
+    std::string_view obter(int linha) const {
+        return std::string_view(caracteres.data() + inicios[linha], inicios[linha + 1] - inicios[linha]);
+    }
+
+    int getTamanho() const {
+        return static_cast<int>(inicios.size()) - 1;
+    }
+
+    void reservar(int linhas, int caracteresPorLinha) {
+        inicios.reserve(linhas + 1);
+        caracteres.reserve(static_cast<std::size_t>(linhas) * caracteresPorLinha);
+    }
+
+    void limpar() {
+        caracteres.clear();
+        inicios.assign(1, 0);
+    }
+};
+
+/**
+ * @brief Coluna de valores repetidos (curso, cargo, categoria...) codificada por dicionário
+ *
+ * Cada valor distinto recebe um código denso (0, 1, 2...) e cada linha
+ * guarda só o código do seu valor. Agrupar por essa coluna vira indexar
+ * um vetor pelo código, sem comparar nem fazer hash de strings.
+ *
+ * Os valores são TextoInternado, os mesmos que os objetos já guardam: o
+ * dicionário só associa cada entrada do pool a um código, com hash do
+ * endereço, sem copiar nem reler os caracteres.
+ */
+class ColunaCategorias {
+private:
+    std::vector<TextoInternado> valores;                        // Código -> valor
+    std::unordered_map<TextoInternado, std::uint32_t> codigos;  // Valor -> código
+    std::vector<std::uint32_t> codigosLinhas;                   // Código de cada linha
+
+public:
+    /**
+     * @brief Acrescenta uma linha com o valor dado, criando um código se ele é novo
+     *
+     * Complexidade: O(1) médio (hash do endereço no pool)
+     */
+    void adicionar(TextoInternado valor) {
+        auto resultado = codigos.emplace(valor, static_cast<std::uint32_t>(valores.size()));
+        if (resultado.second) {
+            valores.push_back(valor);
+        }
+        codigosLinhas.push_back(resultado.first->second);
+    }
+
+    std::uint32_t codigo(int linha) const {
+        return codigosLinhas[linha];
+    }
+
+    const std::string& obter(int linha) const {
+        return valores[codigosLinhas[linha]].getTexto();
+    }
+
+    const std::string& valorDoCodigo(std::uint32_t codigo) const {
+        return valores[codigo].getTexto();
+    }
+
+    /**
+     * @brief Código de um valor
+     * @return Código, ou -1 se nenhuma linha tem esse valor
+     *
+     * Complexidade: O(1) médio
+     */
+    long buscarCodigo(TextoInternado valor) const {
+        auto it = codigos.find(valor);
+        return it == codigos.end() ? -1 : static_cast<long>(it->second);
+    }
+
+    /**
+     * @brief Código de um valor dado como texto
+     * @return Código, ou -1 se nenhuma linha tem esse valor
+     *
+     * Compara com os valores distintos em vez de internar o texto, para
+     * uma consulta não deixar uma entrada nova no pool.
+     * Complexidade: O(valores distintos)
+     */
+    long buscarCodigo(std::string_view valor) const {
+        for (std::size_t c = 0; c < valores.size(); c++) {
+            if (valores[c].getTexto() == valor) {
+                return static_cast<long>(c);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Número de valores distintos (os códigos vão de 0 a getNumeroValores() - 1)
+     */
+    int getNumeroValores() const {
+        return static_cast<int>(valores.size());
+    }
+
+    const std::uint32_t* dadosCodigos() const {
+        return codigosLinhas.data();
+    }
+
+    int getTamanho() const {
+        return static_cast<int>(codigosLinhas.size());
+    }
+
+    void reservar(int linhas) {
+        codigosLinhas.reserve(linhas);
+    }
+
+    void limpar() {
+        valores.clear();
+        codigos.clear();
+        codigosLinhas.clear();
+    }
+};
+
+#endif
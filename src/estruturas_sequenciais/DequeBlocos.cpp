@@ -0,0 +1,189 @@
+#include "DequeBlocos.h"
+#include <iostream>
+
+namespace {
+    const int CAPACIDADE_MAPA_INICIAL = 8;
+}
+
+DequeBlocos::DequeBlocos()
+    : mapa(new Posicao*[CAPACIDADE_MAPA_INICIAL]()), capacidadeMapa(CAPACIDADE_MAPA_INICIAL),
+      inicioAbsoluto((CAPACIDADE_MAPA_INICIAL / 2) << BITS_BLOCO), tamanho(0),
+      blocosAlocados(0), blocoReserva(nullptr) {
+}
+
+DequeBlocos::~DequeBlocos() {
+    limpar();
+    delete[] blocoReserva;
+    delete[] mapa;
+}
+
+void DequeBlocos::garantirBloco(int indiceMapa) {
+    if (mapa[indiceMapa]) {
+        return;
+    }
+    if (blocoReserva) {
+        mapa[indiceMapa] = blocoReserva;
+        blocoReserva = nullptr;
+    } else {
+        mapa[indiceMapa] = new Posicao[TAMANHO_BLOCO];
+    }
+    blocosAlocados++;
+}
+
+void DequeBlocos::liberarBloco(int indiceMapa) {
+    // Mantém um bloco de reserva: oscilar na fronteira de um bloco não aloca
+    if (blocoReserva) {
+        delete[] mapa[indiceMapa];
+    } else {
+        blocoReserva = mapa[indiceMapa];
+    }
+    mapa[indiceMapa] = nullptr;
+    blocosAlocados--;
+}
+
+void DequeBlocos::reorganizarMapa() {
+    int primeiro = inicioAbsoluto >> BITS_BLOCO;
+    int usados = tamanho == 0 ? 0 : ((inicioAbsoluto + tamanho - 1) >> BITS_BLOCO) - primeiro + 1;
+    // Espaço livre de sobra nas duas pontas após a reorganização
+    int novaCapacidade = usados * 2 < capacidadeMapa ? capacidadeMapa : capacidadeMapa * 2 + 2;
+    int novoPrimeiro = (novaCapacidade - usados) / 2;
+
+    Posicao** novoMapa = new Posicao*[novaCapacidade]();
+    for (int i = 0; i < usados; i++) {
+        novoMapa[novoPrimeiro + i] = mapa[primeiro + i];
+    }
+    delete[] mapa;
+    mapa = novoMapa;
+    capacidadeMapa = novaCapacidade;
+    inicioAbsoluto = (novoPrimeiro << BITS_BLOCO) | (inicioAbsoluto & (TAMANHO_BLOCO - 1));
+}
+
+void DequeBlocos::inserirInicio(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+    if (inicioAbsoluto == 0) {
+        reorganizarMapa();
+    }
+
+    int absoluta = inicioAbsoluto - 1;
+    garantirBloco(absoluta >> BITS_BLOCO);
+    posicao(absoluta) = std::move(elemento);
+    inicioAbsoluto = absoluta;
+    tamanho++;
+}
+
+void DequeBlocos::inserirFim(std::unique_ptr<Elemento> elemento) {
+    if (!elemento) {
+        return;  // Proteção contra elemento nulo
+    }
+    if (inicioAbsoluto + tamanho == capacidadeMapa << BITS_BLOCO) {
+        reorganizarMapa();
+    }
+
+    int absoluta = inicioAbsoluto + tamanho;
+    garantirBloco(absoluta >> BITS_BLOCO);
+    posicao(absoluta) = std::move(elemento);
+    tamanho++;
+}
+
+std::unique_ptr<Elemento> DequeBlocos::removerInicio() {
+    if (estaVazio()) {
+        return nullptr;  // Deque vazio
+    }
+
+    int bloco = inicioAbsoluto >> BITS_BLOCO;
+    std::unique_ptr<Elemento> elemento = std::move(posicao(inicioAbsoluto));
+    inicioAbsoluto++;
+    tamanho--;
+
+    if (tamanho == 0) {
+        liberarBloco(bloco);
+        inicioAbsoluto = (capacidadeMapa / 2) << BITS_BLOCO;  // Recomeça no meio do mapa
+    } else if ((inicioAbsoluto >> BITS_BLOCO) != bloco) {
+        liberarBloco(bloco);
+    }
+    return elemento;
+}
+
+std::unique_ptr<Elemento> DequeBlocos::removerFim() {
+    if (estaVazio()) {
+        return nullptr;  // Deque vazio
+    }
+
+    int absoluta = inicioAbsoluto + tamanho - 1;
+    int bloco = absoluta >> BITS_BLOCO;
+    std::unique_ptr<Elemento> elemento = std::move(posicao(absoluta));
+    tamanho--;
+
+    if (tamanho == 0) {
+        liberarBloco(bloco);
+        inicioAbsoluto = (capacidadeMapa / 2) << BITS_BLOCO;  // Recomeça no meio do mapa
+    } else if (((absoluta - 1) >> BITS_BLOCO) != bloco) {
+        liberarBloco(bloco);
+    }
+    return elemento;
+}
+
+Elemento* DequeBlocos::inicio() const {
+    return estaVazio() ? nullptr : posicao(inicioAbsoluto).get();
+}
+
+Elemento* DequeBlocos::fim() const {
+    return estaVazio() ? nullptr : posicao(inicioAbsoluto + tamanho - 1).get();
+}
+
+Elemento* DequeBlocos::obterPorIndice(int indice) const {
+    if (indice < 0 || indice >= tamanho) {
+        return nullptr;
+    }
+    return posicao(inicioAbsoluto + indice).get();
+}
+
+bool DequeBlocos::estaVazio() const {
+    return tamanho == 0;
+}
+
+int DequeBlocos::getTamanho() const {
+    return tamanho;
+}
+
+int DequeBlocos::getBlocosAlocados() const {
+    return blocosAlocados;
+}
+
+void DequeBlocos::limpar() {
+    while (!estaVazio()) {
+        removerFim();
+    }
+}
+
+void DequeBlocos::imprimirDeque() const {
+    if (estaVazio()) {
+        std::cout << "📦 Deque vazio!\n";
+        return;
+    }
+
+    std::cout << "⬌ Deque em blocos (do início ao fim):\n";
+    for (int i = 0; i < tamanho; i++) {
+        std::cout << "[" << i << "] ";
+        obterPorIndice(i)->imprimirInfo();
+        std::cout << "\n";
+    }
+    std::cout << "📊 Total de elementos: " << tamanho << " | Blocos: " << blocosAlocados << "\n";
+}
+
+void DequeBlocos::imprimirDequeReverso() const {
+    if (estaVazio()) {
+        std::cout << "📦 Deque vazio!\n";
+        return;
+    }
+
+    std::cout << "⬌ Deque em blocos (do fim ao início - ordem reversa):\n";
+    for (int i = tamanho - 1; i >= 0; i--) {
+        std::cout << "[" << i << "] ";
+        obterPorIndice(i)->imprimirInfo();
+        std::cout << "\n";
+    }
+    std::cout << "📊 Total de elementos: " << tamanho << " | Blocos: " << blocosAlocados << "\n";
+}
@@ -0,0 +1,201 @@
+#ifndef DEQUE_BLOCOS_H
+#define DEQUE_BLOCOS_H
+
+#include "../elementos/Elemento.h"
+#include <memory>
+
+/**
+ * @brief Deque armazenado em blocos de tamanho fixo com um mapa central
+ * 
+ * Alternativa ao Deque (adaptador da ListaDuplamenteEncadeada) no estilo
+ * de std::deque: os elementos ficam em blocos contíguos de TAMANHO_BLOCO
+ * posições e um mapa (array de ponteiros para blocos) localiza cada bloco.
+ * 
+ * - Inserir/remover nas pontas: O(1), sem deslocar elementos; um bloco é
+ *   alocado a cada TAMANHO_BLOCO inserções em vez de um nó por elemento
+ * - Acesso por índice: O(1), um deslocamento de bits e um acesso ao mapa
+ * - Percurso: sequencial dentro de cada bloco (boa localidade de memória)
+ * 
+ * Quando uma ponta chega ao limite do mapa, os ponteiros de bloco são
+ * recentralizados (ou copiados para um mapa maior); os elementos em si
+ * nunca são movidos.
+ */
+class DequeBlocos {
+public:
+    static const int BITS_BLOCO = 6;
+    static const int TAMANHO_BLOCO = 1 << BITS_BLOCO;  // 64 elementos por bloco
+
+private:
+    typedef std::unique_ptr<Elemento> Posicao;
+
+    Posicao** mapa;          // Ponteiros para os blocos (nullptr onde não há bloco)
+    int capacidadeMapa;      // Número de entradas do mapa
+    int inicioAbsoluto;      // Posição do primeiro elemento, contando do início do mapa
+    int tamanho;             // Número de elementos
+    int blocosAlocados;      // Blocos em uso no mapa
+    Posicao* blocoReserva;   // Último bloco liberado, reaproveitado sem alocar
+
+    Posicao& posicao(int absoluta) const {
+        return mapa[absoluta >> BITS_BLOCO][absoluta & (TAMANHO_BLOCO - 1)];
+    }
+
+    /**
+     * @brief Garante que a entrada do mapa tenha um bloco
+     */
+    void garantirBloco(int indiceMapa);
+
+    /**
+     * @brief Devolve o bloco de uma entrada do mapa (para a reserva ou o heap)
+     */
+    void liberarBloco(int indiceMapa);
+
+    /**
+     * @brief Recentraliza os blocos no mapa, dobrando-o se estiver mais da metade ocupado
+     * 
+     * Complexidade: O(número de blocos) - só ponteiros de bloco são copiados
+     */
+    void reorganizarMapa();
+
+public:
+    /**
+     * @brief Construtor do deque (mapa inicial com 8 entradas, nenhum bloco)
+     */
+    DequeBlocos();
+
+    /**
+     * @brief Destrutor - libera elementos, blocos e mapa
+     */
+    ~DequeBlocos();
+
+    DequeBlocos(const DequeBlocos& outro) = delete;
+    DequeBlocos& operator=(const DequeBlocos& outro) = delete;
+
+    /**
+     * @brief Insere um elemento no início do deque (push_front)
+     * @param elemento Elemento a ser inserido (nulo é ignorado)
+     * 
+     * Complexidade: O(1) amortizado
+     */
+    void inserirInicio(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Insere um elemento no final do deque (push_back)
+     * @param elemento Elemento a ser inserido (nulo é ignorado)
+     * 
+     * Complexidade: O(1) amortizado
+     */
+    void inserirFim(std::unique_ptr<Elemento> elemento);
+
+    /**
+     * @brief Remove um elemento do início do deque (pop_front)
+     * @return Elemento removido ou nullptr se vazio
+     * 
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Elemento> removerInicio();
+
+    /**
+     * @brief Remove um elemento do final do deque (pop_back)
+     * @return Elemento removido ou nullptr se vazio
+     * 
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Elemento> removerFim();
+
+    /**
+     * @brief Consulta o elemento do início sem removê-lo (front)
+     * @return Ponteiro para o elemento ou nullptr se vazio
+     * 
+     * Complexidade: O(1)
+     */
+    Elemento* inicio() const;
+
+    /**
+     * @brief Consulta o elemento do final sem removê-lo (back)
+     * @return Ponteiro para o elemento ou nullptr se vazio
+     * 
+     * Complexidade: O(1)
+     */
+    Elemento* fim() const;
+
+    /**
+     * @brief Acessa um elemento pela posição a partir do início
+     * @param indice Posição (0-based)
+     * @return Ponteiro para o elemento ou nullptr se índice inválido
+     * 
+     * Complexidade: O(1) - mapa + deslocamento dentro do bloco
+     */
+    Elemento* obterPorIndice(int indice) const;
+
+    /**
+     * @brief Aplica uma função a cada elemento, do início ao fim
+     * @param funcao Chamada como funcao(Elemento&)
+     * 
+     * Complexidade: O(n) - percorre cada bloco sequencialmente
+     */
+    template<typename Funcao>
+    void paraCada(Funcao funcao) const {
+        int restante = tamanho;
+        int atual = inicioAbsoluto;
+        while (restante > 0) {
+            Posicao* bloco = mapa[atual >> BITS_BLOCO];
+            int deslocamento = atual & (TAMANHO_BLOCO - 1);
+            int quantidade = TAMANHO_BLOCO - deslocamento;
+            if (quantidade > restante) {
+                quantidade = restante;
+            }
+            for (int i = deslocamento; i < deslocamento + quantidade; i++) {
+                funcao(*bloco[i]);
+            }
+            atual += quantidade;
+            restante -= quantidade;
+        }
+    }
+
+    /**
+     * @brief Verifica se o deque está vazio
+     * @return true se vazio
+     * 
+     * Complexidade: O(1)
+     */
+    bool estaVazio() const;
+
+    /**
+     * @brief Retorna o número de elementos no deque
+     * @return Tamanho do deque
+     * 
+     * Complexidade: O(1)
+     */
+    int getTamanho() const;
+
+    /**
+     * @brief Retorna quantos blocos estão em uso
+     * @return Número de blocos alocados no mapa
+     * 
+     * Complexidade: O(1)
+     */
+    int getBlocosAlocados() const;
+
+    /**
+     * @brief Limpa todos os elementos do deque
+     * 
+     * Complexidade: O(n)
+     */
+    void limpar();
+
+    /**
+     * @brief Imprime todos os elementos do deque (do início ao fim)
+     * 
+     * Complexidade: O(n)
+     */
+    void imprimirDeque() const;
+
+    /**
+     * @brief Imprime todos os elementos do deque em ordem reversa (do fim ao início)
+     * 
+     * Complexidade: O(n)
+     */
+    void imprimirDequeReverso() const;
+};
+
+#endif
@@ -2,7 +2,19 @@
 #include <iostream>
 
 Fila::Fila(int capacidade) 
-    : lista(capacidade), capacidadeMaxima(capacidade) {
+    : lista(2 * capacidade), capacidadeMaxima(capacidade), inicio(0) {
+    // A compactação garante que posições consumidas nunca passam do número
+    // de elementos vivos, então 2 * capacidade basta e a lista não redimensiona
+}
+
+void Fila::compactarSeNecessario() {
+    if (inicio * 2 < lista.getTamanho()) {
+        return;
+    }
+    
+    // Descarta as posições já consumidas com um único deslocamento
+    lista.RemoverPrimeiros(nullptr, inicio);
+    inicio = 0;
 }
 
 bool Fila::enfileirar(std::unique_ptr<Elemento> elemento) {
@@ -19,7 +31,36 @@ std::unique_ptr<Elemento> Fila::desenfileirar() {
         return nullptr;
     }
     
-    return lista.RemoverPrimeiro();
+    // Retira a frente sem deslocar a lista e avança o deslocamento de cabeça
+    std::unique_ptr<Elemento> elemento = lista.ExtrairPorIndice(inicio);
+    inicio++;
+    compactarSeNecessario();
+    return elemento;
+}
+
+int Fila::enfileirarLote(std::unique_ptr<Elemento>* lote, int quantidade) {
+    // Uma única verificação de capacidade para todo o lote
+    int livres = capacidadeMaxima - getTamanho();
+    int total = quantidade < livres ? quantidade : livres;
+    
+    for (int i = 0; i < total; i++) {
+        lista.InserirNoFinal(std::move(lote[i]));
+    }
+    return total > 0 ? total : 0;
+}
+
+int Fila::desenfileirarLote(std::unique_ptr<Elemento>* saida, int maxN) {
+    int total = maxN < getTamanho() ? maxN : getTamanho();
+    if (total <= 0) {
+        return 0;
+    }
+    
+    for (int i = 0; i < total; i++) {
+        saida[i] = lista.ExtrairPorIndice(inicio + i);
+    }
+    inicio += total;
+    compactarSeNecessario();
+    return total;
 }
 
 Elemento* Fila::consultarFrente() const {
@@ -27,20 +68,20 @@ Elemento* Fila::consultarFrente() const {
         return nullptr;
     }
     
-    // A frente da fila é o primeiro elemento da lista
-    return lista.obterElementoPorIndice(0);
+    // A frente da fila está no deslocamento de cabeça
+    return lista.obterElementoPorIndice(inicio);
 }
 
 bool Fila::filaVazia() const {
-    return lista.estaVazia();
+    return getTamanho() == 0;
 }
 
 bool Fila::filaCheia() const {
-    return lista.getTamanho() >= capacidadeMaxima;
+    return getTamanho() >= capacidadeMaxima;
 }
 
 int Fila::getTamanho() const {
-    return lista.getTamanho();
+    return lista.getTamanho() - inicio;
 }
 
 int Fila::getCapacidadeMaxima() const {
@@ -54,11 +95,11 @@ void Fila::imprimirFila() const {
     }
     
     std::cout << "=== FILA (Frente -> Final) ===" << std::endl;
-    // Imprime da frente (primeiro) para o final (último)
-    for (int i = 0; i < lista.getTamanho(); i++) {
+    // Imprime da frente (deslocamento de cabeça) para o final (último)
+    for (int i = inicio; i < lista.getTamanho(); i++) {
         Elemento* elem = lista.obterElementoPorIndice(i);
         if (elem) {
-            if (i == 0) {
+            if (i == inicio) {
                 std::cout << "[FRENTE] ";
             }
             elem->imprimirInfo();
@@ -70,4 +111,5 @@ void Fila::imprimirFila() const {
 
 void Fila::limpar() {
     lista.limpar();
+    inicio = 0;
 }
@@ -6,14 +6,17 @@
 #include <memory>
 
 /**
- * @brief Fila implementada por composição usando ListaNaoOrdenada (versão ineficiente)
+ * @brief Fila implementada por composição usando ListaNaoOrdenada
  * 
  * A fila segue o princípio FIFO (First In, First Out).
  * Utiliza ListaNaoOrdenada como estrutura interna para armazenar os elementos.
  * 
- * NOTA: Esta é a versão "ineficiente" da fila, onde:
+ * Para não deslocar a lista a cada remoção, a fila guarda um deslocamento
+ * de cabeça (inicio): desenfileirar() apenas retira o elemento dessa posição
+ * e avança o índice. As posições já consumidas são descartadas de uma vez
+ * (compactação preguiçosa) quando passam a ocupar metade da lista, de modo que:
  * - enfileirar(): insere no final da lista - O(1)
- * - desenfileirar(): remove do início da lista - O(n) devido ao deslocamento
+ * - desenfileirar(): retira da posição 'inicio' - O(1) amortizado
  * 
  * Operações:
  * - enfileirar(): adiciona elemento no final da fila
@@ -26,6 +29,15 @@ class Fila {
 private:
     ListaNaoOrdenada lista;  // Lista usada como estrutura interna
     int capacidadeMaxima;    // Capacidade máxima da fila
+    int inicio;              // Índice da frente na lista (posições anteriores já consumidas)
+
+    /**
+     * @brief Descarta as posições já consumidas quando ocupam metade da lista
+     * 
+     * Complexidade: O(1) amortizado - o deslocamento de k elementos restantes
+     *               só ocorre depois de pelo menos k remoções
+     */
+    void compactarSeNecessario();
 
 public:
     /**
@@ -52,10 +64,31 @@ public:
      * @brief Desenfileira o elemento do início da fila
      * @return Ponteiro único para o elemento removido (nullptr se fila vazia)
      * 
-     * Complexidade: O(n) - remoção do início da lista (ineficiente)
+     * Complexidade: O(1) amortizado - retira o elemento da frente sem deslocar a lista
      */
     std::unique_ptr<Elemento> desenfileirar();
 
+    /**
+     * @brief Enfileira um lote de elementos de uma só vez
+     * @param lote Array de elementos a serem enfileirados
+     * @param quantidade Número de elementos no array
+     * @return Número de elementos enfileirados (limitado pela capacidade);
+     *         os que não couberem permanecem no array
+     * 
+     * Complexidade: O(k) - uma verificação de capacidade para todo o lote
+     */
+    int enfileirarLote(std::unique_ptr<Elemento>* lote, int quantidade);
+
+    /**
+     * @brief Desenfileira até maxN elementos de uma só vez
+     * @param saida Array que recebe os elementos (frente da fila primeiro)
+     * @param maxN Número máximo de elementos a remover
+     * @return Número de elementos efetivamente removidos
+     * 
+     * Complexidade: O(k) amortizado - avança o deslocamento de cabeça pelo lote
+     */
+    int desenfileirarLote(std::unique_ptr<Elemento>* saida, int maxN);
+
     /**
      * @brief Consulta o elemento da frente da fila sem removê-lo
      * @return Ponteiro para o elemento da frente (nullptr se fila vazia)
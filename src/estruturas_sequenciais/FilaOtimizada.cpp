@@ -1,4 +1,5 @@
 #include "FilaOtimizada.h"
+#include <algorithm>
 #include <iostream>
 
 FilaOtimizada::FilaOtimizada(int capacidade) 
@@ -67,6 +68,40 @@ std::unique_ptr<Elemento> FilaOtimizada::desenfileirar() {
     return elemento;
 }
 
+int FilaOtimizada::enfileirarLote(std::unique_ptr<Elemento>* lote, int quantidade) {
+    int total = std::min(quantidade, capacidade - tamanho);
+    if (total <= 0) {
+        return 0;
+    }
+    
+    // Primeiro bloco: de 'fim' até o final do buffer
+    int primeiroBloco = std::min(total, capacidade - fim);
+    std::move(lote, lote + primeiroBloco, buffer + fim);
+    // Segundo bloco: o que sobrou, a partir do início do buffer
+    std::move(lote + primeiroBloco, lote + total, buffer);
+    
+    fim = (fim + total) % capacidade;
+    tamanho += total;
+    return total;
+}
+
+int FilaOtimizada::desenfileirarLote(std::unique_ptr<Elemento>* saida, int maxN) {
+    int total = std::min(maxN, tamanho);
+    if (total <= 0) {
+        return 0;
+    }
+    
+    // Primeiro bloco: de 'inicio' até o final do buffer
+    int primeiroBloco = std::min(total, capacidade - inicio);
+    std::move(buffer + inicio, buffer + inicio + primeiroBloco, saida);
+    // Segundo bloco: o que sobrou, a partir do início do buffer
+    std::move(buffer, buffer + (total - primeiroBloco), saida + primeiroBloco);
+    
+    inicio = (inicio + total) % capacidade;
+    tamanho -= total;
+    return total;
+}
+
 Elemento* FilaOtimizada::consultarFrente() const {
     if (filaVazia()) {
         return nullptr;
@@ -78,6 +78,28 @@ public:
      */
     std::unique_ptr<Elemento> desenfileirar();
 
+    /**
+     * @brief Enfileira um lote de elementos de uma só vez
+     * @param lote Array de elementos a serem enfileirados
+     * @param quantidade Número de elementos no array
+     * @return Número de elementos enfileirados (limitado pelo espaço livre);
+     *         os que não couberem permanecem no array
+     * 
+     * Complexidade: O(k) - no máximo dois movimentos contíguos de bloco,
+     *               um até o fim do buffer e outro a partir do índice 0
+     */
+    int enfileirarLote(std::unique_ptr<Elemento>* lote, int quantidade);
+
+    /**
+     * @brief Desenfileira até maxN elementos de uma só vez
+     * @param saida Array que recebe os elementos (frente da fila primeiro)
+     * @param maxN Número máximo de elementos a remover
+     * @return Número de elementos efetivamente removidos
+     * 
+     * Complexidade: O(k) - no máximo dois movimentos contíguos de bloco
+     */
+    int desenfileirarLote(std::unique_ptr<Elemento>* saida, int maxN);
+
     /**
      * @brief Consulta o elemento da frente da fila sem removê-lo
      * @return Ponteiro para o elemento da frente (nullptr se fila vazia)
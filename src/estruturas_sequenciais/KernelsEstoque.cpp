@@ -0,0 +1,233 @@
+#include "KernelsEstoque.h"
+#include <algorithm>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define KERNELS_ESTOQUE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace {
+    /**
+     * @brief Acumulador da soma compensada de Kahan
+     */
+    struct SomaKahan {
+        double soma = 0.0;
+        double compensacao = 0.0;  // Parte perdida no arredondamento da última adição
+
+        void adicionar(double parcela) {
+            double corrigida = parcela - compensacao;
+            double nova = soma + corrigida;
+            compensacao = (nova - soma) - corrigida;
+            soma = nova;
+        }
+    };
+
+    double valorTotalEscalar(const double* precos, const int* quantidades, int n, KernelsEstoque::ModoSoma modo) {
+        if (modo == KernelsEstoque::ModoSoma::Kahan) {
+            SomaKahan total;
+            for (int i = 0; i < n; i++) {
+                total.adicionar(precos[i] * quantidades[i]);
+            }
+            return total.soma;
+        }
+        double total = 0.0;
+        for (int i = 0; i < n; i++) {
+            total += precos[i] * quantidades[i];
+        }
+        return total;
+    }
+
+    int contarPositivosEscalar(const int* quantidades, int n) {
+        int positivos = 0;
+        for (int i = 0; i < n; i++) {
+            positivos += quantidades[i] > 0;
+        }
+        return positivos;
+    }
+
+    void filtrarAbaixoDeEscalar(const int* quantidades, int inicio, int n, int limite, std::vector<int>& linhas) {
+        for (int i = inicio; i < n; i++) {
+            if (quantidades[i] < limite) {
+                linhas.push_back(i);
+            }
+        }
+    }
+
+#ifdef KERNELS_ESTOQUE_AVX2
+    // Sem "fma": uma multiplicação fundida com a soma mudaria o arredondamento de que Kahan depende
+    __attribute__((target("avx2")))
+    __m256d produtos(const double* precos, const int* quantidades, int i) {
+        __m256d quantidade = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(quantidades + i)));
+        return _mm256_mul_pd(_mm256_loadu_pd(precos + i), quantidade);
+    }
+
+    __attribute__((target("avx2")))
+    double valorTotalAvx2(const double* precos, const int* quantidades, int n, KernelsEstoque::ModoSoma modo) {
+        alignas(32) double parcelas[8];
+        int i = 0;
+        if (modo == KernelsEstoque::ModoSoma::Kahan) {
+            // Dois acumuladores de 4 somas compensadas cada, combinados no fim
+            __m256d soma[2] = {_mm256_setzero_pd(), _mm256_setzero_pd()};
+            __m256d compensacao[2] = {_mm256_setzero_pd(), _mm256_setzero_pd()};
+            for (; i + 8 <= n; i += 8) {
+                for (int k = 0; k < 2; k++) {
+                    __m256d corrigida = _mm256_sub_pd(produtos(precos, quantidades, i + 4 * k), compensacao[k]);
+                    __m256d nova = _mm256_add_pd(soma[k], corrigida);
+                    compensacao[k] = _mm256_sub_pd(_mm256_sub_pd(nova, soma[k]), corrigida);
+                    soma[k] = nova;
+                }
+            }
+            SomaKahan total;
+            for (int k = 0; k < 2; k++) {
+                _mm256_store_pd(parcelas, soma[k]);
+                _mm256_store_pd(parcelas + 4, compensacao[k]);
+                for (int j = 0; j < 4; j++) {
+                    total.adicionar(parcelas[j]);
+                    total.adicionar(-parcelas[4 + j]);
+                }
+            }
+            for (; i < n; i++) {
+                total.adicionar(precos[i] * quantidades[i]);
+            }
+            return total.soma;
+        }
+
+        // Quatro acumuladores independentes escondem a latência da adição
+        __m256d soma[4] = {_mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd()};
+        for (; i + 16 <= n; i += 16) {
+            for (int k = 0; k < 4; k++) {
+                soma[k] = _mm256_add_pd(soma[k], produtos(precos, quantidades, i + 4 * k));
+            }
+        }
+        _mm256_store_pd(parcelas, _mm256_add_pd(_mm256_add_pd(soma[0], soma[1]), _mm256_add_pd(soma[2], soma[3])));
+        double total = (parcelas[0] + parcelas[1]) + (parcelas[2] + parcelas[3]);
+        for (; i < n; i++) {
+            total += precos[i] * quantidades[i];
+        }
+        return total;
+    }
+
+    __attribute__((target("avx2")))
+    int contarPositivosAvx2(const int* quantidades, int n) {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i contagem = zero;
+        int i = 0;
+        for (; i + 8 <= n; i += 8) {
+            __m256i quantidade = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(quantidades + i));
+            // A comparação dá -1 onde é verdadeira: subtrair soma 1
+            contagem = _mm256_sub_epi32(contagem, _mm256_cmpgt_epi32(quantidade, zero));
+        }
+        alignas(32) int parciais[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(parciais), contagem);
+        int positivos = 0;
+        for (int k = 0; k < 8; k++) {
+            positivos += parciais[k];
+        }
+        for (; i < n; i++) {
+            positivos += quantidades[i] > 0;
+        }
+        return positivos;
+    }
+
+    /**
+     * @brief Para cada máscara de 8 bits, as posições dos bits ligados, em ordem
+     *
+     * Com ela, as linhas aprovadas de um grupo de 8 são escritas de uma vez
+     * (uma permutação e um store), sem um desvio por linha.
+     */
+    struct TabelaCompactacao {
+        alignas(32) int posicoes[256][8];
+
+        TabelaCompactacao() {
+            for (int mascara = 0; mascara < 256; mascara++) {
+                int escritas = 0;
+                for (int bit = 0; bit < 8; bit++) {
+                    if (mascara & (1 << bit)) {
+                        posicoes[mascara][escritas++] = bit;
+                    }
+                }
+                while (escritas < 8) {
+                    posicoes[mascara][escritas++] = 0;
+                }
+            }
+        }
+    };
+
+    __attribute__((target("avx2,popcnt")))
+    void filtrarAbaixoDeAvx2(const int* quantidades, int n, int limite, std::vector<int>& linhas) {
+        static const TabelaCompactacao tabela;
+        const int LINHAS_POR_BLOCO = 1024;
+        const __m256i limiteVetor = _mm256_set1_epi32(limite);
+        int i = 0;
+        int fimVetorizado = n - n % 8;
+        while (i < fimVetorizado) {
+            // Abre espaço para o pior caso do bloco e depois devolve o que sobrou
+            int fimBloco = std::min(i + LINHAS_POR_BLOCO, fimVetorizado);
+            std::size_t base = linhas.size();
+            linhas.resize(base + (fimBloco - i));
+            int* saida = linhas.data() + base;
+            int escritas = 0;
+            for (; i < fimBloco; i += 8) {
+                __m256i quantidade = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(quantidades + i));
+                int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(limiteVetor, quantidade)));
+                __m256i posicoes = _mm256_add_epi32(_mm256_set1_epi32(i),
+                    _mm256_load_si256(reinterpret_cast<const __m256i*>(tabela.posicoes[mascara])));
+                // Grava sempre 8 posições; só as 'popcount' primeiras valem e as demais são sobrescritas
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(saida + escritas), posicoes);
+                escritas += __builtin_popcount(static_cast<unsigned>(mascara));
+            }
+            linhas.resize(base + escritas);
+        }
+        filtrarAbaixoDeEscalar(quantidades, i, n, limite, linhas);
+    }
+
+    bool usarAvx2(KernelsEstoque::Implementacao implementacao) {
+        return implementacao != KernelsEstoque::Implementacao::Escalar && KernelsEstoque::avx2Disponivel();
+    }
+#endif
+}
+
+bool KernelsEstoque::avx2Disponivel() {
+#ifdef KERNELS_ESTOQUE_AVX2
+    static const bool disponivel = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    return disponivel;
+#else
+    return false;
+#endif
+}
+
+double KernelsEstoque::valorTotal(const double* precos, const int* quantidades, int n,
+                                  ModoSoma modo, Implementacao implementacao) {
+#ifdef KERNELS_ESTOQUE_AVX2
+    if (usarAvx2(implementacao)) {
+        return valorTotalAvx2(precos, quantidades, n, modo);
+    }
+#else
+    (void)implementacao;
+#endif
+    return valorTotalEscalar(precos, quantidades, n, modo);
+}
+
+int KernelsEstoque::contarPositivos(const int* quantidades, int n, Implementacao implementacao) {
+#ifdef KERNELS_ESTOQUE_AVX2
+    if (usarAvx2(implementacao)) {
+        return contarPositivosAvx2(quantidades, n);
+    }
+#else
+    (void)implementacao;
+#endif
+    return contarPositivosEscalar(quantidades, n);
+}
+
+void KernelsEstoque::filtrarAbaixoDe(const int* quantidades, int n, int limite, std::vector<int>& linhas,
+                                     Implementacao implementacao) {
+#ifdef KERNELS_ESTOQUE_AVX2
+    if (usarAvx2(implementacao)) {
+        filtrarAbaixoDeAvx2(quantidades, n, limite, linhas);
+        return;
+    }
+#else
+    (void)implementacao;
+#endif
+    filtrarAbaixoDeEscalar(quantidades, 0, n, limite, linhas);
+}
@@ -0,0 +1,71 @@
+#ifndef KERNELS_ESTOQUE_H
+#define KERNELS_ESTOQUE_H
+
+#include <vector>
+
+/**
+ * @brief Laços de agregação de estoque sobre colunas de preço e quantidade
+ *
+ * Usados por TabelaProdutos, mas recebem só ponteiros para os arrays e
+ * servem para qualquer dado em colunas. Cada operação tem duas versões:
+ * escalar (portável) e AVX2 (4 preços ou 8 quantidades por instrução).
+ * A versão AVX2 é compilada sempre que o compilador é GCC/Clang para x86,
+ * com o atributo target, sem exigir -mavx2 do projeto; o processador é
+ * consultado uma vez durante a execução e, sem AVX2, a versão escalar é
+ * usada. Assim o mesmo executável roda em qualquer x86-64.
+ */
+class KernelsEstoque {
+public:
+    /**
+     * @brief Versão a usar em cada chamada
+     *
+     * Automatica escolhe AVX2 quando o processador tem; Avx2 sem suporte
+     * do processador também cai na versão escalar.
+     */
+    enum class Implementacao { Automatica, Escalar, Avx2 };
+
+    /**
+     * @brief Como as parcelas de uma soma são acumuladas
+     *
+     * Simples: soma direta; o erro de arredondamento cresce com o número
+     * de parcelas e a versão AVX2, que soma em outra ordem, pode diferir
+     * da escalar nos últimos dígitos.
+     * Kahan: soma compensada; guarda o arredondamento de cada adição e o
+     * devolve na próxima, com erro praticamente independente de n e
+     * resultados escalar e AVX2 iguais até o último dígito ou quase.
+     * Custa três operações a mais por parcela.
+     */
+    enum class ModoSoma { Simples, Kahan };
+
+    /**
+     * @brief true se o processador executa instruções AVX2 (consultado uma vez)
+     */
+    static bool avx2Disponivel();
+
+    /**
+     * @brief Soma de precos[i] * quantidades[i] para i em [0, n)
+     *
+     * Complexidade: O(n)
+     */
+    static double valorTotal(const double* precos, const int* quantidades, int n,
+                             ModoSoma modo = ModoSoma::Simples,
+                             Implementacao implementacao = Implementacao::Automatica);
+
+    /**
+     * @brief Número de quantidades maiores que zero (produtos disponíveis)
+     *
+     * Complexidade: O(n)
+     */
+    static int contarPositivos(const int* quantidades, int n,
+                               Implementacao implementacao = Implementacao::Automatica);
+
+    /**
+     * @brief Acrescenta a 'linhas' as posições i com quantidades[i] < limite, em ordem crescente
+     *
+     * Complexidade: O(n)
+     */
+    static void filtrarAbaixoDe(const int* quantidades, int n, int limite, std::vector<int>& linhas,
+                                Implementacao implementacao = Implementacao::Automatica);
+};
+
+#endif
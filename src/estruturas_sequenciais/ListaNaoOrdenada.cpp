@@ -15,6 +15,7 @@ ListaNaoOrdenada::ListaNaoOrdenada(int capacidadeInicial)
         throw std::invalid_argument("Capacidade deve ser maior que zero");
     }
     elementos = new std::unique_ptr<Elemento>[capacidade];
+    ids = new long[capacidade];
 }
 
 /**
@@ -24,6 +25,7 @@ ListaNaoOrdenada::ListaNaoOrdenada(int capacidadeInicial)
  */
 ListaNaoOrdenada::~ListaNaoOrdenada() {
     delete[] elementos;
+    delete[] ids;
 }
 
 /**
@@ -34,9 +36,11 @@ ListaNaoOrdenada::~ListaNaoOrdenada() {
 ListaNaoOrdenada::ListaNaoOrdenada(const ListaNaoOrdenada& outra) 
     : capacidade(outra.capacidade), tamanho(outra.tamanho) {
     elementos = new std::unique_ptr<Elemento>[capacidade];
+    ids = new long[capacidade];
     
     for (int i = 0; i < tamanho; i++) {
         elementos[i] = std::move(const_cast<ListaNaoOrdenada&>(outra).elementos[i]);
+        ids[i] = outra.ids[i];
     }
 }
 
@@ -48,13 +52,16 @@ ListaNaoOrdenada::ListaNaoOrdenada(const ListaNaoOrdenada& outra)
 ListaNaoOrdenada& ListaNaoOrdenada::operator=(const ListaNaoOrdenada& outra) {
     if (this != &outra) {
         delete[] elementos;
+        delete[] ids;
         
         capacidade = outra.capacidade;
         tamanho = outra.tamanho;
         elementos = new std::unique_ptr<Elemento>[capacidade];
+        ids = new long[capacidade];
         
         for (int i = 0; i < tamanho; i++) {
             elementos[i] = std::move(const_cast<ListaNaoOrdenada&>(outra).elementos[i]);
+            ids[i] = outra.ids[i];
         }
     }
     return *this;
@@ -68,13 +75,17 @@ ListaNaoOrdenada& ListaNaoOrdenada::operator=(const ListaNaoOrdenada& outra) {
 void ListaNaoOrdenada::redimensionar() {
     int novaCapacidade = capacidade * 2;
     std::unique_ptr<Elemento>* novosElementos = new std::unique_ptr<Elemento>[novaCapacidade];
+    long* novosIds = new long[novaCapacidade];
     
     for (int i = 0; i < tamanho; i++) {
         novosElementos[i] = std::move(elementos[i]);
+        novosIds[i] = ids[i];
     }
     
     delete[] elementos;
+    delete[] ids;
     elementos = novosElementos;
+    ids = novosIds;
     capacidade = novaCapacidade;
     
     std::cout << "Lista redimensionada para capacidade: " << capacidade << std::endl;
@@ -99,9 +110,11 @@ void ListaNaoOrdenada::InserirNoInicio(std::unique_ptr<Elemento> elemento) {
     // Desloca todos os elementos uma posição à direita
     for (int i = tamanho; i > 0; i--) {
         elementos[i] = std::move(elementos[i-1]);
+        ids[i] = ids[i-1];
     }
     
     // Insere o novo elemento na primeira posição
+    ids[0] = elemento->getID();
     elementos[0] = std::move(elemento);
     tamanho++;
 }
@@ -124,6 +137,7 @@ void ListaNaoOrdenada::InserirNoFinal(std::unique_ptr<Elemento> elemento) {
     }
     
     // Insere o elemento na última posição
+    ids[tamanho] = elemento->getID();
     elementos[tamanho] = std::move(elemento);
     tamanho++;
 }
@@ -145,12 +159,64 @@ std::unique_ptr<Elemento> ListaNaoOrdenada::RemoverPrimeiro() {
     // Desloca todos os elementos uma posição à esquerda
     for (int i = 0; i < tamanho - 1; i++) {
         elementos[i] = std::move(elementos[i+1]);
+        ids[i] = ids[i+1];
     }
     
     tamanho--;
     return elementoRemovido;
 }
 
+/**
+ * @brief Remove os primeiros elementos da lista de uma só vez
+ * @param saida Array que recebe os elementos removidos (nullptr para descartá-los)
+ * @param quantidade Número máximo de elementos a remover
+ * @return Número de elementos efetivamente removidos
+ * 
+ * Complexidade: O(n) - um único deslocamento para todo o lote
+ */
+int ListaNaoOrdenada::RemoverPrimeiros(std::unique_ptr<Elemento>* saida, int quantidade) {
+    if (quantidade > tamanho) {
+        quantidade = tamanho;
+    }
+    if (quantidade <= 0) {
+        return 0;
+    }
+    
+    // Entrega (ou descarta) os elementos removidos
+    for (int i = 0; i < quantidade; i++) {
+        if (saida) {
+            saida[i] = std::move(elementos[i]);
+        } else {
+            elementos[i].reset();
+        }
+    }
+    
+    // Desloca os elementos restantes 'quantidade' posições à esquerda, de uma vez
+    for (int i = quantidade; i < tamanho; i++) {
+        elementos[i - quantidade] = std::move(elementos[i]);
+        ids[i - quantidade] = ids[i];
+    }
+    
+    tamanho -= quantidade;
+    return quantidade;
+}
+
+/**
+ * @brief Retira o elemento de um índice sem deslocar os demais
+ * @param indice Índice do elemento (0-based)
+ * @return Ponteiro único para o elemento (nullptr se índice inválido)
+ * 
+ * Complexidade: O(1) - nenhum deslocamento
+ */
+std::unique_ptr<Elemento> ListaNaoOrdenada::ExtrairPorIndice(int indice) {
+    if (indice < 0 || indice >= tamanho) {
+        return nullptr;
+    }
+    
+    // A posição fica vazia até ser descartada por quem a extraiu
+    return std::move(elementos[indice]);
+}
+
 /**
  * @brief Remove o último elemento da lista
  * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
@@ -178,13 +244,14 @@ std::unique_ptr<Elemento> ListaNaoOrdenada::RemoverUltimo() {
 std::unique_ptr<Elemento> ListaNaoOrdenada::RemoverPeloId(long id) {
     // Busca linear pelo elemento
     for (int i = 0; i < tamanho; i++) {
-        if (elementos[i] && elementos[i]->getID() == id) {
+        if (ids[i] == id && elementos[i]) {
             // Guarda o elemento para retornar
             std::unique_ptr<Elemento> elementoRemovido = std::move(elementos[i]);
             
             // Desloca elementos posteriores uma posição à esquerda
             for (int j = i; j < tamanho - 1; j++) {
                 elementos[j] = std::move(elementos[j+1]);
+                ids[j] = ids[j+1];
             }
             
             tamanho--;
@@ -203,9 +270,9 @@ std::unique_ptr<Elemento> ListaNaoOrdenada::RemoverPeloId(long id) {
  * Complexidade: O(n) - busca linear sequencial
  */
 Elemento* ListaNaoOrdenada::BuscarPeloId(long id) const {
-    // Busca linear sequencial
+    // Busca linear sequencial (posições esvaziadas por ExtrairPorIndice guardam o ID antigo)
     for (int i = 0; i < tamanho; i++) {
-        if (elementos[i] && elementos[i]->getID() == id) {
+        if (ids[i] == id && elementos[i]) {
             return elementos[i].get();
         }
     }
@@ -228,8 +295,9 @@ bool ListaNaoOrdenada::AlterarPeloId(long id, std::unique_ptr<Elemento> novoElem
     
     // Busca linear pelo elemento
     for (int i = 0; i < tamanho; i++) {
-        if (elementos[i] && elementos[i]->getID() == id) {
+        if (ids[i] == id && elementos[i]) {
             // Substitui o elemento
+            ids[i] = novoElemento->getID();
             elementos[i] = std::move(novoElemento);
             return true;
         }
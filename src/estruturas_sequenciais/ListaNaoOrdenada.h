@@ -10,10 +10,14 @@
  * Implementa uma estrutura de dados linear onde os elementos são
  * armazenados em um array e mantidos na ordem de inserção.
  * Utiliza ponteiros inteligentes para gerenciar elementos da hierarquia.
+ * 
+ * Os IDs ficam copiados em um array paralelo: a busca por ID varre longs
+ * contíguos em vez de visitar cada objeto no heap.
  */
 class ListaNaoOrdenada {
 private:
     std::unique_ptr<Elemento>* elementos;  // Array de ponteiros para elementos
+    long* ids;                             // ids[i] == elementos[i]->getID(): a busca linear não desreferencia
     int capacidade;                        // Capacidade máxima da lista
     int tamanho;                          // Número atual de elementos
 
@@ -71,6 +75,29 @@ public:
      */
     std::unique_ptr<Elemento> RemoverPrimeiro();
 
+    /**
+     * @brief Remove os primeiros elementos da lista de uma só vez
+     * @param saida Array que recebe os elementos removidos (nullptr para descartá-los)
+     * @param quantidade Número máximo de elementos a remover
+     * @return Número de elementos efetivamente removidos
+     * 
+     * Complexidade: O(n) - um único deslocamento para todo o lote
+     */
+    int RemoverPrimeiros(std::unique_ptr<Elemento>* saida, int quantidade);
+
+    /**
+     * @brief Retira o elemento de um índice sem deslocar os demais
+     * @param indice Índice do elemento (0-based)
+     * @return Ponteiro único para o elemento (nullptr se índice inválido)
+     * 
+     * A posição fica vazia (nullptr) e continua contando no tamanho até ser
+     * descartada, por exemplo com RemoverPrimeiros(nullptr, k). Usado por
+     * estruturas compostas que controlam suas próprias posições livres.
+     * 
+     * Complexidade: O(1) - nenhum deslocamento
+     */
+    std::unique_ptr<Elemento> ExtrairPorIndice(int indice);
+
     /**
      * @brief Remove o último elemento da lista
      * @return Ponteiro único para o elemento removido (nullptr se lista vazia)
@@ -15,6 +15,7 @@ ListaOrdenada::ListaOrdenada(int capacidadeInicial)
         throw std::invalid_argument("Capacidade deve ser maior que zero");
     }
     elementos = new std::unique_ptr<Elemento>[capacidade];
+    ids = new long[capacidade];
 }
 
 /**
@@ -24,6 +25,7 @@ ListaOrdenada::ListaOrdenada(int capacidadeInicial)
  */
 ListaOrdenada::~ListaOrdenada() {
     delete[] elementos;
+    delete[] ids;
 }
 
 /**
@@ -34,9 +36,11 @@ ListaOrdenada::~ListaOrdenada() {
 ListaOrdenada::ListaOrdenada(const ListaOrdenada& outra) 
     : capacidade(outra.capacidade), tamanho(outra.tamanho) {
     elementos = new std::unique_ptr<Elemento>[capacidade];
+    ids = new long[capacidade];
     
     for (int i = 0; i < tamanho; i++) {
         elementos[i] = std::move(const_cast<ListaOrdenada&>(outra).elementos[i]);
+        ids[i] = outra.ids[i];
     }
 }
 
@@ -48,13 +52,16 @@ ListaOrdenada::ListaOrdenada(const ListaOrdenada& outra)
 ListaOrdenada& ListaOrdenada::operator=(const ListaOrdenada& outra) {
     if (this != &outra) {
         delete[] elementos;
+        delete[] ids;
         
         capacidade = outra.capacidade;
         tamanho = outra.tamanho;
         elementos = new std::unique_ptr<Elemento>[capacidade];
+        ids = new long[capacidade];
         
         for (int i = 0; i < tamanho; i++) {
             elementos[i] = std::move(const_cast<ListaOrdenada&>(outra).elementos[i]);
+            ids[i] = outra.ids[i];
         }
     }
     return *this;
@@ -68,14 +75,18 @@ ListaOrdenada& ListaOrdenada::operator=(const ListaOrdenada& outra) {
 void ListaOrdenada::redimensionar() {
     int novaCapacidade = capacidade * 2;
     std::unique_ptr<Elemento>* novosElementos = new std::unique_ptr<Elemento>[novaCapacidade];
+    long* novosIds = new long[novaCapacidade];
     
     // Move todos os elementos para o novo array
     for (int i = 0; i < tamanho; i++) {
         novosElementos[i] = std::move(elementos[i]);
+        novosIds[i] = ids[i];
     }
     
     delete[] elementos;
+    delete[] ids;
     elementos = novosElementos;
+    ids = novosIds;
     capacidade = novaCapacidade;
     
     std::cout << "Lista ordenada redimensionada para capacidade: " << capacidade << std::endl;
@@ -95,11 +106,11 @@ int ListaOrdenada::buscaBinaria(long id) const {
     while (esquerda <= direita) {
         int meio = esquerda + (direita - esquerda) / 2;
         
-        if (elementos[meio]->getID() == id) {
+        if (ids[meio] == id) {
             return meio; // Encontrado
         }
         
-        if (elementos[meio]->getID() < id) {
+        if (ids[meio] < id) {
             esquerda = meio + 1; // Busca na metade direita
         } else {
             direita = meio - 1;  // Busca na metade esquerda
@@ -123,7 +134,7 @@ int ListaOrdenada::encontrarPosicaoInsercao(long id) const {
     while (esquerda < direita) {
         int meio = esquerda + (direita - esquerda) / 2;
         
-        if (elementos[meio]->getID() < id) {
+        if (ids[meio] < id) {
             esquerda = meio + 1;
         } else {
             direita = meio;
@@ -150,15 +161,18 @@ void ListaOrdenada::InserirOrdenado(std::unique_ptr<Elemento> elemento) {
     }
     
     // Encontra a posição correta para inserção
-    int posicao = encontrarPosicaoInsercao(elemento->getID());
+    long id = elemento->getID();
+    int posicao = encontrarPosicaoInsercao(id);
     
     // Desloca elementos para a direita para abrir espaço
     for (int i = tamanho; i > posicao; i--) {
         elementos[i] = std::move(elementos[i-1]);
+        ids[i] = ids[i-1];
     }
     
     // Insere o elemento na posição correta
     elementos[posicao] = std::move(elemento);
+    ids[posicao] = id;
     tamanho++;
 }
 
@@ -203,6 +217,7 @@ std::unique_ptr<Elemento> ListaOrdenada::RemoverPrimeiro() {
     // Desloca todos os elementos uma posição à esquerda
     for (int i = 0; i < tamanho - 1; i++) {
         elementos[i] = std::move(elementos[i+1]);
+        ids[i] = ids[i+1];
     }
     
     tamanho--;
@@ -247,6 +262,7 @@ std::unique_ptr<Elemento> ListaOrdenada::RemoverPeloId(long id) {
     // Desloca elementos posteriores uma posição à esquerda
     for (int i = indice; i < tamanho - 1; i++) {
         elementos[i] = std::move(elementos[i+1]);
+        ids[i] = ids[i+1];
     }
     
     tamanho--;
@@ -300,6 +316,7 @@ bool ListaOrdenada::AlterarPeloId(long id, std::unique_ptr<Elemento> novoElement
     // Remove o elemento atual
     for (int i = indice; i < tamanho - 1; i++) {
         elementos[i] = std::move(elementos[i+1]);
+        ids[i] = ids[i+1];
     }
     tamanho--;
     
@@ -396,8 +413,9 @@ Elemento* ListaOrdenada::obterElementoPorIndice(int indice) const {
  * Complexidade: O(n) - verifica ordenação sequencial
  */
 bool ListaOrdenada::verificarOrdenacao() const {
-    for (int i = 1; i < tamanho; i++) {
-        if (elementos[i-1]->getID() > elementos[i]->getID()) {
+    for (int i = 0; i < tamanho; i++) {
+        // Confere também a cópia dos IDs contra os próprios elementos
+        if (ids[i] != elementos[i]->getID() || (i > 0 && ids[i-1] > ids[i])) {
             return false;
         }
     }
@@ -10,10 +10,15 @@
  * Implementa uma estrutura de dados linear onde os elementos são
  * mantidos ordenados por ID em ordem crescente. Utiliza busca binária
  * para operações de busca com complexidade O(log n).
+ * 
+ * Os IDs ficam copiados em um array paralelo ao de ponteiros: cada passo
+ * da busca binária lê um long contíguo, em vez de seguir o ponteiro até o
+ * objeto no heap (uma falta de cache por passo em listas grandes).
  */
 class ListaOrdenada {
 private:
     std::unique_ptr<Elemento>* elementos;  // Array de ponteiros para elementos
+    long* ids;                             // ids[i] == elementos[i]->getID(): a busca binária não desreferencia
     int capacidade;                        // Capacidade máxima da lista
     int tamanho;                          // Número atual de elementos
 
@@ -0,0 +1,87 @@
+#include "ListaValores.h"
+#include <algorithm>
+#include <iostream>
+
+void ListaValores::inserirNoFim(ElementoValor elemento) {
+    ids.push_back(elemento.getID());
+    try {
+        elementos.push_back(std::move(elemento));
+    } catch (...) {
+        // Mantém ids[i] == elementos[i].getID() se a cópia ou a realocação falhar
+        ids.pop_back();
+        throw;
+    }
+}
+
+ElementoValor* ListaValores::buscarPeloId(long id) {
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        if (ids[i] == id) {
+            return &elementos[i];
+        }
+    }
+    return nullptr;
+}
+
+const ElementoValor* ListaValores::buscarPeloId(long id) const {
+    return const_cast<ListaValores*>(this)->buscarPeloId(id);
+}
+
+std::optional<ElementoValor> ListaValores::removerPeloId(long id) {
+    auto posicao = std::find(ids.begin(), ids.end(), id);
+    if (posicao == ids.end()) {
+        return std::nullopt;
+    }
+    auto it = elementos.begin() + (posicao - ids.begin());
+    std::optional<ElementoValor> removido(std::move(*it));
+    elementos.erase(it);
+    ids.erase(posicao);
+    return removido;
+}
+
+bool ListaValores::alterarPeloId(long id, ElementoValor novoElemento) {
+    auto posicao = std::find(ids.begin(), ids.end(), id);
+    if (posicao == ids.end()) {
+        return false;
+    }
+    // O novo elemento pode ter outro ID; o ID só muda depois que a atribuição deu certo
+    long novoId = novoElemento.getID();
+    elementos[posicao - ids.begin()] = std::move(novoElemento);
+    *posicao = novoId;
+    return true;
+}
+
+ElementoValor* ListaValores::obterPorIndice(int indice) {
+    if (indice < 0 || indice >= getTamanho()) {
+        return nullptr;
+    }
+    return &elementos[indice];
+}
+
+const ElementoValor* ListaValores::obterPorIndice(int indice) const {
+    return const_cast<ListaValores*>(this)->obterPorIndice(indice);
+}
+
+void ListaValores::imprimirLista() const {
+    std::cout << "=== LISTA DE VALORES ===" << std::endl;
+    std::cout << "Tamanho: " << getTamanho() << std::endl;
+
+    if (elementos.empty()) {
+        std::cout << "Lista vazia!" << std::endl;
+    } else {
+        for (int i = 0; i < getTamanho(); i++) {
+            std::cout << "\n[" << i << "] ";
+            elementos[i].imprimirInfo();
+        }
+    }
+    std::cout << "========================" << std::endl;
+}
+
+void ListaValores::reservar(int quantidade) {
+    elementos.reserve(quantidade);
+    ids.reserve(quantidade);
+}
+
+void ListaValores::limpar() {
+    elementos.clear();
+    ids.clear();
+}
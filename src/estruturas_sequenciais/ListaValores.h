@@ -0,0 +1,160 @@
+#ifndef LISTA_VALORES_H
+#define LISTA_VALORES_H
+
+#include "../elementos/ElementoValor.h"
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lista de elementos guardados por valor, contíguos em um vetor
+ *
+ * As outras estruturas guardam std::unique_ptr<Elemento>: um bloco no
+ * heap por elemento e um ponteiro a seguir em cada acesso. Aqui cada
+ * posição do vetor é um ElementoValor com o objeto dentro, então criar a
+ * lista não aloca por elemento (fora os textos longos que os próprios
+ * objetos alocam) e uma varredura lê a memória em ordem.
+ *
+ * Como em ListaNaoOrdenada, os IDs ficam copiados em um vetor paralelo:
+ * cada ElementoValor ocupa o tamanho do maior tipo, e a busca por ID lê
+ * só os longs em vez de percorrer os objetos inteiros.
+ *
+ * Serve só para Aluno, Funcionario e Produto (ver ElementoValor). Inserir
+ * ou remover pode mover os outros elementos: ponteiros e referências
+ * obtidos antes deixam de valer, como em um std::vector. Para trocar um
+ * elemento inteiro, use alterarPeloId (a atribuição direta por um
+ * ponteiro obtido aqui não atualiza a cópia do ID).
+ */
+class ListaValores {
+private:
+    std::vector<ElementoValor> elementos;
+    std::vector<long> ids;                 // ids[i] == elementos[i].getID(), mesmo após uma exceção
+
+public:
+    /**
+     * @brief Insere uma cópia (ou o objeto movido) no fim
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void inserirNoFim(ElementoValor elemento);
+
+    /**
+     * @brief Constrói um Tipo direto no fim do vetor, sem cópia
+     *
+     * Exemplo: lista.construirNoFim<Aluno>(id, nome, curso, nota)
+     * Complexidade: O(1) amortizado
+     */
+    template<typename Tipo, typename... Argumentos>
+    Tipo& construirNoFim(Argumentos&&... argumentos) {
+        ElementoValor& elemento = elementos.emplace_back(std::in_place_type<Tipo>, std::forward<Argumentos>(argumentos)...);
+        try {
+            ids.push_back(elemento.getID());
+        } catch (...) {
+            // Sem o ID, o elemento não pode ficar: os vetores continuam paralelos
+            elementos.pop_back();
+            throw;
+        }
+        return *elemento.como<Tipo>();
+    }
+
+    /**
+     * @brief Busca um elemento pelo ID
+     * @return Ponteiro para o elemento, ou nullptr se não encontrado
+     *
+     * Complexidade: O(n) - varre só o vetor de IDs
+     */
+    ElementoValor* buscarPeloId(long id);
+    const ElementoValor* buscarPeloId(long id) const;
+
+    /**
+     * @brief Remove o primeiro elemento com o ID
+     * @return O elemento removido, ou vazio se não encontrado
+     *
+     * Complexidade: O(n) - os seguintes andam uma posição
+     */
+    std::optional<ElementoValor> removerPeloId(long id);
+
+    /**
+     * @brief Substitui o elemento com o ID
+     * @return true se o ID foi encontrado
+     *
+     * Complexidade: O(n)
+     */
+    bool alterarPeloId(long id, ElementoValor novoElemento);
+
+    /**
+     * @brief Elemento de uma posição
+     * @return Ponteiro para o elemento, ou nullptr se o índice é inválido
+     *
+     * Complexidade: O(1)
+     */
+    ElementoValor* obterPorIndice(int indice);
+    const ElementoValor* obterPorIndice(int indice) const;
+
+    /**
+     * @brief Chama funcao(elemento) para cada elemento, do início ao fim
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Funcao>
+    void paraCada(Funcao funcao) {
+        for (ElementoValor& elemento : elementos) {
+            funcao(elemento);
+        }
+    }
+
+    template<typename Funcao>
+    void paraCada(Funcao funcao) const {
+        for (const ElementoValor& elemento : elementos) {
+            funcao(elemento);
+        }
+    }
+
+    /**
+     * @brief Copia para a lista os elementos de uma estrutura
+     * @param estrutura Qualquer estrutura com paraCada(funcao(Elemento&)),
+     *                  como as listas encadeadas; elementos que não são
+     *                  Aluno, Funcionario nem Produto são ignorados
+     * @return Número de elementos copiados
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Estrutura>
+    int importar(const Estrutura& estrutura) {
+        int importados = 0;
+        estrutura.paraCada([this, &importados](Elemento& elemento) {
+            if (std::optional<ElementoValor> copia = ElementoValor::copiarDe(elemento)) {
+                inserirNoFim(std::move(*copia));
+                importados++;
+            }
+        });
+        return importados;
+    }
+
+    /**
+     * @brief Insere no fim da lista uma cópia no heap de cada elemento, na mesma ordem
+     * @param lista Estrutura com inserirNoFim(std::unique_ptr<Elemento>)
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Lista>
+    void exportar(Lista& lista) const {
+        for (const ElementoValor& elemento : elementos) {
+            lista.inserirNoFim(elemento.paraElemento());
+        }
+    }
+
+    void imprimirLista() const;
+
+    int getTamanho() const { return static_cast<int>(elementos.size()); }
+    bool estaVazia() const { return elementos.empty(); }
+
+    /**
+     * @brief Reserva espaço para um número de elementos (evita mover os já inseridos)
+     */
+    void reservar(int quantidade);
+
+    void limpar();
+};
+
+#endif
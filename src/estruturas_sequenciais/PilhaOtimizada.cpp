@@ -0,0 +1,50 @@
+#include "PilhaOtimizada.h"
+#include <algorithm>
+#include <iostream>
+
+PilhaOtimizada::PilhaOtimizada()
+    : dados(bufferInterno), tamanho(0), capacidade(CAPACIDADE_INTERNA) {
+}
+
+PilhaOtimizada::~PilhaOtimizada() {
+    limpar();
+    if (!usandoBufferInterno()) {
+        delete[] dados;
+    }
+}
+
+void PilhaOtimizada::crescer() {
+    int novaCapacidade = capacidade * 2;
+    Elemento** novosDados = new Elemento*[novaCapacidade];
+    std::copy(dados, dados + tamanho, novosDados);
+
+    if (!usandoBufferInterno()) {
+        delete[] dados;
+    }
+    dados = novosDados;
+    capacidade = novaCapacidade;
+}
+
+void PilhaOtimizada::imprimirPilha() const {
+    if (pilhaVazia()) {
+        std::cout << "Pilha vazia!" << std::endl;
+        return;
+    }
+    
+    std::cout << "=== PILHA OTIMIZADA (Topo -> Base) ===" << std::endl;
+    for (int i = tamanho - 1; i >= 0; i--) {
+        if (i == tamanho - 1) {
+            std::cout << "[TOPO] ";
+        }
+        dados[i]->imprimirInfo();
+        std::cout << std::endl;
+    }
+    std::cout << "=== FIM DA PILHA ===" << std::endl;
+}
+
+void PilhaOtimizada::limpar() {
+    for (int i = 0; i < tamanho; i++) {
+        delete dados[i];
+    }
+    tamanho = 0;
+}
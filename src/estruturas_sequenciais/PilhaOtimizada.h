@@ -0,0 +1,146 @@
+#ifndef PILHA_OTIMIZADA_H
+#define PILHA_OTIMIZADA_H
+
+#include "../elementos/Elemento.h"
+#include <memory>
+
+/**
+ * @brief Pilha Otimizada implementada diretamente sobre um array
+ * 
+ * A pilha segue o princípio LIFO (Last In, First Out).
+ * Diferente da Pilha por composição, não passa pela ListaNaoOrdenada:
+ * os primeiros CAPACIDADE_INTERNA elementos ficam em um buffer dentro do
+ * próprio objeto e só quando ele enche os elementos migram para o heap
+ * (dobrando a capacidade a cada vez).
+ * 
+ * empilhar() e desempilhar() são definidos no cabeçalho para que o
+ * compilador os expanda no local da chamada; o caminho comum é apenas
+ * uma comparação, um acesso ao array e um incremento/decremento.
+ * 
+ * Operações:
+ * - empilhar(): adiciona elemento no topo da pilha
+ * - desempilhar(): remove e retorna elemento do topo da pilha
+ * - consultarTopo(): consulta elemento do topo sem removê-lo
+ * - pilhaVazia(): verifica se a pilha está vazia
+ */
+class PilhaOtimizada {
+public:
+    static const int CAPACIDADE_INTERNA = 16;  // Posições guardadas no próprio objeto
+
+private:
+    Elemento** dados;                              // Buffer em uso (interno ou no heap)
+    int tamanho;                                   // Número atual de elementos
+    int capacidade;                                // Capacidade do buffer em uso
+    Elemento* bufferInterno[CAPACIDADE_INTERNA];   // Buffer embutido para pilhas pequenas
+
+    /**
+     * @brief Dobra a capacidade, migrando os elementos para o heap
+     * 
+     * Complexidade: O(n) - executado raramente (O(1) amortizado por empilhar)
+     */
+    void crescer();
+
+public:
+    /**
+     * @brief Construtor da pilha otimizada (começa usando o buffer interno)
+     */
+    PilhaOtimizada();
+
+    /**
+     * @brief Destrutor - libera os elementos restantes e o buffer do heap
+     */
+    ~PilhaOtimizada();
+
+    // A pilha possui os elementos: cópia não permitida
+    PilhaOtimizada(const PilhaOtimizada&) = delete;
+    PilhaOtimizada& operator=(const PilhaOtimizada&) = delete;
+
+    /**
+     * @brief Empilha um elemento no topo da pilha
+     * @param elemento Ponteiro único para o elemento a ser empilhado
+     * @return true se a operação foi bem-sucedida, false se o elemento é nulo
+     * 
+     * Complexidade: O(1) amortizado - sem limite de capacidade
+     */
+    bool empilhar(std::unique_ptr<Elemento> elemento) {
+        if (!elemento) {
+            return false;  // Proteção contra elemento nulo
+        }
+        if (tamanho == capacidade) {
+            crescer();
+        }
+        dados[tamanho++] = elemento.release();
+        return true;
+    }
+
+    /**
+     * @brief Desempilha o elemento do topo da pilha
+     * @return Ponteiro único para o elemento removido (nullptr se pilha vazia)
+     * 
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Elemento> desempilhar() {
+        if (tamanho == 0) {
+            return nullptr;
+        }
+        return std::unique_ptr<Elemento>(dados[--tamanho]);
+    }
+
+    /**
+     * @brief Consulta o elemento do topo da pilha sem removê-lo
+     * @return Ponteiro para o elemento do topo (nullptr se pilha vazia)
+     * 
+     * Complexidade: O(1)
+     */
+    Elemento* consultarTopo() const {
+        return tamanho == 0 ? nullptr : dados[tamanho - 1];
+    }
+
+    /**
+     * @brief Verifica se a pilha está vazia
+     * @return true se a pilha está vazia
+     * 
+     * Complexidade: O(1)
+     */
+    bool pilhaVazia() const { return tamanho == 0; }
+
+    /**
+     * @brief Retorna o tamanho atual da pilha
+     * @return Número de elementos na pilha
+     * 
+     * Complexidade: O(1)
+     */
+    int getTamanho() const { return tamanho; }
+
+    /**
+     * @brief Retorna a capacidade do buffer em uso
+     * @return CAPACIDADE_INTERNA enquanto a pilha não migrou para o heap
+     * 
+     * Complexidade: O(1)
+     */
+    int getCapacidade() const { return capacidade; }
+
+    /**
+     * @brief Indica se os elementos ainda estão no buffer interno
+     * @return true se nenhuma alocação no heap foi feita
+     * 
+     * Complexidade: O(1)
+     */
+    bool usandoBufferInterno() const { return dados == bufferInterno; }
+
+    /**
+     * @brief Imprime todos os elementos da pilha (do topo para a base)
+     * 
+     * Complexidade: O(n)
+     */
+    void imprimirPilha() const;
+
+    /**
+     * @brief Limpa todos os elementos da pilha (mantém o buffer atual)
+     * 
+     * Complexidade: O(n)
+     */
+    void limpar();
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "TabelaAlunos.h"
+
+void TabelaAlunos::adicionar(long id, std::string_view nome, const std::string& curso, double nota) {
+    adicionar(id, nome, TextoInternado(curso), nota);
+}
+
+void TabelaAlunos::adicionar(long id, std::string_view nome, TextoInternado curso, double nota) {
+    ids.push_back(id);
+    nomes.adicionar(nome);
+    cursos.adicionar(curso);
+    notas.push_back(nota);
+}
+
+void TabelaAlunos::adicionar(const Aluno& aluno) {
+    adicionar(aluno.getID(), aluno.getNome(), aluno.getCursoInternado(), aluno.getNota());
+}
+
+std::unique_ptr<Aluno> TabelaAlunos::paraAluno(int linha) const {
+    if (linha < 0 || linha >= getTamanho()) {
+        return nullptr;
+    }
+    return std::make_unique<Aluno>(ids[linha], std::string(nomes.obter(linha)), cursos.obter(linha), notas[linha]);
+}
+
+double TabelaAlunos::mediaNotas() const {
+    if (notas.empty()) {
+        return 0.0;
+    }
+    double soma = 0.0;
+    for (double nota : notas) {
+        soma += nota;
+    }
+    return soma / notas.size();
+}
+
+int TabelaAlunos::contarAprovados(double notaMinima) const {
+    int aprovados = 0;
+    for (double nota : notas) {
+        aprovados += nota >= notaMinima;
+    }
+    return aprovados;
+}
+
+std::vector<double> TabelaAlunos::mediaNotasPorCurso() const {
+    int numeroCursos = cursos.getNumeroValores();
+    std::vector<double> medias(numeroCursos, 0.0);
+    std::vector<int> quantidades(numeroCursos, 0);
+    const std::uint32_t* codigo = cursos.dadosCodigos();
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        medias[codigo[i]] += notas[i];
+        quantidades[codigo[i]]++;
+    }
+    // Todo código do dicionário tem ao menos uma linha
+    for (int c = 0; c < numeroCursos; c++) {
+        medias[c] /= quantidades[c];
+    }
+    return medias;
+}
+
+int TabelaAlunos::buscarLinhaPorId(long id) const {
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        if (ids[i] == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void TabelaAlunos::reservar(int linhas, int caracteresPorNome) {
+    ids.reserve(linhas);
+    nomes.reservar(linhas, caracteresPorNome);
+    cursos.reservar(linhas);
+    notas.reserve(linhas);
+}
+
+void TabelaAlunos::limpar() {
+    ids.clear();
+    nomes.limpar();
+    cursos.limpar();
+    notas.clear();
+}
@@ -0,0 +1,144 @@
+#ifndef TABELA_ALUNOS_H
+#define TABELA_ALUNOS_H
+
+#include "Colunas.h"
+#include "../elementos/Aluno.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Alunos armazenados por colunas (structure of arrays)
+ *
+ * Mesma organização de TabelaProdutos: matrículas e notas em vetores
+ * contíguos, o nome em uma ColunaTexto e o curso codificado por
+ * dicionário. Médias, contagens e agrupamentos por curso leem só as
+ * colunas de que precisam.
+ */
+class TabelaAlunos {
+private:
+    std::vector<long> ids;
+    ColunaTexto nomes;
+    ColunaCategorias cursos;
+    std::vector<double> notas;
+
+public:
+    /**
+     * @brief Acrescenta uma linha com os campos de um aluno
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(long id, std::string_view nome, const std::string& curso, double nota);
+
+    /**
+     * @brief Acrescenta uma linha com o curso já internado
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(long id, std::string_view nome, TextoInternado curso, double nota);
+
+    /**
+     * @brief Acrescenta uma linha copiando os campos do aluno
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(const Aluno& aluno);
+
+    /**
+     * @brief Copia para a tabela os alunos de uma estrutura
+     * @param estrutura Qualquer estrutura com paraCada(funcao(Elemento&));
+     *                  elementos que não são Aluno são ignorados
+     * @return Número de linhas acrescentadas
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Estrutura>
+    int importar(const Estrutura& estrutura) {
+        int importados = 0;
+        estrutura.paraCada([this, &importados](Elemento& elemento) {
+            if (const Aluno* aluno = dynamic_cast<const Aluno*>(&elemento)) {
+                adicionar(*aluno);
+                importados++;
+            }
+        });
+        return importados;
+    }
+
+    /**
+     * @brief Cria um Aluno com os campos de uma linha
+     * @return Novo aluno, ou nullptr se a linha não existe
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Aluno> paraAluno(int linha) const;
+
+    /**
+     * @brief Insere no fim da lista um Aluno por linha, na ordem da tabela
+     * @param lista Estrutura com inserirNoFim(std::unique_ptr<Elemento>)
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Lista>
+    void exportar(Lista& lista) const {
+        for (int linha = 0; linha < getTamanho(); linha++) {
+            lista.inserirNoFim(paraAluno(linha));
+        }
+    }
+
+    /**
+     * @brief Média das notas (0 se a tabela está vazia)
+     *
+     * Complexidade: O(n) - lê só a coluna de notas
+     */
+    double mediaNotas() const;
+
+    /**
+     * @brief Número de alunos com nota maior ou igual à mínima
+     *
+     * Complexidade: O(n) - lê só a coluna de notas
+     */
+    int contarAprovados(double notaMinima) const;
+
+    /**
+     * @brief Média das notas de cada curso
+     * @return Vetor indexado pelo código do curso (ver getCursos())
+     *
+     * Complexidade: O(n + c), c = número de cursos
+     */
+    std::vector<double> mediaNotasPorCurso() const;
+
+    /**
+     * @brief Linha de uma matrícula (a primeira, se ela se repete)
+     * @return Linha, ou -1 se a matrícula não está na tabela
+     *
+     * Complexidade: O(n) - varre só a coluna de IDs
+     */
+    int buscarLinhaPorId(long id) const;
+
+    // Campos de uma linha (linha deve estar em [0, getTamanho()))
+    long getId(int linha) const { return ids[linha]; }
+    std::string_view getNome(int linha) const { return nomes.obter(linha); }
+    const std::string& getCurso(int linha) const { return cursos.obter(linha); }
+    double getNota(int linha) const { return notas[linha]; }
+
+    void setNota(int linha, double novaNota) { notas[linha] = novaNota; }
+
+    // Colunas inteiras, para varreduras fora da classe
+    const long* dadosIds() const { return ids.data(); }
+    const double* dadosNotas() const { return notas.data(); }
+    const ColunaCategorias& getCursos() const { return cursos; }
+
+    int getTamanho() const { return static_cast<int>(ids.size()); }
+    bool estaVazia() const { return ids.empty(); }
+
+    /**
+     * @brief Reserva espaço para um número de linhas
+     * @param caracteresPorNome Estimativa do tamanho médio dos nomes
+     */
+    void reservar(int linhas, int caracteresPorNome = 16);
+
+    void limpar();
+};
+
+#endif
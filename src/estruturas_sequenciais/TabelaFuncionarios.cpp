@@ -0,0 +1,89 @@
+#include "TabelaFuncionarios.h"
+
+void TabelaFuncionarios::adicionar(long id, std::string_view nome, const std::string& cargo,
+                                   const std::string& departamento, double salario) {
+    adicionar(id, nome, TextoInternado(cargo), TextoInternado(departamento), salario);
+}
+
+void TabelaFuncionarios::adicionar(long id, std::string_view nome, TextoInternado cargo,
+                                   TextoInternado departamento, double salario) {
+    ids.push_back(id);
+    nomes.adicionar(nome);
+    cargos.adicionar(cargo);
+    departamentos.adicionar(departamento);
+    salarios.push_back(salario);
+}
+
+void TabelaFuncionarios::adicionar(const Funcionario& funcionario) {
+    adicionar(funcionario.getID(), funcionario.getNome(), funcionario.getCargoInternado(),
+              funcionario.getDepartamentoInternado(), funcionario.getSalario());
+}
+
+std::unique_ptr<Funcionario> TabelaFuncionarios::paraFuncionario(int linha) const {
+    if (linha < 0 || linha >= getTamanho()) {
+        return nullptr;
+    }
+    return std::make_unique<Funcionario>(ids[linha], std::string(nomes.obter(linha)), cargos.obter(linha),
+                                         departamentos.obter(linha), salarios[linha]);
+}
+
+double TabelaFuncionarios::somaSalarios() const {
+    double soma = 0.0;
+    for (double salario : salarios) {
+        soma += salario;
+    }
+    return soma;
+}
+
+double TabelaFuncionarios::mediaSalarios() const {
+    return salarios.empty() ? 0.0 : somaSalarios() / salarios.size();
+}
+
+int TabelaFuncionarios::contarSalarioAcimaDe(double valor) const {
+    int quantidade = 0;
+    for (double salario : salarios) {
+        quantidade += salario > valor;
+    }
+    return quantidade;
+}
+
+void TabelaFuncionarios::aplicarReajuste(double percentual) {
+    double fator = 1.0 + percentual / 100.0;
+    for (double& salario : salarios) {
+        salario *= fator;
+    }
+}
+
+std::vector<double> TabelaFuncionarios::folhaPorDepartamento() const {
+    std::vector<double> folhas(departamentos.getNumeroValores(), 0.0);
+    const std::uint32_t* codigo = departamentos.dadosCodigos();
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        folhas[codigo[i]] += salarios[i];
+    }
+    return folhas;
+}
+
+int TabelaFuncionarios::buscarLinhaPorId(long id) const {
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        if (ids[i] == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void TabelaFuncionarios::reservar(int linhas, int caracteresPorNome) {
+    ids.reserve(linhas);
+    nomes.reservar(linhas, caracteresPorNome);
+    cargos.reservar(linhas);
+    departamentos.reservar(linhas);
+    salarios.reserve(linhas);
+}
+
+void TabelaFuncionarios::limpar() {
+    ids.clear();
+    nomes.limpar();
+    cargos.limpar();
+    departamentos.limpar();
+    salarios.clear();
+}
@@ -0,0 +1,164 @@
+#ifndef TABELA_FUNCIONARIOS_H
+#define TABELA_FUNCIONARIOS_H
+
+#include "Colunas.h"
+#include "../elementos/Funcionario.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Funcionários armazenados por colunas (structure of arrays)
+ *
+ * Mesma organização de TabelaProdutos: IDs e salários em vetores
+ * contíguos, o nome em uma ColunaTexto e cargo e departamento
+ * codificados por dicionário. Folha de pagamento, reajustes e
+ * agrupamentos por departamento leem só as colunas de que precisam.
+ */
+class TabelaFuncionarios {
+private:
+    std::vector<long> ids;
+    ColunaTexto nomes;
+    ColunaCategorias cargos;
+    ColunaCategorias departamentos;
+    std::vector<double> salarios;
+
+public:
+    /**
+     * @brief Acrescenta uma linha com os campos de um funcionário
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(long id, std::string_view nome, const std::string& cargo,
+                   const std::string& departamento, double salario);
+
+    /**
+     * @brief Acrescenta uma linha com cargo e departamento já internados
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(long id, std::string_view nome, TextoInternado cargo,
+                   TextoInternado departamento, double salario);
+
+    /**
+     * @brief Acrescenta uma linha copiando os campos do funcionário
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(const Funcionario& funcionario);
+
+    /**
+     * @brief Copia para a tabela os funcionários de uma estrutura
+     * @param estrutura Qualquer estrutura com paraCada(funcao(Elemento&));
+     *                  elementos que não são Funcionario são ignorados
+     * @return Número de linhas acrescentadas
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Estrutura>
+    int importar(const Estrutura& estrutura) {
+        int importados = 0;
+        estrutura.paraCada([this, &importados](Elemento& elemento) {
+            if (const Funcionario* funcionario = dynamic_cast<const Funcionario*>(&elemento)) {
+                adicionar(*funcionario);
+                importados++;
+            }
+        });
+        return importados;
+    }
+
+    /**
+     * @brief Cria um Funcionario com os campos de uma linha
+     * @return Novo funcionário, ou nullptr se a linha não existe
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Funcionario> paraFuncionario(int linha) const;
+
+    /**
+     * @brief Insere no fim da lista um Funcionario por linha, na ordem da tabela
+     * @param lista Estrutura com inserirNoFim(std::unique_ptr<Elemento>)
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Lista>
+    void exportar(Lista& lista) const {
+        for (int linha = 0; linha < getTamanho(); linha++) {
+            lista.inserirNoFim(paraFuncionario(linha));
+        }
+    }
+
+    /**
+     * @brief Soma de todos os salários (folha de pagamento)
+     *
+     * Complexidade: O(n) - lê só a coluna de salários
+     */
+    double somaSalarios() const;
+
+    /**
+     * @brief Média dos salários (0 se a tabela está vazia)
+     *
+     * Complexidade: O(n)
+     */
+    double mediaSalarios() const;
+
+    /**
+     * @brief Número de funcionários com salário maior que o valor dado
+     *
+     * Complexidade: O(n) - lê só a coluna de salários
+     */
+    int contarSalarioAcimaDe(double valor) const;
+
+    /**
+     * @brief Aplica um reajuste percentual a todos os salários
+     * @param percentual Reajuste em porcentagem (10.0 = +10%)
+     *
+     * Complexidade: O(n) - só a coluna de salários é escrita
+     */
+    void aplicarReajuste(double percentual);
+
+    /**
+     * @brief Folha de pagamento de cada departamento
+     * @return Vetor indexado pelo código do departamento (ver getDepartamentos())
+     *
+     * Complexidade: O(n + d), d = número de departamentos
+     */
+    std::vector<double> folhaPorDepartamento() const;
+
+    /**
+     * @brief Linha de um ID (a primeira, se o ID se repete)
+     * @return Linha, ou -1 se o ID não está na tabela
+     *
+     * Complexidade: O(n) - varre só a coluna de IDs
+     */
+    int buscarLinhaPorId(long id) const;
+
+    // Campos de uma linha (linha deve estar em [0, getTamanho()))
+    long getId(int linha) const { return ids[linha]; }
+    std::string_view getNome(int linha) const { return nomes.obter(linha); }
+    const std::string& getCargo(int linha) const { return cargos.obter(linha); }
+    const std::string& getDepartamento(int linha) const { return departamentos.obter(linha); }
+    double getSalario(int linha) const { return salarios[linha]; }
+
+    void setSalario(int linha, double novoSalario) { salarios[linha] = novoSalario; }
+
+    // Colunas inteiras, para varreduras fora da classe
+    const long* dadosIds() const { return ids.data(); }
+    const double* dadosSalarios() const { return salarios.data(); }
+    const ColunaCategorias& getCargos() const { return cargos; }
+    const ColunaCategorias& getDepartamentos() const { return departamentos; }
+
+    int getTamanho() const { return static_cast<int>(ids.size()); }
+    bool estaVazia() const { return ids.empty(); }
+
+    /**
+     * @brief Reserva espaço para um número de linhas
+     * @param caracteresPorNome Estimativa do tamanho médio dos nomes
+     */
+    void reservar(int linhas, int caracteresPorNome = 16);
+
+    void limpar();
+};
+
+#endif
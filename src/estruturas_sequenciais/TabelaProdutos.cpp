@@ -0,0 +1,93 @@
+#include "TabelaProdutos.h"
+
+void TabelaProdutos::adicionar(long id, std::string_view nome, const std::string& categoria,
+                               const std::string& marca, double preco, int quantidadeEstoque) {
+    adicionar(id, nome, TextoInternado(categoria), TextoInternado(marca), preco, quantidadeEstoque);
+}
+
+void TabelaProdutos::adicionar(long id, std::string_view nome, TextoInternado categoria,
+                               TextoInternado marca, double preco, int quantidadeEstoque) {
+    ids.push_back(id);
+    nomes.adicionar(nome);
+    categorias.adicionar(categoria);
+    marcas.adicionar(marca);
+    precos.push_back(preco);
+    estoques.push_back(quantidadeEstoque);
+}
+
+void TabelaProdutos::adicionar(const Produto& produto) {
+    adicionar(produto.getID(), produto.getNome(), produto.getCategoriaInternada(), produto.getMarcaInternada(),
+              produto.getPreco(), produto.getQuantidadeEstoque());
+}
+
+std::unique_ptr<Produto> TabelaProdutos::paraProduto(int linha) const {
+    if (linha < 0 || linha >= getTamanho()) {
+        return nullptr;
+    }
+    return std::make_unique<Produto>(ids[linha], std::string(nomes.obter(linha)), categorias.obter(linha),
+                                     marcas.obter(linha), precos[linha], estoques[linha]);
+}
+
+double TabelaProdutos::calcularValorTotalEstoque(KernelsEstoque::ModoSoma modo,
+                                                 KernelsEstoque::Implementacao implementacao) const {
+    return KernelsEstoque::valorTotal(precos.data(), estoques.data(), getTamanho(), modo, implementacao);
+}
+
+int TabelaProdutos::contarDisponiveis(KernelsEstoque::Implementacao implementacao) const {
+    return KernelsEstoque::contarPositivos(estoques.data(), getTamanho(), implementacao);
+}
+
+std::vector<int> TabelaProdutos::filtrarEstoqueBaixo(int limite, KernelsEstoque::Implementacao implementacao) const {
+    std::vector<int> linhas;
+    KernelsEstoque::filtrarAbaixoDe(estoques.data(), getTamanho(), limite, linhas, implementacao);
+    return linhas;
+}
+
+std::vector<double> TabelaProdutos::valorEstoquePorCategoria() const {
+    std::vector<double> valores(categorias.getNumeroValores(), 0.0);
+    const std::uint32_t* codigo = categorias.dadosCodigos();
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        valores[codigo[i]] += precos[i] * estoques[i];
+    }
+    return valores;
+}
+
+int TabelaProdutos::buscarLinhaPorId(long id) const {
+    for (int i = 0, n = getTamanho(); i < n; i++) {
+        if (ids[i] == id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void TabelaProdutos::setPreco(int linha, double novoPreco) {
+    // Mesma regra de Produto::setPreco
+    if (novoPreco >= 0) {
+        precos[linha] = novoPreco;
+    }
+}
+
+void TabelaProdutos::setQuantidadeEstoque(int linha, int novaQuantidade) {
+    if (novaQuantidade >= 0) {
+        estoques[linha] = novaQuantidade;
+    }
+}
+
+void TabelaProdutos::reservar(int linhas, int caracteresPorNome) {
+    ids.reserve(linhas);
+    nomes.reservar(linhas, caracteresPorNome);
+    categorias.reservar(linhas);
+    marcas.reservar(linhas);
+    precos.reserve(linhas);
+    estoques.reserve(linhas);
+}
+
+void TabelaProdutos::limpar() {
+    ids.clear();
+    nomes.limpar();
+    categorias.limpar();
+    marcas.limpar();
+    precos.clear();
+    estoques.clear();
+}
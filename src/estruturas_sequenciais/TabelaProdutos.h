@@ -0,0 +1,175 @@
+#ifndef TABELA_PRODUTOS_H
+#define TABELA_PRODUTOS_H
+
+#include "Colunas.h"
+#include "KernelsEstoque.h"
+#include "../elementos/Produto.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Produtos armazenados por colunas (structure of arrays)
+ *
+ * Cada campo de Produto fica em um array contíguo próprio: IDs, preços e
+ * estoques em vetores numéricos, o nome em uma ColunaTexto e categoria e
+ * marca em colunas codificadas por dicionário. Uma linha da tabela é um
+ * produto.
+ *
+ * Nas estruturas de Elemento, somar o valor do estoque visita um objeto
+ * por vez (ponteiro, vtable, strings e campos numéricos espalhados no
+ * heap). Aqui a mesma soma lê só os arrays de preço e estoque, em ordem,
+ * com os laços vetorizados de KernelsEstoque (AVX2). A tabela não
+ * substitui as estruturas de Elemento: serve para consultas que varrem
+ * muitos registros. Ela é preenchida a partir delas (importar) e pode
+ * devolver cada linha como um Produto (paraProduto).
+ */
+class TabelaProdutos {
+private:
+    std::vector<long> ids;
+    ColunaTexto nomes;
+    ColunaCategorias categorias;
+    ColunaCategorias marcas;
+    std::vector<double> precos;
+    std::vector<int> estoques;
+
+public:
+    /**
+     * @brief Acrescenta uma linha com os campos de um produto
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(long id, std::string_view nome, const std::string& categoria,
+                   const std::string& marca, double preco, int quantidadeEstoque);
+
+    /**
+     * @brief Acrescenta uma linha com categoria e marca já internadas
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(long id, std::string_view nome, TextoInternado categoria,
+                   TextoInternado marca, double preco, int quantidadeEstoque);
+
+    /**
+     * @brief Acrescenta uma linha copiando os campos do produto
+     *
+     * Complexidade: O(1) amortizado
+     */
+    void adicionar(const Produto& produto);
+
+    /**
+     * @brief Copia para a tabela os produtos de uma estrutura
+     * @param estrutura Qualquer estrutura com paraCada(funcao(Elemento&)),
+     *                  como as listas encadeadas; elementos que não são
+     *                  Produto são ignorados
+     * @return Número de linhas acrescentadas
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Estrutura>
+    int importar(const Estrutura& estrutura) {
+        int importados = 0;
+        estrutura.paraCada([this, &importados](Elemento& elemento) {
+            if (const Produto* produto = dynamic_cast<const Produto*>(&elemento)) {
+                adicionar(*produto);
+                importados++;
+            }
+        });
+        return importados;
+    }
+
+    /**
+     * @brief Cria um Produto com os campos de uma linha
+     * @return Novo produto, ou nullptr se a linha não existe
+     *
+     * Complexidade: O(1)
+     */
+    std::unique_ptr<Produto> paraProduto(int linha) const;
+
+    /**
+     * @brief Insere no fim da lista um Produto por linha, na ordem da tabela
+     * @param lista Estrutura com inserirNoFim(std::unique_ptr<Elemento>)
+     *
+     * Complexidade: O(n)
+     */
+    template<typename Lista>
+    void exportar(Lista& lista) const {
+        for (int linha = 0; linha < getTamanho(); linha++) {
+            lista.inserirNoFim(paraProduto(linha));
+        }
+    }
+
+    /**
+     * @brief Valor total do estoque (soma de preço * quantidade de todas as linhas)
+     * @param modo Soma direta ou compensada (Kahan), ver KernelsEstoque::ModoSoma
+     *
+     * Complexidade: O(n) - lê só as colunas de preço e estoque, com AVX2 se disponível
+     */
+    double calcularValorTotalEstoque(KernelsEstoque::ModoSoma modo = KernelsEstoque::ModoSoma::Simples,
+                                     KernelsEstoque::Implementacao implementacao = KernelsEstoque::Implementacao::Automatica) const;
+
+    /**
+     * @brief Número de produtos com estoque maior que zero
+     *
+     * Complexidade: O(n) - lê só a coluna de estoque, com AVX2 se disponível
+     */
+    int contarDisponiveis(KernelsEstoque::Implementacao implementacao = KernelsEstoque::Implementacao::Automatica) const;
+
+    /**
+     * @brief Linhas dos produtos com estoque abaixo de um limite
+     * @param limite Produtos com quantidade < limite entram no resultado
+     * @return Linhas em ordem crescente
+     *
+     * Complexidade: O(n) - lê só a coluna de estoque, com AVX2 se disponível
+     */
+    std::vector<int> filtrarEstoqueBaixo(int limite,
+                                         KernelsEstoque::Implementacao implementacao = KernelsEstoque::Implementacao::Automatica) const;
+
+    /**
+     * @brief Valor do estoque por categoria
+     * @return Vetor indexado pelo código da categoria (ver getCategorias())
+     *
+     * Complexidade: O(n + c), c = número de categorias; nenhuma string é comparada
+     */
+    std::vector<double> valorEstoquePorCategoria() const;
+
+    /**
+     * @brief Linha de um ID (a primeira, se o ID se repete)
+     * @return Linha, ou -1 se o ID não está na tabela
+     *
+     * Complexidade: O(n) - varre só a coluna de IDs
+     */
+    int buscarLinhaPorId(long id) const;
+
+    // Campos de uma linha (linha deve estar em [0, getTamanho()))
+    long getId(int linha) const { return ids[linha]; }
+    std::string_view getNome(int linha) const { return nomes.obter(linha); }
+    const std::string& getCategoria(int linha) const { return categorias.obter(linha); }
+    const std::string& getMarca(int linha) const { return marcas.obter(linha); }
+    double getPreco(int linha) const { return precos[linha]; }
+    int getQuantidadeEstoque(int linha) const { return estoques[linha]; }
+
+    void setPreco(int linha, double novoPreco);
+    void setQuantidadeEstoque(int linha, int novaQuantidade);
+
+    // Colunas inteiras, para varreduras fora da classe
+    const long* dadosIds() const { return ids.data(); }
+    const double* dadosPrecos() const { return precos.data(); }
+    const int* dadosEstoques() const { return estoques.data(); }
+    const ColunaCategorias& getCategorias() const { return categorias; }
+    const ColunaCategorias& getMarcas() const { return marcas; }
+
+    int getTamanho() const { return static_cast<int>(ids.size()); }
+    bool estaVazia() const { return ids.empty(); }
+
+    /**
+     * @brief Reserva espaço para um número de linhas
+     * @param caracteresPorNome Estimativa do tamanho médio dos nomes
+     */
+    void reservar(int linhas, int caracteresPorNome = 16);
+
+    void limpar();
+};
+
+#endif
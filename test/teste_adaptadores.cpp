@@ -1,12 +1,20 @@
 #include "../src/estruturas_encadeadas/PilhaEncadeada.h"
 #include "../src/estruturas_encadeadas/FilaEncadeada.h"
 #include "../src/estruturas_encadeadas/Deque.h"
+#include "../src/estruturas_encadeadas/CacheLRU.h"
+#include "../src/estruturas_encadeadas/CacheSLRU.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_sequenciais/DequeBlocos.h"
 #include "../src/elementos/Aluno.h"
 #include "../src/elementos/Funcionario.h"
 #include "../src/elementos/Produto.h"
 #include "../ConfigLocale.h"
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 void testarPilhaEncadeada() {
     std::cout << "\n" << std::string(60, '=') << std::endl;
@@ -99,6 +107,23 @@ void testarFilaEncadeada() {
         }
     }
     
+    std::cout << "\n5. 📦 Testando enfileiramento e desenfileiramento em lote:" << std::endl;
+    std::unique_ptr<Elemento> lote[4];
+    lote[0] = std::make_unique<Aluno>(10, "Lucas Ferreira", "Física", 8.0);
+    lote[1] = nullptr;  // Nulos são ignorados
+    lote[2] = std::make_unique<Produto>(11, "Teclado", "Periféricos", "Microsoft", 100.0, 5);
+    lote[3] = std::make_unique<Funcionario>(12, "Paula Souza", "Analista", "RH", 4800.0);
+    std::cout << "Enfileirados em lote: " << fila.enfileirarLote(lote, 4) << std::endl;
+    
+    std::unique_ptr<Elemento> saida[4];
+    int removidos = fila.desenfileirarLote(saida, 4);
+    std::cout << "Desenfileirados em lote: " << removidos << " -> IDs:";
+    for (int i = 0; i < removidos; i++) {
+        std::cout << " " << saida[i]->getID();
+    }
+    std::cout << std::endl;
+    std::cout << "Fila vazia após o lote? " << (fila.estaVazia() ? "Sim" : "Não") << std::endl;
+    
     std::cout << "\n✅ Teste da Fila Encadeada concluído!" << std::endl;
 }
 
@@ -173,6 +198,205 @@ void testarDeque() {
     std::cout << "\n✅ Teste do Deque concluído!" << std::endl;
 }
 
+void testarDequeBlocos() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "🧱 TESTANDO DEQUE EM BLOCOS (backend alternativo)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    DequeBlocos deque;
+    
+    std::cout << "\n1. 📦 Testando deque vazio:" << std::endl;
+    std::cout << "Deque vazio? " << (deque.estaVazio() ? "Sim" : "Não") << std::endl;
+    std::cout << "Remover do início/fim: " << (!deque.removerInicio() && !deque.removerFim() ? "nullptr" : "elemento") << std::endl;
+    
+    std::cout << "\n2. ⬌ Inserindo elementos em ambas as pontas:" << std::endl;
+    deque.inserirInicio(std::make_unique<Aluno>(1, "Pedro Santos", "Física", 9.2));
+    deque.inserirFim(std::make_unique<Funcionario>(2, "Sofia Rodrigues", "Analista", "TI", 5500.0));
+    deque.inserirInicio(std::make_unique<Produto>(3, "Teclado", "Periféricos", "Microsoft", 200.0, 30));
+    deque.inserirFim(std::make_unique<Aluno>(4, "Mariana Silva", "Química", 8.8));
+    deque.imprimirDeque();
+    std::cout << "Início: ID=" << deque.inicio()->getID() << " | Fim: ID=" << deque.fim()->getID() << std::endl;
+    
+    std::cout << "\n3. 🧱 Atravessando várias fronteiras de bloco nas duas pontas:" << std::endl;
+    deque.limpar();
+    // IDs -999..-1 pelo início e 0..999 pelo fim: a ordem final é crescente
+    for (int i = 0; i < 1000; i++) {
+        deque.inserirFim(std::make_unique<Produto>(i, "Item", "Bloco", "Marca", 1.0, 1));
+        deque.inserirInicio(std::make_unique<Produto>(-i - 1, "Item", "Bloco", "Marca", 1.0, 1));
+    }
+    std::cout << "Tamanho: " << deque.getTamanho() << " | Blocos: " << deque.getBlocosAlocados()
+              << " (um nó por elemento no Deque encadeado: " << deque.getTamanho() << ")" << std::endl;
+    
+    bool indicesCorretos = true;
+    for (int i = 0; i < deque.getTamanho(); i++) {
+        indicesCorretos = indicesCorretos && deque.obterPorIndice(i)->getID() == i - 1000;
+    }
+    long anterior = -1001;
+    bool percursoCrescente = true;
+    deque.paraCada([&](Elemento& elemento) {
+        percursoCrescente = percursoCrescente && elemento.getID() == anterior + 1;
+        anterior = elemento.getID();
+    });
+    std::cout << "Acesso por índice correto? " << (indicesCorretos ? "Sim" : "Não") << std::endl;
+    std::cout << "Percurso com paraCada em ordem? " << (percursoCrescente && anterior == 999 ? "Sim" : "Não") << std::endl;
+    std::cout << "Índice inválido: " << (deque.obterPorIndice(2000) ? "elemento" : "nullptr") << std::endl;
+    
+    std::cout << "\n4. ↔️ Esvaziando alternando as pontas:" << std::endl;
+    bool pontasCorretas = true;
+    for (int i = 0; i < 1000; i++) {
+        auto primeiro = deque.removerInicio();
+        auto ultimo = deque.removerFim();
+        pontasCorretas = pontasCorretas && primeiro->getID() == i - 1000 && ultimo->getID() == 999 - i;
+    }
+    std::cout << "Pontas corretas? " << (pontasCorretas ? "Sim" : "Não") << std::endl;
+    std::cout << "Vazio ao final? " << (deque.estaVazio() ? "Sim" : "Não")
+              << " | Blocos em uso: " << deque.getBlocosAlocados() << std::endl;
+    
+    std::cout << "\n✅ Teste do Deque em blocos concluído!" << std::endl;
+}
+
+void testarCacheLRU() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "🗃️ TESTANDO ADAPTADOR: CACHE LRU (e SLRU)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    CacheLRU cache(3);
+    std::vector<long> despejados;
+    cache.definirCallbackRemocao([&despejados](std::unique_ptr<Elemento> elemento) {
+        despejados.push_back(elemento->getID());
+    });
+    
+    std::cout << "\n1. 📥 Inserindo 1, 2, 3 e consultando 1 (vira o mais recente):" << std::endl;
+    cache.inserir(std::make_unique<Aluno>(1, "João Silva", "Computação", 8.5));
+    cache.inserir(std::make_unique<Funcionario>(2, "Maria Santos", "Desenvolvedora", "TI", 6000.0));
+    cache.inserir(std::make_unique<Produto>(3, "Notebook", "Eletrônicos", "Dell", 2500.0, 10));
+    Elemento* consultado = cache.obter(1);
+    std::cout << "obter(1): " << (consultado ? "ID " + std::to_string(consultado->getID()) : "falha")
+              << " | obter(9): " << (cache.obter(9) ? "acerto" : "falha") << std::endl;
+    std::cout << "Menos recente: ID " << cache.getMenosRecente()->getID() << std::endl;
+    
+    std::cout << "\n2. 🧹 Inserindo 4 com o cache cheio:" << std::endl;
+    cache.inserir(std::make_unique<Aluno>(4, "Ana Costa", "Engenharia", 9.0));
+    std::cout << "Despejado pelo callback: ID " << (despejados.empty() ? -1 : despejados.back())
+              << " | Contém 2? " << (cache.contem(2) ? "Sim" : "Não")
+              << " | Tamanho: " << cache.getTamanho() << "/" << cache.getCapacidade() << std::endl;
+    
+    std::cout << "\n3. ✏️ Reinserindo o ID 3 (substitui sem despejar):" << std::endl;
+    cache.inserir(std::make_unique<Produto>(3, "Notebook Gamer", "Eletrônicos", "Dell", 4000.0, 2));
+    std::cout << "Despejos: " << cache.getDespejos() << " | Nome do ID 3: "
+              << dynamic_cast<Produto*>(cache.obter(3))->getNome()
+              << " | Menos recente: ID " << cache.getMenosRecente()->getID() << std::endl;
+    auto invalidado = cache.remover(1);
+    std::cout << "remover(1): " << (invalidado ? "retirado" : "ausente")
+              << " (sem callback: " << despejados.size() << " despejo registrado)" << std::endl;
+    std::cout << "Acertos: " << cache.getAcertos() << " | Falhas: " << cache.getFalhas()
+              << " | Taxa: " << cache.getTaxaAcertos() << std::endl;
+    
+    std::cout << "\n4. 🎲 Operações aleatórias comparadas com um LRU de referência:" << std::endl;
+    CacheLRU aleatorio(50);
+    std::vector<long> referencia;  // Do mais ao menos recente
+    std::mt19937 gerador(40);
+    long acertosEsperados = 0;
+    bool consistente = true;
+    for (int operacao = 0; operacao < 20000 && consistente; operacao++) {
+        long id = static_cast<long>(gerador() % 120);
+        auto posicao = std::find(referencia.begin(), referencia.end(), id);
+        bool presente = posicao != referencia.end();
+        if (gerador() % 2 == 0) {
+            Elemento* elemento = aleatorio.obter(id);
+            consistente = (elemento != nullptr) == presente && (!elemento || elemento->getID() == id);
+            if (presente) {
+                acertosEsperados++;
+                std::rotate(referencia.begin(), posicao, posicao + 1);
+            }
+        } else {
+            aleatorio.inserir(std::make_unique<Produto>(id, "Item", "Cache", "Marca", 1.0, 1));
+            if (presente) {
+                std::rotate(referencia.begin(), posicao, posicao + 1);
+            } else {
+                if (referencia.size() == 50) {
+                    referencia.pop_back();
+                }
+                referencia.insert(referencia.begin(), id);
+            }
+        }
+        consistente = consistente && aleatorio.getTamanho() == static_cast<int>(referencia.size())
+                      && aleatorio.getMenosRecente()->getID() == referencia.back();
+    }
+    std::cout << "Ordem e conteúdo conferem? " << (consistente ? "Sim" : "Não")
+              << " | Acertos conferem? " << (aleatorio.getAcertos() == acertosEsperados ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n5. 🛡️ SLRU: uma varredura não expulsa os elementos populares:" << std::endl;
+    CacheLRU lru(10);
+    CacheSLRU slru(10);
+    for (int rodada = 0; rodada < 2; rodada++) {
+        for (long id = 0; id < 5; id++) {
+            if (!lru.obter(id)) {
+                lru.inserir(std::make_unique<Produto>(id, "Popular", "Cache", "Marca", 1.0, 1));
+            }
+            if (!slru.obter(id)) {
+                slru.inserir(std::make_unique<Produto>(id, "Popular", "Cache", "Marca", 1.0, 1));
+            }
+        }
+    }
+    for (long id = 100; id < 120; id++) {
+        lru.inserir(std::make_unique<Produto>(id, "Varredura", "Cache", "Marca", 1.0, 1));
+        slru.inserir(std::make_unique<Produto>(id, "Varredura", "Cache", "Marca", 1.0, 1));
+    }
+    int popularesLru = 0;
+    int popularesSlru = 0;
+    for (long id = 0; id < 5; id++) {
+        popularesLru += lru.contem(id) ? 1 : 0;
+        popularesSlru += slru.contem(id) ? 1 : 0;
+    }
+    std::cout << "Populares que sobreviveram - LRU: " << popularesLru << "/5 | SLRU: " << popularesSlru
+              << "/5 | Protegido: " << slru.getTamanhoProtegido() << " | Tamanho SLRU: " << slru.getTamanho() << std::endl;
+    
+    std::cout << "\n6. 🔁 moverParaInicio da lista, sem índice, com o posicional e com os dois:" << std::endl;
+    bool moverConfere = true;
+    for (int indices = 0; indices < 3 && moverConfere; indices++) {
+        ListaDuplamenteEncadeada lista;
+        std::vector<long> ordem;
+        for (long id = 0; id < 200; id++) {
+            lista.inserirNoFim(std::make_unique<Aluno>(id, "Aluno", "Curso", 7.0));
+            ordem.push_back(id);
+        }
+        if (indices >= 1) {
+            lista.ativarIndicePosicional();
+        }
+        if (indices == 2) {
+            lista.ativarIndiceIds();
+        }
+        for (int operacao = 0; operacao < 5000 && moverConfere; operacao++) {
+            long id = static_cast<long>(gerador() % 220);  // Alguns IDs não existem
+            auto posicao = std::find(ordem.begin(), ordem.end(), id);
+            bool presente = posicao != ordem.end();
+            moverConfere = lista.moverParaInicio(id) == presente;
+            if (presente) {
+                std::rotate(ordem.begin(), posicao, posicao + 1);
+            }
+            // Posição sorteada: confere o índice posicional depois de cada religação
+            std::size_t conferida = gerador() % ordem.size();
+            moverConfere = moverConfere && lista.obterElementoPorPosicao(static_cast<int>(conferida))->getID() == ordem[conferida];
+        }
+        for (std::size_t i = 0; i < ordem.size() && moverConfere; i++) {
+            moverConfere = lista.obterElementoPorPosicao(static_cast<int>(i))->getID() == ordem[i] &&
+                           lista.buscarPeloId(ordem[i]) != nullptr;
+        }
+    }
+    std::cout << "Ordem confere com a referência? " << (moverConfere ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n7. 🚫 Capacidade inválida:" << std::endl;
+    try {
+        CacheLRU invalido(0);
+        std::cout << "Exceção lançada? Não" << std::endl;
+    } catch (const std::invalid_argument&) {
+        std::cout << "Exceção lançada? Sim" << std::endl;
+    }
+    
+    std::cout << "\n✅ Teste do cache LRU concluído!" << std::endl;
+}
+
 void demonstrarComplexidades() {
     std::cout << "\n" << std::string(70, '=') << std::endl;
     std::cout << "📊 ANÁLISE DE COMPLEXIDADES DOS ADAPTADORES" << std::endl;
@@ -202,6 +426,11 @@ void demonstrarComplexidades() {
     std::cout << "├─ estaVazio()    : O(1) - verificação de tamanho" << std::endl;
     std::cout << "└─ getTamanho()   : O(1) - acesso direto" << std::endl;
     
+    std::cout << "\n🗃️ CACHE LRU (usando ListaDuplamenteEncadeada + índice de IDs):" << std::endl;
+    std::cout << "├─ obter()        : O(1) médio - índice + moverParaInicio" << std::endl;
+    std::cout << "├─ inserir()      : O(1) médio - inserção no início" << std::endl;
+    std::cout << "└─ despejo        : O(1) - remoção do fim (o menos recente)" << std::endl;
+    
     std::cout << "\n🎯 JUSTIFICATIVAS DAS ESCOLHAS:" << std::endl;
     std::cout << "📚 Pilha: ListaSimplesmenteEncadeada é suficiente (só acessa uma ponta)" << std::endl;
     std::cout << "🚶 Fila: ListaSimplesmenteEncadeada com ponteiro cauda otimiza inserção" << std::endl;
@@ -220,6 +449,8 @@ int main() {
         testarPilhaEncadeada();
         testarFilaEncadeada();
         testarDeque();
+        testarDequeBlocos();
+        testarCacheLRU();
         demonstrarComplexidades();
         
         std::cout << "\n" << std::string(70, '=') << std::endl;
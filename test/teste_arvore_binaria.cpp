@@ -122,6 +122,16 @@ void testarArvoreBinariaBusca() {
     }
     std::cout << "Tamanho após remoção: " << arvore.getTamanho() << std::endl;
     
+    // A raiz passou a guardar o sucessor (ID=60): o ID copiado no nó tem que acompanhar
+    std::cout << "\n6.4. Buscando todos os IDs após as remoções: ";
+    bool buscasCorretas = true;
+    for (long id : {20L, 30L, 40L, 50L, 60L, 70L, 80L}) {
+        bool removidoAntes = id == 20 || id == 50 || id == 70;
+        Elemento* encontrado = arvore.buscarPeloId(id);
+        buscasCorretas = buscasCorretas && (removidoAntes ? encontrado == nullptr : encontrado && encontrado->getID() == id);
+    }
+    std::cout << (buscasCorretas ? "OK" : "FALHA") << std::endl;
+    
     std::cout << "\n7. 🌳 Estado final da árvore:" << std::endl;
     std::cout << "Altura: " << arvore.calcularAltura() << " | Tamanho: " << arvore.getTamanho() << std::endl;
     arvore.emOrdem();
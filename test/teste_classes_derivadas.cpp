@@ -1,6 +1,8 @@
 #include "../src/elementos/Elemento.h"
 #include "../src/elementos/Aluno.h"
 #include "../src/elementos/Funcionario.h"
+#include "../src/elementos/Produto.h"
+#include "../src/elementos/TextoInternado.h"
 #include "../ConfigLocale.h"
 #include <iostream>
 #include <vector>
@@ -144,6 +146,51 @@ void demonstrarEncapsulamento() {
     std::cout << "Encapsulamento funcionando corretamente!" << std::endl;
 }
 
+void demonstrarTextosInternados() {
+    std::cout << "\n============== TESTE DE TEXTOS INTERNADOS ===============" << std::endl;
+    
+    auto conferir = [](const std::string& descricao, bool condicao) {
+        std::cout << "  " << descricao << ": " << (condicao ? "OK" : "FALHA") << std::endl;
+    };
+    
+    std::cout << "\n1. Mesmo texto, mesma entrada do pool:" << std::endl;
+    std::string montado = std::string("Ciência da ") + "Computação";
+    TextoInternado primeiro("Ciência da Computação");
+    TextoInternado segundo(montado);
+    TextoInternado outro("Engenharia Elétrica");
+    conferir("Textos iguais dão referências iguais", primeiro == segundo);
+    conferir("Textos diferentes dão referências diferentes", primeiro != outro);
+    conferir("Mesmo hash para textos iguais", primeiro.hash() == segundo.hash());
+    conferir("Ordem segue o texto", primeiro < outro && !(outro < primeiro));
+    conferir("Padrão é o texto vazio", TextoInternado() == TextoInternado("") && TextoInternado().getTexto().empty());
+    
+    std::cout << "\n2. Campos internados nas classes:" << std::endl;
+    std::size_t quantidadeAntes = TextoInternado::getQuantidadeInternados();
+    Aluno aluno1(20231101, "Aluno 1", "Ciência da Computação", 8.0);
+    Aluno aluno2(20231102, "Aluno 2", montado, 6.0);
+    conferir("Curso devolve o texto original", aluno1.getCurso() == "Ciência da Computação");
+    conferir("Alunos do mesmo curso compartilham a entrada",
+             aluno1.getCursoInternado() == aluno2.getCursoInternado() && aluno1.getCursoInternado() == primeiro);
+    conferir("Curso repetido não cresce o pool", TextoInternado::getQuantidadeInternados() == quantidadeAntes);
+    
+    Funcionario funcionario(20231103, "Funcionário", "Analista", "Tecnologia", 5000.0);
+    conferir("Cargo e departamento", funcionario.getCargo() == "Analista" && funcionario.getDepartamento() == "Tecnologia");
+    funcionario.setCargo("Coordenador");
+    conferir("setCargo interna o novo cargo",
+             funcionario.getCargo() == "Coordenador" && funcionario.getCargoInternado() == TextoInternado("Coordenador"));
+    
+    Produto produto(20231104, "Notebook", "Eletrônicos", "Marca X", 3500.0, 5);
+    Produto copia(produto);
+    conferir("Categoria e marca", produto.getCategoria() == "Eletrônicos" && produto.getMarca() == "Marca X");
+    conferir("Cópia compartilha as entradas", copia.getCategoriaInternada() == produto.getCategoriaInternada() &&
+                                              copia.getMarcaInternada() == produto.getMarcaInternada());
+    
+    std::cout << "\n3. Getters devolvem referências, sem cópia:" << std::endl;
+    conferir("getNome aponta para o nome guardado", &aluno1.getNome() == &aluno1.getNome());
+    conferir("Mesmo curso, mesma string do pool", &aluno1.getCurso() == &aluno2.getCurso());
+    conferir("Categoria da cópia é a mesma string", &copia.getCategoria() == &produto.getCategoria());
+}
+
 int main() {
     // Configura locale para português
     CONFIGURAR_PORTUGUES();
@@ -157,6 +204,7 @@ int main() {
     demonstrarFuncionario();
     demonstrarPolimorfismo();
     demonstrarEncapsulamento();
+    demonstrarTextosInternados();
     
     std::cout << "\n=================== RESUMO DOS TESTES ===================" << std::endl;
     std::cout << "Classe Aluno: Todos os métodos funcionando corretamente" << std::endl;
@@ -165,6 +213,7 @@ int main() {
     std::cout << "Encapsulamento: Acesso controlado aos atributos" << std::endl;
     std::cout << "Herança: Reutilização do código da classe base" << std::endl;
     std::cout << "Operadores: Comparação baseada no ID funcionando" << std::endl;
+    std::cout << "Textos internados: Curso, cargo, departamento, categoria e marca compartilhados" << std::endl;
     
     std::cout << "\nTODOS OS TESTES PASSARAM COM SUCESSO! " << std::endl;
     
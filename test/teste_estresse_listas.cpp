@@ -0,0 +1,131 @@
+#include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
+#include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/elementos/Elemento.h"
+#include "../ConfigLocale.h"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+// Contador de verificações que falharam (define o código de saída)
+int falhas = 0;
+
+void verificar(bool condicao, const std::string& descricao) {
+    std::cout << (condicao ? "  ✅ " : "  ❌ ") << descricao << std::endl;
+    if (!condicao) {
+        falhas++;
+    }
+}
+
+/**
+ * @brief Elemento mínimo que conta as próprias destruições
+ *
+ * Mantém o teste de dezenas de milhões de elementos dentro da memória
+ * disponível e permite conferir que nenhum elemento vazou.
+ */
+class Marcador : public Elemento {
+public:
+    static long destruidos;
+
+    explicit Marcador(long id) : Elemento(id) {}
+    ~Marcador() override { destruidos++; }
+
+    void imprimirInfo() const override {
+        std::cout << "Marcador " << getID() << std::endl;
+    }
+};
+
+long Marcador::destruidos = 0;
+
+template<typename Lista>
+void preencher(Lista& lista, long quantidade) {
+    for (long i = 0; i < quantidade; i++) {
+        lista.inserirNoFim(std::make_unique<Marcador>(i));
+    }
+}
+
+void testarDestrutorListaSimples(long quantidade) {
+    std::cout << "\n1. Destrutor da lista simples (" << quantidade << " elementos, new/delete):" << std::endl;
+    Marcador::destruidos = 0;
+    {
+        ListaSimplesmenteEncadeada lista;
+        preencher(lista, quantidade);
+        verificar(lista.getTamanho() == quantidade, "Lista preenchida");
+    }
+    verificar(Marcador::destruidos == quantidade, "Destrutor liberou todos os elementos sem estourar a pilha");
+}
+
+void testarDestrutorListaDupla(long quantidade) {
+    std::cout << "\n2. Destrutor da lista dupla (" << quantidade << " elementos, new/delete):" << std::endl;
+    Marcador::destruidos = 0;
+    {
+        ListaDuplamenteEncadeada lista;
+        preencher(lista, quantidade);
+        verificar(lista.getTamanho() == quantidade, "Lista preenchida");
+    }
+    verificar(Marcador::destruidos == quantidade, "Destrutor liberou todos os elementos sem estourar a pilha");
+}
+
+void testarLimparComPool(long quantidade) {
+    std::cout << "\n3. limpar() com pool (" << quantidade << " elementos, descarte em bloco):" << std::endl;
+    Marcador::destruidos = 0;
+    ListaDuplamenteEncadeada lista(true);
+    preencher(lista, quantidade);
+    int slabs = lista.getPoolNos()->getSlabsAlocados();
+    std::cout << "  Slabs usados: " << slabs << std::endl;
+
+    lista.limpar();
+    verificar(Marcador::destruidos == quantidade, "Todos os elementos destruídos");
+    verificar(lista.estaVazia() && lista.getTamanho() == 0, "Lista vazia após limpar");
+    verificar(lista.getPoolNos()->getNosEmUso() == 0, "Nenhum nó em uso no pool");
+    verificar(lista.getPoolNos()->getSlabsAlocados() == 1, "Slabs devolvidos, exceto o mais recente");
+
+    preencher(lista, 3);
+    verificar(lista.getTamanho() == 3 && lista.getUltimo()->getID() == 2, "Lista reutilizável após limpar");
+}
+
+void testarCircularComPool() {
+    std::cout << "\n4. Lista circular com pool (limpar e destrutor):" << std::endl;
+    Marcador::destruidos = 0;
+    {
+        ListaDuplamenteEncadeadaCircular lista(true);
+        preencher(lista, 10000);
+        lista.limpar();
+        verificar(Marcador::destruidos == 10000 && lista.estaVazia(), "limpar() destruiu todos os elementos");
+        preencher(lista, 100);
+        verificar(lista.verificarIntegridade(), "Ciclo íntegro após reutilização");
+    }
+    verificar(Marcador::destruidos == 10100, "Destrutor liberou os elementos restantes");
+}
+
+int main(int argc, char* argv[]) {
+    CONFIGURAR_PORTUGUES();
+
+    long quantidade = argc > 1 ? std::atol(argv[1]) : 50000000;
+
+    std::cout << std::string(60, '=') << std::endl;
+    std::cout << "TESTE DE ESTRESSE: DESTRUIÇÃO DE LISTAS LONGAS" << std::endl;
+    std::cout << "Elementos por lista: " << quantidade << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    try {
+        testarDestrutorListaSimples(quantidade);
+        testarDestrutorListaDupla(quantidade);
+        testarLimparComPool(quantidade);
+        testarCircularComPool();
+    } catch (const std::exception& e) {
+        std::cerr << "Erro durante os testes: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    if (falhas == 0) {
+        std::cout << "TODOS OS TESTES EXECUTADOS COM SUCESSO!" << std::endl;
+    } else {
+        std::cout << falhas << " VERIFICAÇÃO(ÕES) FALHARAM!" << std::endl;
+    }
+    std::cout << std::string(60, '=') << std::endl;
+
+    return falhas == 0 ? 0 : 1;
+}
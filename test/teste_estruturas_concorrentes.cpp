@@ -0,0 +1,362 @@
+#include "../src/estruturas_concorrentes/FilaConcorrente.h"
+#include "../src/estruturas_concorrentes/PilhaConcorrente.h"
+#include "../src/estruturas_concorrentes/FilaEncadeadaConcorrente.h"
+#include "../src/estruturas_concorrentes/DequeRoubo.h"
+#include "../src/elementos/Aluno.h"
+#include "../src/elementos/Funcionario.h"
+#include "../src/elementos/Produto.h"
+#include "../ConfigLocale.h"
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Contador de verificações que falharam (define o código de saída)
+int falhas = 0;
+
+void verificar(bool condicao, const std::string& descricao) {
+    std::cout << (condicao ? "  ✅ " : "  ❌ ") << descricao << std::endl;
+    if (!condicao) {
+        falhas++;
+    }
+}
+
+void testarFilaConcorrente() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: FILA CONCORRENTE (MPMC LIMITADA)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::cout << "\n1. Capacidade arredondada para potência de 2:" << std::endl;
+    FilaConcorrente fila(3);
+    std::cout << "Capacidade solicitada: 3 | Capacidade real: " << fila.getCapacidade() << std::endl;
+    verificar(fila.getCapacidade() == 4, "Capacidade 3 vira 4");
+    verificar(fila.filaVazia(), "Fila nova está vazia");
+    verificar(fila.tryDesenfileirar() == nullptr, "tryDesenfileirar em fila vazia retorna nullptr");
+
+    std::cout << "\n2. Enchendo a fila com tryEnfileirar:" << std::endl;
+    std::unique_ptr<Elemento> aluno = std::make_unique<Aluno>(1, "João Silva", "Computação", 8.5);
+    std::unique_ptr<Elemento> funcionario = std::make_unique<Funcionario>(2, "Maria Santos", "Analista", "TI", 6000.0);
+    std::unique_ptr<Elemento> produto1 = std::make_unique<Produto>(3, "Monitor", "Eletrônicos", "LG", 800.0, 5);
+    std::unique_ptr<Elemento> produto2 = std::make_unique<Produto>(4, "Mouse", "Periféricos", "Logitech", 50.0, 100);
+    std::unique_ptr<Elemento> extra = std::make_unique<Produto>(5, "Teclado", "Periféricos", "Microsoft", 100.0, 50);
+
+    verificar(fila.tryEnfileirar(aluno) && !aluno, "Enfileira Aluno (ID=1) e transfere a posse");
+    verificar(fila.tryEnfileirar(funcionario), "Enfileira Funcionário (ID=2)");
+    verificar(fila.tryEnfileirar(produto1), "Enfileira Produto (ID=3)");
+    verificar(fila.tryEnfileirar(produto2), "Enfileira Produto (ID=4)");
+    verificar(fila.getTamanho() == 4, "Tamanho é 4");
+    verificar(!fila.tryEnfileirar(extra) && extra, "Fila cheia: tryEnfileirar falha e o elemento fica com o chamador");
+
+    std::cout << "\n3. Ordem FIFO e comportamento circular:" << std::endl;
+    auto primeiro = fila.tryDesenfileirar();
+    verificar(primeiro && primeiro->getID() == 1, "Primeiro a sair é o ID=1");
+    verificar(fila.tryEnfileirar(extra), "Enfileira ID=5 na posição liberada (volta do buffer)");
+    long esperado = 2;
+    bool ordemCorreta = true;
+    while (auto elemento = fila.tryDesenfileirar()) {
+        ordemCorreta = ordemCorreta && elemento->getID() == esperado;
+        esperado++;
+    }
+    verificar(ordemCorreta && esperado == 6, "Saem 2, 3, 4, 5 em ordem");
+
+    std::cout << "\n4. Múltiplos produtores e consumidores (operações bloqueantes):" << std::endl;
+    const int produtores = 4;
+    const int consumidores = 4;
+    const long porProdutor = 20000;
+    const long total = produtores * porProdutor;
+
+    FilaConcorrente compartilhada(64);
+    std::atomic<long> somaIds(0);
+    std::atomic<long> recebidos(0);
+    std::atomic<long> reservados(0);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < produtores; p++) {
+        threads.emplace_back([&, p] {
+            for (long i = 0; i < porProdutor; i++) {
+                long id = p * porProdutor + i + 1;
+                compartilhada.enfileirar(std::make_unique<Produto>(id, "Item", "Teste", "Marca", 1.0, 1));
+            }
+        });
+    }
+    for (int c = 0; c < consumidores; c++) {
+        threads.emplace_back([&] {
+            while (reservados.fetch_add(1) < total) {
+                auto elemento = compartilhada.desenfileirar();
+                somaIds += elemento->getID();
+                recebidos++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::cout << "Recebidos: " << recebidos.load() << " de " << total << std::endl;
+    verificar(recebidos.load() == total, "Todos os elementos foram consumidos");
+    verificar(somaIds.load() == total * (total + 1) / 2, "Cada ID foi consumido exatamente uma vez");
+    verificar(compartilhada.filaVazia(), "Fila termina vazia");
+}
+
+void testarPilhaConcorrente() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: PILHA CONCORRENTE (TREIBER)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::cout << "\n1. Operações básicas em uma thread:" << std::endl;
+    PilhaConcorrente pilha;
+    verificar(pilha.estaVazia() && pilha.topo() == nullptr, "Pilha nova está vazia e sem topo");
+    verificar(pilha.desempilhar() == nullptr, "desempilhar em pilha vazia retorna nullptr");
+    pilha.empilhar(nullptr);
+    verificar(pilha.estaVazia(), "Elemento nulo é ignorado");
+
+    pilha.empilhar(std::make_unique<Aluno>(1, "João Silva", "Computação", 8.5));
+    pilha.empilhar(std::make_unique<Funcionario>(2, "Maria Santos", "Analista", "TI", 6000.0));
+    pilha.empilhar(std::make_unique<Produto>(3, "Monitor", "Eletrônicos", "LG", 800.0, 5));
+    verificar(pilha.getTamanho() == 3, "Tamanho é 3");
+    verificar(pilha.topo() && pilha.topo()->getID() == 3, "Topo é o ID=3");
+
+    long esperado = 3;
+    bool ordemLifo = true;
+    while (auto elemento = pilha.desempilhar()) {
+        ordemLifo = ordemLifo && elemento->getID() == esperado;
+        esperado--;
+    }
+    verificar(ordemLifo && esperado == 0, "Saem 3, 2, 1 (ordem LIFO)");
+
+    std::cout << "\n2. Nós reutilizados e pool crescendo além do primeiro bloco:" << std::endl;
+    for (long i = 1; i <= 3000; i++) {
+        pilha.empilhar(std::make_unique<Produto>(i, "Item", "Teste", "Marca", 1.0, 1));
+    }
+    verificar(pilha.getTamanho() == 3000 && pilha.topo()->getID() == 3000, "3000 elementos empilhados, topo ID=3000");
+    pilha.limpar();
+    verificar(pilha.estaVazia(), "limpar() esvazia a pilha");
+
+    std::cout << "\n3. Várias threads empilhando e desempilhando (disputa pelo topo):" << std::endl;
+    const int threadsTotal = 8;
+    const long porThread = 20000;
+    PilhaConcorrente compartilhada;
+    std::atomic<long> somaIds(0);
+    std::atomic<long> recebidos(0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < threadsTotal; t++) {
+        threads.emplace_back([&, t] {
+            // Empilha em rajadas curtas e desempilha o que encontrar:
+            // os nós circulam rapidamente entre as threads (cenário ABA)
+            for (long i = 0; i < porThread; i += 4) {
+                for (long j = i; j < i + 4 && j < porThread; j++) {
+                    long id = t * porThread + j + 1;
+                    compartilhada.empilhar(std::make_unique<Produto>(id, "Item", "Teste", "Marca", 1.0, 1));
+                }
+                for (int j = 0; j < 3; j++) {
+                    if (auto elemento = compartilhada.desempilhar()) {
+                        somaIds += elemento->getID();
+                        recebidos++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    while (auto elemento = compartilhada.desempilhar()) {
+        somaIds += elemento->getID();
+        recebidos++;
+    }
+
+    const long total = threadsTotal * porThread;
+    std::cout << "Recebidos: " << recebidos.load() << " de " << total << std::endl;
+    verificar(recebidos.load() == total, "Todos os elementos foram desempilhados");
+    verificar(somaIds.load() == total * (total + 1) / 2, "Cada ID foi desempilhado exatamente uma vez");
+    verificar(compartilhada.estaVazia() && compartilhada.getTamanho() == 0, "Pilha termina vazia");
+}
+
+void testarFilaEncadeadaConcorrente() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: FILA ENCADEADA CONCORRENTE (MICHAEL-SCOTT)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::cout << "\n1. Operações básicas em uma thread:" << std::endl;
+    FilaEncadeadaConcorrente fila;
+    verificar(fila.estaVazia() && fila.desenfileirar() == nullptr, "Fila nova está vazia");
+    fila.enfileirar(nullptr);
+    verificar(fila.estaVazia(), "Elemento nulo é ignorado");
+
+    fila.enfileirar(std::make_unique<Aluno>(1, "João Silva", "Computação", 8.5));
+    fila.enfileirar(std::make_unique<Funcionario>(2, "Maria Santos", "Analista", "TI", 6000.0));
+    fila.enfileirar(std::make_unique<Produto>(3, "Monitor", "Eletrônicos", "LG", 800.0, 5));
+    verificar(fila.getTamanho() == 3, "Tamanho é 3");
+    long esperado = 1;
+    bool ordemFifo = true;
+    while (auto elemento = fila.desenfileirar()) {
+        ordemFifo = ordemFifo && elemento->getID() == esperado;
+        esperado++;
+    }
+    verificar(ordemFifo && esperado == 4, "Saem 1, 2, 3 (ordem FIFO)");
+
+    std::cout << "\n2. Muitos ciclos na mesma thread (nós aposentados e reciclados):" << std::endl;
+    bool ciclosCorretos = true;
+    for (long i = 1; i <= 10000; i++) {
+        fila.enfileirar(std::make_unique<Produto>(i, "Item", "Teste", "Marca", 1.0, 1));
+        auto elemento = fila.desenfileirar();
+        ciclosCorretos = ciclosCorretos && elemento && elemento->getID() == i;
+    }
+    verificar(ciclosCorretos && fila.estaVazia(), "10000 ciclos enfileirar/desenfileirar corretos");
+
+    std::cout << "\n3. Múltiplos produtores e consumidores:" << std::endl;
+    const int produtores = 4;
+    const int consumidores = 4;
+    const long porProdutor = 20000;
+    const long total = produtores * porProdutor;
+
+    FilaEncadeadaConcorrente compartilhada;
+    std::atomic<long> somaIds(0);
+    std::atomic<long> recebidos(0);
+    std::atomic<bool> ordemPorProdutor(true);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < produtores; p++) {
+        threads.emplace_back([&, p] {
+            for (long i = 0; i < porProdutor; i++) {
+                long id = p * porProdutor + i + 1;
+                compartilhada.enfileirar(std::make_unique<Produto>(id, "Item", "Teste", "Marca", 1.0, 1));
+            }
+        });
+    }
+    for (int c = 0; c < consumidores; c++) {
+        threads.emplace_back([&] {
+            // Cada consumidor deve ver os itens de um mesmo produtor em ordem crescente
+            std::vector<long> ultimoPorProdutor(produtores, 0);
+            while (recebidos.load() < total) {
+                auto elemento = compartilhada.desenfileirar();
+                if (!elemento) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                long id = elemento->getID();
+                int produtor = static_cast<int>((id - 1) / porProdutor);
+                if (id <= ultimoPorProdutor[produtor]) {
+                    ordemPorProdutor = false;
+                }
+                ultimoPorProdutor[produtor] = id;
+                somaIds += id;
+                recebidos++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::cout << "Recebidos: " << recebidos.load() << " de " << total << std::endl;
+    verificar(recebidos.load() == total, "Todos os elementos foram consumidos");
+    verificar(somaIds.load() == total * (total + 1) / 2, "Cada ID foi consumido exatamente uma vez");
+    verificar(ordemPorProdutor.load(), "Ordem FIFO preservada para cada produtor");
+    verificar(compartilhada.estaVazia(), "Fila termina vazia");
+}
+
+void testarDequeRoubo() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: DEQUE DE ROUBO DE TRABALHO (CHASE-LEV)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    std::cout << "\n1. Dona no fim (LIFO) e ladrão no início (FIFO):" << std::endl;
+    DequeRoubo deque(2);
+    verificar(deque.estaVazio() && deque.removerFim() == nullptr && deque.roubarInicio() == nullptr,
+              "Deque nova está vazia para a dona e para ladrões");
+    for (long i = 1; i <= 5; i++) {
+        deque.inserirFim(std::make_unique<Produto>(i, "Item", "Teste", "Marca", 1.0, 1));
+    }
+    verificar(deque.getTamanho() == 5 && deque.getCapacidade() == 8, "5 elementos; array cresceu de 2 para 8");
+    auto doFim = deque.removerFim();
+    auto doInicio = deque.roubarInicio();
+    verificar(doFim && doFim->getID() == 5, "removerFim retorna o mais recente (ID=5)");
+    verificar(doInicio && doInicio->getID() == 1, "roubarInicio retorna o mais antigo (ID=1)");
+    long esperado = 4;
+    bool ordemDona = true;
+    while (auto elemento = deque.removerFim()) {
+        ordemDona = ordemDona && elemento->getID() == esperado;
+        esperado--;
+    }
+    verificar(ordemDona && esperado == 1 && deque.estaVazio(), "Restantes saem 4, 3, 2 pelo fim");
+
+    std::cout << "\n2. Dona empilhando e desempilhando com ladrões concorrentes:" << std::endl;
+    const long total = 100000;
+    const int ladroes = 3;
+    DequeRoubo compartilhada;
+    std::atomic<long> somaIds(0);
+    std::atomic<long> recebidos(0);
+    std::vector<std::thread> threads;
+
+    threads.emplace_back([&] {
+        long somaLocal = 0;
+        long recebidosLocal = 0;
+        for (long i = 1; i <= total; i++) {
+            compartilhada.inserirFim(std::make_unique<Produto>(i, "Item", "Teste", "Marca", 1.0, 1));
+            if (i % 3 == 0) {
+                // A dona consome parte do próprio trabalho, disputando o último elemento
+                if (auto elemento = compartilhada.removerFim()) {
+                    somaLocal += elemento->getID();
+                    recebidosLocal++;
+                }
+            }
+        }
+        while (auto elemento = compartilhada.removerFim()) {
+            somaLocal += elemento->getID();
+            recebidosLocal++;
+        }
+        somaIds += somaLocal;
+        recebidos += recebidosLocal;
+    });
+    for (int l = 0; l < ladroes; l++) {
+        threads.emplace_back([&] {
+            while (recebidos.load() < total) {
+                if (auto elemento = compartilhada.roubarInicio()) {
+                    somaIds += elemento->getID();
+                    recebidos++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::cout << "Recebidos: " << recebidos.load() << " de " << total << std::endl;
+    verificar(recebidos.load() == total, "Todos os elementos foram retirados");
+    verificar(somaIds.load() == total * (total + 1) / 2, "Cada ID foi retirado exatamente uma vez");
+    verificar(compartilhada.estaVazio(), "Deque termina vazia");
+}
+
+int main() {
+    CONFIGURAR_PORTUGUES();
+
+    std::cout << std::string(60, '=') << std::endl;
+    std::cout << "TESTE DAS ESTRUTURAS CONCORRENTES" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+
+    try {
+        testarFilaConcorrente();
+        testarPilhaConcorrente();
+        testarFilaEncadeadaConcorrente();
+        testarDequeRoubo();
+    } catch (const std::exception& e) {
+        std::cerr << "Erro durante os testes: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    if (falhas == 0) {
+        std::cout << "TODOS OS TESTES EXECUTADOS COM SUCESSO!" << std::endl;
+    } else {
+        std::cout << falhas << " VERIFICAÇÃO(ÕES) FALHARAM!" << std::endl;
+    }
+    std::cout << std::string(60, '=') << std::endl;
+
+    return falhas == 0 ? 0 : 1;
+}
@@ -1,6 +1,8 @@
 #include "../src/estruturas_encadeadas/ListaSimplesmenteEncadeada.h"
 #include "../src/estruturas_encadeadas/ListaDuplamenteEncadeada.h"
 #include "../src/estruturas_encadeadas/ListaDuplamenteEncadeadaCircular.h"
+#include "../src/estruturas_encadeadas/ListaDesenrolada.h"
+#include "../src/estruturas_encadeadas/ListaIntrusiva.h"
 #include "../src/estruturas_encadeadas/PilhaEncadeada.h"
 #include "../src/estruturas_encadeadas/FilaEncadeada.h"
 #include "../src/estruturas_encadeadas/Deque.h"
@@ -8,8 +10,12 @@
 #include "../src/elementos/Funcionario.h"
 #include "../src/elementos/Produto.h"
 #include "../ConfigLocale.h"
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 // Declarações das funções de teste
 void testarListaSimplesmenteEncadeada();
@@ -21,6 +27,14 @@ void testarDeque();
 void compararEstruturas();
 void demonstrarEncapsulamento();
 void testarAdaptadores();
+void testarPoolNos();
+void testarListaDesenrolada();
+void testarListaIntrusiva();
+void testarIndicePosicional();
+void testarIndiceIds();
+void testarDedoPosicional();
+void testarTransferencias();
+void testarOrdenacao();
 
 void testarListaSimplesmenteEncadeada() {
     std::cout << "\n" << std::string(60, '=') << std::endl;
@@ -202,6 +216,978 @@ void testarListaDuplamenteEncadeadaCircular() {
     lista.imprimirLista();
     
     std::cout << "Verificando integridade após remoção: " << (lista.verificarIntegridade() ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n8. Rotações pelo lado mais curto comparadas com std::rotate:" << std::endl;
+    ListaDuplamenteEncadeadaCircular rotacao;
+    std::vector<long> referencia;
+    for (long id = 0; id < 7; id++) {
+        rotacao.inserirNoFim(std::make_unique<Produto>(id, "Item", "Rodízio", "Marca", 1.0, 1));
+        referencia.push_back(id);
+    }
+    bool rotacoesConferem = true;
+    for (int k = -15; k <= 15; k++) {
+        int passo = ((k % 7) + 7) % 7;
+        if (k % 2 == 0) {
+            rotacao.rotacionarDireita(k);
+            std::rotate(referencia.begin(), referencia.begin() + passo, referencia.end());
+        } else {
+            rotacao.rotacionarEsquerda(k);
+            std::rotate(referencia.begin(), referencia.end() - passo, referencia.end());
+        }
+        for (int i = 0; i < 7; i++) {
+            rotacoesConferem = rotacoesConferem && rotacao.obterElementoPorPosicao(i)->getID() == referencia[i];
+        }
+        rotacoesConferem = rotacoesConferem && rotacao.verificarIntegridade();
+    }
+    std::cout << "Rotações de -15 a 15 conferem? " << (rotacoesConferem ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n9. Cursor de rodízio (avancar/atual) com remoções:" << std::endl;
+    rotacao.reiniciarCursor();
+    std::cout << "Sequência: " << rotacao.atual()->getID();
+    for (int passo = 0; passo < 9; passo++) {
+        std::cout << " " << rotacao.avancar()->getID();
+    }
+    std::cout << " | Recuar: " << rotacao.recuar()->getID() << std::endl;
+    long idAtual = rotacao.atual()->getID();
+    long idSeguinte = rotacao.obterElementoPorPosicao(
+        (static_cast<int>(std::find(referencia.begin(), referencia.end(), idAtual) - referencia.begin()) + 1) % 7)->getID();
+    auto retirado = rotacao.removerAtual();
+    std::cout << "removerAtual(): ID " << retirado->getID() << " | Cursor passou para o seguinte? "
+              << (rotacao.atual()->getID() == idSeguinte ? "Sim" : "Não") << std::endl;
+    rotacao.removerPeloId(rotacao.atual()->getID());
+    while (rotacao.getTamanho() > 1) {
+        rotacao.removerAtual();
+    }
+    std::cout << "Um elemento: avancar() volta a ele? " << (rotacao.avancar() == rotacao.atual() ? "Sim" : "Não");
+    rotacao.removerAtual();
+    std::cout << " | Lista vazia: atual() = " << (rotacao.atual() ? "elemento" : "nullptr")
+              << ", avancar() = " << (rotacao.avancar() ? "elemento" : "nullptr") << std::endl;
+}
+
+void testarListaDesenrolada() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: LISTA DESENROLADA (16 ELEMENTOS POR BLOCO)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    ListaDesenrolada lista;
+    
+    std::cout << "\n1. Inserindo elementos nas duas pontas:" << std::endl;
+    lista.inserirNoFim(std::make_unique<Aluno>(1, "João Silva", "Computação", 8.5));
+    lista.inserirNoFim(std::make_unique<Funcionario>(2, "Maria Santos", "Desenvolvedora", "TI", 6000.0));
+    lista.inserirNoInicio(std::make_unique<Produto>(3, "Notebook", "Eletrônicos", "Dell", 2500.0, 10));
+    lista.imprimirLista();
+    
+    std::cout << "\n2. Preenchendo vários blocos (IDs 100 a 139 no fim, 99 a 60 no início):" << std::endl;
+    for (int i = 0; i < 40; i++) {
+        lista.inserirNoFim(std::make_unique<Aluno>(100 + i, "Aluno", "Curso", 7.0));
+        lista.inserirNoInicio(std::make_unique<Aluno>(99 - i, "Aluno", "Curso", 7.0));
+    }
+    std::cout << "Tamanho: " << lista.getTamanho() << " | Blocos: " << lista.getBlocos() << std::endl;
+    std::cout << "Primeiro: " << lista.getPrimeiro()->getID()
+              << " | Posição 40: " << lista.obterElementoPorPosicao(40)->getID()
+              << " | Última posição: " << lista.obterElementoPorPosicao(lista.getTamanho() - 1)->getID() << std::endl;
+    
+    std::cout << "\n3. Busca e contagem pelos IDs em cache:" << std::endl;
+    Elemento* encontrado = lista.buscarPeloId(2);
+    std::cout << "Busca ID=2: " << (encontrado && encontrado->getID() == 2 ? "encontrado" : "FALHA") << std::endl;
+    std::cout << "Busca ID=5000: " << (lista.buscarPeloId(5000) ? "FALHA" : "não encontrado (correto)") << std::endl;
+    std::cout << "IDs pares: " << lista.contarPorId([](long id) { return id % 2 == 0; })
+              << " | Elementos com ID >= 100: "
+              << lista.contarElementos([](const Elemento* e) { return e->getID() >= 100; }) << std::endl;
+    
+    std::cout << "\n4. Alteração e remoções:" << std::endl;
+    bool alterado = lista.alterarPeloId(2, std::make_unique<Funcionario>(2000, "Maria Santos", "Gerente", "TI", 9000.0));
+    std::cout << "Alterar ID 2 -> 2000: " << (alterado && lista.buscarPeloId(2000) && !lista.buscarPeloId(2) ? "OK" : "FALHA") << std::endl;
+    auto meio = lista.removerPeloId(110);
+    auto primeiro = lista.removerPrimeiro();
+    auto ultimo = lista.removerUltimo();
+    std::cout << "Removidos: " << (meio ? meio->getID() : -1) << ", "
+              << (primeiro ? primeiro->getID() : -1) << ", "
+              << (ultimo ? ultimo->getID() : -1) << std::endl;
+    std::cout << "Tamanho: " << lista.getTamanho() << " | Busca ID=110 após remoção: "
+              << (lista.buscarPeloId(110) ? "FALHA" : "não encontrado (correto)") << std::endl;
+    
+    std::cout << "\n5. Remoção espalhada (1600 elementos, 15 de cada 16 IDs removidos):" << std::endl;
+    ListaDesenrolada esparsa;
+    for (int i = 0; i < 1600; i++) {
+        esparsa.inserirNoFim(std::make_unique<Aluno>(i, "Aluno", "Curso", 7.0));
+    }
+    for (int i = 0; i < 1600; i++) {
+        if (i % 16 != 0) {
+            esparsa.removerPeloId(i);
+        }
+    }
+    // Todo bloco menos o último fica com pelo menos metade das posições ocupadas
+    int metade = ListaDesenrolada::CAPACIDADE_BLOCO / 2;
+    bool compacta = esparsa.getTamanho() == 100 && esparsa.getBlocos() <= (esparsa.getTamanho() + metade - 1) / metade;
+    for (int i = 0; i < esparsa.getTamanho() && compacta; i++) {
+        compacta = esparsa.obterElementoPorPosicao(i)->getID() == 16L * i && esparsa.buscarPeloId(16L * i) != nullptr;
+    }
+    std::cout << "Tamanho: " << esparsa.getTamanho() << " | Blocos: " << esparsa.getBlocos()
+              << " (eram 100) | Ordem e buscas: " << (compacta ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n6. Esvaziando pelo fim (blocos liberados ao esvaziar):" << std::endl;
+    while (!lista.estaVazia()) {
+        lista.removerUltimo();
+    }
+    std::cout << "Vazia? " << (lista.estaVazia() ? "Sim" : "Não") << " | Blocos: " << lista.getBlocos() << std::endl;
+    
+    std::cout << "\n✅ Teste da lista desenrolada concluído!" << std::endl;
+}
+
+void testarListaIntrusiva() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: LISTA INTRUSIVA (SEM NÓS ALOCADOS)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    ListaIntrusiva<Produto> lista;
+    
+    std::cout << "\n1. Inserindo produtos (os ganchos ficam nos próprios objetos):" << std::endl;
+    auto teclado = std::make_unique<Produto>(20, "Teclado", "Periféricos", "Logitech", 150.0, 30);
+    Produto* tecladoPtr = teclado.get();
+    std::cout << "Teclado encadeado antes da inserção? " << (tecladoPtr->estaEncadeado() ? "Sim" : "Não") << std::endl;
+    lista.inserirNoFim(std::make_unique<Produto>(10, "Mouse", "Periféricos", "Logitech", 80.0, 50));
+    lista.inserirNoFim(std::move(teclado));
+    lista.inserirNoInicio(std::make_unique<Produto>(5, "Monitor", "Periféricos", "LG", 900.0, 8));
+    lista.inserirNoFim(std::make_unique<Produto>(30, "Webcam", "Periféricos", "Logitech", 300.0, 0));
+    std::cout << "Teclado encadeado após a inserção? " << (tecladoPtr->estaEncadeado() ? "Sim" : "Não") << std::endl;
+    std::cout << "Ordem: ";
+    lista.paraCada([](const Produto& p) { std::cout << p.getID() << " "; });
+    std::cout << "| Tamanho: " << lista.getTamanho() << std::endl;
+    
+    std::cout << "\n2. Navegação pelos ganchos:" << std::endl;
+    std::cout << "Antes do teclado: " << lista.getAnterior(tecladoPtr)->getNome()
+              << " | Depois do teclado: " << lista.getProximo(tecladoPtr)->getNome() << std::endl;
+    std::cout << "Último: " << lista.getUltimo()->getNome()
+              << " | Após o último: " << (lista.getProximo(lista.getUltimo()) ? "FALHA" : "nullptr (correto)") << std::endl;
+    std::cout << "Posição 1: " << lista.obterElementoPorPosicao(1)->getNome()
+              << " | Posição 3: " << lista.obterElementoPorPosicao(3)->getNome() << std::endl;
+    
+    std::cout << "\n3. Remoção O(1) pelo ponteiro e reinserção em outra lista:" << std::endl;
+    auto removido = lista.remover(tecladoPtr);
+    std::cout << "Removido: " << removido->getNome()
+              << " | Encadeado? " << (removido->estaEncadeado() ? "Sim" : "Não")
+              << " | Tamanho: " << lista.getTamanho() << std::endl;
+    ListaIntrusiva<Produto> outraLista;
+    outraLista.inserirNoFim(std::move(removido));
+    std::cout << "Outra lista: " << outraLista.getPrimeiro()->getNome() << " | Tamanho: " << outraLista.getTamanho() << std::endl;
+    
+    std::cout << "\n4. Elemento já encadeado não pode entrar em outra lista:" << std::endl;
+    try {
+        // Posse duplicada de propósito: a lista recusa e não destrói o elemento
+        outraLista.inserirNoFim(std::unique_ptr<Produto>(lista.getPrimeiro()));
+        std::cout << "FALHA: inserção aceita" << std::endl;
+    } catch (const std::invalid_argument& e) {
+        std::cout << "Exceção capturada: " << e.what() << std::endl;
+    }
+    std::cout << "Primeira lista intacta? " << (lista.getTamanho() == 3 && lista.getPrimeiro()->getID() == 5 ? "Sim" : "Não") << std::endl;
+    // remover(T*) com um elemento da outra lista: recusado, as duas ficam como estavam
+    Produto* alheio = outraLista.getPrimeiro();
+    bool recusado = !lista.remover(alheio) && outraLista.contem(alheio) && !lista.contem(alheio) &&
+                    lista.getTamanho() == 3 && outraLista.getTamanho() == 1;
+    std::cout << "Remover elemento da outra lista: " << (recusado ? "nullptr, listas intactas (correto)" : "FALHA") << std::endl;
+    
+    std::cout << "\n5. Busca, alteração e remoção por ID:" << std::endl;
+    lista.alterarPeloId(10, std::make_unique<Produto>(11, "Mouse sem fio", "Periféricos", "Logitech", 120.0, 40));
+    std::cout << "ID 10 após alterar: " << (lista.buscarPeloId(10) ? "FALHA" : "substituído")
+              << " | ID 11 na posição 1: " << lista.obterElementoPorPosicao(1)->getNome() << std::endl;
+    auto webcam = lista.removerPeloId(30);
+    auto monitor = lista.removerPrimeiro();
+    std::cout << "Removidos: " << webcam->getNome() << ", " << monitor->getNome()
+              << " | Restante: " << lista.getPrimeiro()->getNome() << std::endl;
+    std::cout << "Remover por ID inexistente: " << (lista.removerPeloId(999) ? "FALHA" : "nullptr (correto)") << std::endl;
+    
+    std::cout << "\n6. Lista de alunos usando o mesmo gancho:" << std::endl;
+    ListaIntrusiva<Aluno> alunos;
+    alunos.inserirNoFim(std::make_unique<Aluno>(1, "Ana", "Computação", 9.0));
+    alunos.inserirNoFim(std::make_unique<Aluno>(2, "Bruno", "Computação", 7.5));
+    alunos.imprimirLista();
+    alunos.limpar();
+    std::cout << "Vazia após limpar? " << (alunos.estaVazia() ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n✅ Teste da lista intrusiva concluído!" << std::endl;
+}
+
+void testarIndicePosicional() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO: ÍNDICE POSICIONAL NA LISTA DUPLAMENTE ENCADEADA" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    ListaDuplamenteEncadeada lista;
+    for (int i = 0; i < 10; i++) {
+        lista.inserirNoFim(std::make_unique<Aluno>(i, "Aluno", "Curso", 7.0));
+    }
+    
+    std::cout << "\n1. Ativando o índice sobre uma lista com 10 elementos:" << std::endl;
+    lista.ativarIndicePosicional();
+    std::cout << "Índice ativo? " << (lista.usaIndicePosicional() ? "Sim" : "Não")
+              << " | Posição 7: ID " << lista.obterElementoPorPosicao(7)->getID() << std::endl;
+    
+    std::cout << "\n2. Inserções e remoções posicionais com o índice:" << std::endl;
+    lista.inserirNaPosicao(5, std::make_unique<Aluno>(100, "Novo", "Curso", 8.0));
+    lista.removerDaPosicao(2);
+    std::cout << "Ordem: ";
+    for (int i = 0; i < lista.getTamanho(); i++) {
+        std::cout << lista.obterElementoPorPosicao(i)->getID() << " ";
+    }
+    std::cout << "| Tamanho: " << lista.getTamanho() << std::endl;
+    
+    std::cout << "\n3. Operações aleatórias comparadas com um vector de referência:" << std::endl;
+    std::vector<long> referencia;
+    for (int i = 0; i < lista.getTamanho(); i++) {
+        referencia.push_back(lista.obterElementoPorPosicao(i)->getID());
+    }
+    std::mt19937 gerador(2024);
+    long proximoId = 1000;
+    bool consistente = true;
+    for (int operacao = 0; operacao < 20000 && consistente; operacao++) {
+        int tamanho = static_cast<int>(referencia.size());
+        int tipo = static_cast<int>(gerador() % 8);
+        if (tipo < 3 || tamanho == 0) {
+            int posicao = static_cast<int>(gerador() % (tamanho + 1));
+            lista.inserirNaPosicao(posicao, std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencia.insert(referencia.begin() + posicao, proximoId++);
+        } else if (tipo == 3) {
+            int posicao = static_cast<int>(gerador() % tamanho);
+            auto removido = lista.removerDaPosicao(posicao);
+            consistente = removido && removido->getID() == referencia[posicao];
+            referencia.erase(referencia.begin() + posicao);
+        } else if (tipo == 4) {
+            long id = referencia[gerador() % tamanho];
+            lista.removerPeloId(id);
+            referencia.erase(std::find(referencia.begin(), referencia.end(), id));
+        } else if (tipo == 5) {
+            lista.inserirNoInicio(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencia.insert(referencia.begin(), proximoId++);
+            lista.removerUltimo();
+            referencia.pop_back();
+        } else {
+            int posicao = static_cast<int>(gerador() % tamanho);
+            Elemento* elemento = lista.obterElementoPorPosicao(posicao);
+            consistente = elemento && elemento->getID() == referencia[posicao];
+        }
+        consistente = consistente && lista.getTamanho() == static_cast<int>(referencia.size());
+    }
+    for (int i = 0; consistente && i < lista.getTamanho(); i++) {
+        consistente = lista.obterElementoPorPosicao(i)->getID() == referencia[i];
+    }
+    std::cout << "20000 operações, tamanho final " << lista.getTamanho()
+              << " | Lista e referência conferem? " << (consistente ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n4. Limpando e desativando:" << std::endl;
+    lista.limpar();
+    lista.inserirNoFim(std::make_unique<Aluno>(1, "Aluno", "Curso", 7.0));
+    std::cout << "Após limpar e inserir 1: posição 0 = ID " << lista.obterElementoPorPosicao(0)->getID() << std::endl;
+    lista.desativarIndicePosicional();
+    std::cout << "Índice ativo? " << (lista.usaIndicePosicional() ? "Sim" : "Não")
+              << " | Posição 0 sem índice: ID " << lista.obterElementoPorPosicao(0)->getID() << std::endl;
+    
+    std::cout << "\n✅ Teste do índice posicional concluído!" << std::endl;
+}
+
+/**
+ * @brief Aplica as mesmas operações aleatórias a uma lista com índice de IDs
+ * e a outra sem, comparando cada resultado
+ *
+ * Com faixaIds pequena aparecem IDs repetidos; com faixa grande quase todos
+ * são únicos e o índice responde sozinho. O estoque de cada Produto é um
+ * número de série que identifica o objeto.
+ */
+template<typename Lista, typename Preparar>
+bool compararComIndiceIds(unsigned semente, long faixaIds, Preparar preparar) {
+    Lista comIndice;
+    Lista semIndice;
+    comIndice.ativarIndiceIds();
+    preparar(comIndice);
+    std::mt19937 gerador(semente);
+    int serie = 0;
+    
+    auto novo = [&serie](long id) {
+        return std::make_unique<Produto>(id, "Item", "Teste", "Marca", 1.0, serie);
+    };
+    auto mesmaSerie = [](const Elemento* a, const Elemento* b) {
+        if (!a || !b) {
+            return a == b;
+        }
+        return static_cast<const Produto*>(a)->getQuantidadeEstoque() ==
+               static_cast<const Produto*>(b)->getQuantidadeEstoque();
+    };
+    
+    for (int operacao = 0; operacao < 20000; operacao++) {
+        long id = static_cast<long>(gerador() % faixaIds);
+        if (gerador() % 2 == 0 && !comIndice.estaVazia()) {
+            // Metade das vezes, um ID que está na lista
+            id = comIndice.obterElementoPorPosicao(static_cast<int>(gerador() % comIndice.getTamanho()))->getID();
+        }
+        switch (gerador() % 7) {
+            case 0:
+                comIndice.inserirNoInicio(novo(id));
+                semIndice.inserirNoInicio(novo(id));
+                serie++;
+                break;
+            case 1:
+            case 2:
+                comIndice.inserirNoFim(novo(id));
+                semIndice.inserirNoFim(novo(id));
+                serie++;
+                break;
+            case 3: {
+                auto a = comIndice.removerPeloId(id);
+                auto b = semIndice.removerPeloId(id);
+                if (!mesmaSerie(a.get(), b.get())) {
+                    return false;
+                }
+                break;
+            }
+            case 4: {
+                long novoId = static_cast<long>(gerador() % faixaIds);
+                bool a = comIndice.alterarPeloId(id, novo(novoId));
+                bool b = semIndice.alterarPeloId(id, novo(novoId));
+                serie++;
+                if (a != b) {
+                    return false;
+                }
+                break;
+            }
+            case 5: {
+                bool doInicio = gerador() % 2 == 0;
+                auto a = doInicio ? comIndice.removerPrimeiro() : comIndice.removerUltimo();
+                auto b = doInicio ? semIndice.removerPrimeiro() : semIndice.removerUltimo();
+                if (!mesmaSerie(a.get(), b.get())) {
+                    return false;
+                }
+                break;
+            }
+            default:
+                if (!mesmaSerie(comIndice.buscarPeloId(id), semIndice.buscarPeloId(id))) {
+                    return false;
+                }
+        }
+        if (comIndice.getTamanho() != semIndice.getTamanho()) {
+            return false;
+        }
+    }
+    
+    for (int i = 0; i < comIndice.getTamanho(); i++) {
+        if (!mesmaSerie(comIndice.obterElementoPorPosicao(i), semIndice.obterElementoPorPosicao(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testarIndiceIds() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO: ÍNDICE HASH DE IDs NAS LISTAS ENCADEADAS" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    std::cout << "\n1. Operações por ID com o índice ativo (lista dupla):" << std::endl;
+    ListaDuplamenteEncadeada lista;
+    lista.ativarIndiceIds();
+    for (int i = 1; i <= 5; i++) {
+        lista.inserirNoFim(std::make_unique<Aluno>(i * 10, "Aluno " + std::to_string(i), "Curso", 7.0));
+    }
+    std::cout << "Índice ativo? " << (lista.usaIndiceIds() ? "Sim" : "Não")
+              << " | Busca ID=30: " << (lista.buscarPeloId(30) ? "encontrado" : "FALHA") << std::endl;
+    auto removido = lista.removerPeloId(30);
+    std::cout << "Removido do meio: " << (removido ? removido->getID() : -1)
+              << " | Busca ID=30 depois: " << (lista.buscarPeloId(30) ? "FALHA" : "não encontrado (correto)") << std::endl;
+    lista.alterarPeloId(40, std::make_unique<Aluno>(45, "Aluno 4", "Curso", 9.0));
+    std::cout << "Alterar 40 -> 45: ID 40 " << (lista.buscarPeloId(40) ? "FALHA" : "sumiu")
+              << ", ID 45 " << (lista.buscarPeloId(45) ? "encontrado" : "FALHA") << std::endl;
+    
+    std::cout << "\n2. IDs repetidos voltam à busca linear (primeira ocorrência):" << std::endl;
+    lista.inserirNoFim(std::make_unique<Aluno>(10, "Repetido", "Curso", 5.0));
+    auto primeiro = lista.removerPeloId(10);
+    std::cout << "Removido ID=10: " << (primeiro && primeiro->getID() == 10 && lista.buscarPeloId(10) ? "primeira ocorrência, a outra continua" : "FALHA") << std::endl;
+    
+    std::cout << "\n3. 20000 operações aleatórias, com e sem índice, nas três listas:" << std::endl;
+    auto nada = [](auto&) {};
+    auto comPosicional = [](ListaDuplamenteEncadeada& l) { l.ativarIndicePosicional(); };
+    for (long faixa : {1500L, 5000000L}) {
+        std::cout << "IDs em [0, " << faixa << "):" << std::endl;
+        std::cout << "  ListaSimplesmenteEncadeada: "
+                  << (compararComIndiceIds<ListaSimplesmenteEncadeada>(1, faixa, nada) ? "OK" : "FALHA") << std::endl;
+        std::cout << "  ListaDuplamenteEncadeada: "
+                  << (compararComIndiceIds<ListaDuplamenteEncadeada>(2, faixa, nada) ? "OK" : "FALHA") << std::endl;
+        std::cout << "  ListaDuplamenteEncadeada + índice posicional: "
+                  << (compararComIndiceIds<ListaDuplamenteEncadeada>(3, faixa, comPosicional) ? "OK" : "FALHA") << std::endl;
+        std::cout << "  ListaDuplamenteEncadeadaCircular: "
+                  << (compararComIndiceIds<ListaDuplamenteEncadeadaCircular>(4, faixa, nada) ? "OK" : "FALHA") << std::endl;
+    }
+    
+    std::cout << "\n✅ Teste do índice de IDs concluído!" << std::endl;
+}
+
+/**
+ * @brief Sorteia a próxima posição acessada: na maioria das vezes vizinha
+ * da anterior (percurso quase sequencial), às vezes qualquer uma
+ */
+int sortearPosicaoProxima(std::mt19937& gerador, int anterior, int tamanho) {
+    int posicao = gerador() % 4 == 0 ? static_cast<int>(gerador() % tamanho)
+                                     : anterior + static_cast<int>(gerador() % 5) - 2;
+    return std::min(std::max(posicao, 0), tamanho - 1);
+}
+
+/**
+ * @brief Mistura acessos por posição e alterações da lista dupla, conferindo com um vector
+ */
+bool conferirDedoListaDupla(bool comIndicePosicional) {
+    ListaDuplamenteEncadeada lista;
+    std::vector<long> referencia;
+    long proximoId = 0;
+    for (; proximoId < 300; proximoId++) {
+        lista.inserirNoFim(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+        referencia.push_back(proximoId);
+    }
+    if (comIndicePosicional) {
+        lista.ativarIndicePosicional();
+    }
+    
+    std::mt19937 gerador(42);
+    int posicao = 0;
+    bool consistente = true;
+    for (int operacao = 0; operacao < 30000 && consistente; operacao++) {
+        int tamanho = static_cast<int>(referencia.size());
+        int tipo = static_cast<int>(gerador() % 16);
+        posicao = sortearPosicaoProxima(gerador, posicao, std::max(tamanho, 1));
+        if (tipo < 8 && tamanho > 0) {
+            Elemento* elemento = lista.obterElementoPorPosicao(posicao);
+            consistente = elemento && elemento->getID() == referencia[posicao];
+        } else if (tipo < 10 || tamanho < 50) {
+            int destino = std::min(posicao, tamanho);
+            lista.inserirNaPosicao(destino, std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencia.insert(referencia.begin() + destino, proximoId++);
+        } else if (tipo < 12) {
+            auto removido = lista.removerDaPosicao(posicao);
+            consistente = removido && removido->getID() == referencia[posicao];
+            referencia.erase(referencia.begin() + posicao);
+        } else if (tipo == 12) {
+            lista.inserirNoInicio(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencia.insert(referencia.begin(), proximoId++);
+        } else if (tipo == 13) {
+            lista.removerPrimeiro();
+            referencia.erase(referencia.begin());
+            lista.removerUltimo();
+            referencia.pop_back();
+        } else if (tipo == 14) {
+            long id = referencia[gerador() % tamanho];
+            lista.removerPeloId(id);
+            referencia.erase(std::find(referencia.begin(), referencia.end(), id));
+        } else {
+            auto alvo = referencia.begin() + gerador() % tamanho;
+            lista.moverParaInicio(*alvo);
+            std::rotate(referencia.begin(), alvo, alvo + 1);
+        }
+        consistente = consistente && lista.getTamanho() == static_cast<int>(referencia.size());
+    }
+    return consistente;
+}
+
+/**
+ * @brief Mesmo teste na lista circular, incluindo rotações e o cursor de rodízio
+ */
+bool conferirDedoListaCircular() {
+    ListaDuplamenteEncadeadaCircular lista;
+    std::vector<long> referencia;
+    long proximoId = 0;
+    for (; proximoId < 300; proximoId++) {
+        lista.inserirNoFim(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+        referencia.push_back(proximoId);
+    }
+    
+    std::mt19937 gerador(43);
+    int posicao = 0;
+    bool consistente = true;
+    for (int operacao = 0; operacao < 30000 && consistente; operacao++) {
+        int tamanho = static_cast<int>(referencia.size());
+        int tipo = static_cast<int>(gerador() % 16);
+        posicao = sortearPosicaoProxima(gerador, posicao, tamanho);
+        if (tipo < 8) {
+            Elemento* elemento = lista.obterElementoPorPosicao(posicao);
+            consistente = elemento && elemento->getID() == referencia[posicao];
+        } else if (tipo < 10 || tamanho < 50) {
+            lista.inserirNoInicio(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencia.insert(referencia.begin(), proximoId++);
+            lista.inserirNoFim(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencia.push_back(proximoId++);
+        } else if (tipo == 10) {
+            lista.removerPrimeiro();
+            referencia.erase(referencia.begin());
+        } else if (tipo == 11) {
+            lista.removerUltimo();
+            referencia.pop_back();
+        } else if (tipo == 12) {
+            long id = referencia[gerador() % tamanho];
+            lista.removerPeloId(id);
+            referencia.erase(std::find(referencia.begin(), referencia.end(), id));
+        } else if (tipo == 13) {
+            auto removido = lista.removerAtual();
+            referencia.erase(std::find(referencia.begin(), referencia.end(), removido->getID()));
+        } else if (tipo == 14) {
+            int passos = static_cast<int>(gerador() % (2 * tamanho)) - tamanho;
+            lista.rotacionarDireita(passos);
+            int normalizado = ((passos % tamanho) + tamanho) % tamanho;
+            std::rotate(referencia.begin(), referencia.begin() + normalizado, referencia.end());
+        } else {
+            lista.avancar();
+        }
+        consistente = consistente && lista.getTamanho() == static_cast<int>(referencia.size());
+    }
+    return consistente;
+}
+
+void testarDedoPosicional() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO: ACESSO POSICIONAL PELO PONTO MAIS PRÓXIMO (DEDO)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    std::cout << "\n1. Percurso do fim para o início na lista dupla:" << std::endl;
+    ListaDuplamenteEncadeada lista;
+    for (int i = 0; i < 10; i++) {
+        lista.inserirNoFim(std::make_unique<Aluno>(i, "Aluno", "Curso", 7.0));
+    }
+    std::cout << "IDs:";
+    for (int i = lista.getTamanho() - 1; i >= 0; i--) {
+        std::cout << " " << lista.obterElementoPorPosicao(i)->getID();
+    }
+    std::cout << std::endl;
+    
+    std::cout << "\n2. 30000 operações quase sequenciais comparadas com um vector:" << std::endl;
+    std::cout << "ListaDupla: " << (conferirDedoListaDupla(false) ? "OK" : "FALHA")
+              << " | ListaDupla com índice posicional: " << (conferirDedoListaDupla(true) ? "OK" : "FALHA")
+              << " | ListaCircular: " << (conferirDedoListaCircular() ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n✅ Teste do dedo posicional concluído!" << std::endl;
+}
+
+/**
+ * @brief Confere a lista dupla com a referência, de trás para frente (usa os ponteiros 'anterior')
+ * e pelo ID de cada elemento
+ */
+bool conferirListaDupla(const ListaDuplamenteEncadeada& lista, const std::vector<long>& referencia) {
+    if (lista.getTamanho() != static_cast<int>(referencia.size())) {
+        return false;
+    }
+    for (int i = lista.getTamanho() - 1; i >= 0; i--) {
+        if (lista.obterElementoPorPosicao(i)->getID() != referencia[i]) {
+            return false;
+        }
+    }
+    for (int i = 0; i < static_cast<int>(referencia.size()); i += 17) {
+        Elemento* elemento = lista.buscarPeloId(referencia[i]);
+        if (!elemento || elemento->getID() != referencia[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Transfere trechos aleatórios entre duas listas duplas, conferindo com dois vectors
+ * @param poolDestino Se a primeira lista usa pool de nós
+ * @param poolOrigem Se a segunda lista usa pool de nós
+ * @param comIndices Se as duas listas usam índice de IDs e índice posicional
+ */
+bool conferirTransferenciasListaDupla(bool poolDestino, bool poolOrigem, bool comIndices) {
+    ListaDuplamenteEncadeada listas[2] = {ListaDuplamenteEncadeada(poolDestino), ListaDuplamenteEncadeada(poolOrigem)};
+    std::vector<long> referencias[2];
+    long proximoId = 0;
+    for (int l = 0; l < 2; l++) {
+        for (int i = 0; i < 100; i++, proximoId++) {
+            listas[l].inserirNoFim(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+            referencias[l].push_back(proximoId);
+        }
+        if (comIndices) {
+            listas[l].ativarIndiceIds();
+            listas[l].ativarIndicePosicional();
+        }
+    }
+    
+    std::mt19937 gerador(44);
+    bool consistente = true;
+    for (int operacao = 0; operacao < 3000 && consistente; operacao++) {
+        int de = static_cast<int>(gerador() % 2);
+        ListaDuplamenteEncadeada& origem = listas[de];
+        ListaDuplamenteEncadeada& destino = listas[1 - de];
+        std::vector<long>& refOrigem = referencias[de];
+        std::vector<long>& refDestino = referencias[1 - de];
+        int tipo = static_cast<int>(gerador() % 10);
+        
+        if (tipo < 6 && !refOrigem.empty()) {
+            int inicio = static_cast<int>(gerador() % refOrigem.size());
+            int quantidade = 1 + static_cast<int>(gerador() % (refOrigem.size() - inicio));
+            int posicao = static_cast<int>(gerador() % (refDestino.size() + 1));
+            consistente = destino.transferirIntervalo(posicao, origem, inicio, quantidade) == quantidade;
+            refDestino.insert(refDestino.begin() + posicao, refOrigem.begin() + inicio, refOrigem.begin() + inicio + quantidade);
+            refOrigem.erase(refOrigem.begin() + inicio, refOrigem.begin() + inicio + quantidade);
+        } else if (tipo == 6) {
+            destino.transferirNoInicio(origem);
+            refDestino.insert(refDestino.begin(), refOrigem.begin(), refOrigem.end());
+            refOrigem.clear();
+        } else if (tipo == 7) {
+            destino.transferirNoFim(origem);
+            refDestino.insert(refDestino.end(), refOrigem.begin(), refOrigem.end());
+            refOrigem.clear();
+        } else if (refOrigem.size() + refDestino.size() < 300) {
+            // Repõe elementos na origem, intercalando com inserções comuns
+            for (int i = 0; i < 20; i++, proximoId++) {
+                origem.inserirNoFim(std::make_unique<Aluno>(proximoId, "Aluno", "Curso", 7.0));
+                refOrigem.push_back(proximoId);
+            }
+        } else {
+            for (int i = 0; i < 20 && !refDestino.empty(); i++) {
+                destino.removerPrimeiro();
+                refDestino.erase(refDestino.begin());
+            }
+        }
+        
+        // Argumentos inválidos não alteram nada
+        consistente = consistente && destino.transferirIntervalo(0, origem, 0, static_cast<int>(refOrigem.size()) + 1) == 0
+                                  && !destino.transferirNaPosicao(-1, origem)
+                                  && !destino.transferirNaPosicao(0, destino);
+        consistente = consistente && conferirListaDupla(origem, refOrigem) && conferirListaDupla(destino, refDestino);
+    }
+    return consistente;
+}
+
+/**
+ * @brief Mescla listas ordenadas por ID, com IDs repetidos, conferindo com std::merge
+ */
+bool conferirMesclagens(bool poolDestino, bool poolOrigem) {
+    std::mt19937 gerador(45);
+    bool consistente = true;
+    for (int rodada = 0; rodada < 200 && consistente; rodada++) {
+        std::vector<long> idsDestino(gerador() % 30);
+        std::vector<long> idsOrigem(gerador() % 30);
+        for (long& id : idsDestino) {
+            id = gerador() % 40;
+        }
+        for (long& id : idsOrigem) {
+            id = gerador() % 40;
+        }
+        std::sort(idsDestino.begin(), idsDestino.end());
+        std::sort(idsOrigem.begin(), idsOrigem.end());
+        
+        // O nome registra de qual lista veio cada elemento, para conferir a estabilidade
+        ListaDuplamenteEncadeada destino(poolDestino), origem(poolOrigem);
+        ListaSimplesmenteEncadeada destinoSimples(poolDestino), origemSimples(poolOrigem);
+        for (long id : idsDestino) {
+            destino.inserirNoFim(std::make_unique<Aluno>(id, "Destino", "Curso", 7.0));
+            destinoSimples.inserirNoFim(std::make_unique<Aluno>(id, "Destino", "Curso", 7.0));
+        }
+        for (long id : idsOrigem) {
+            origem.inserirNoFim(std::make_unique<Aluno>(id, "Origem", "Curso", 7.0));
+            origemSimples.inserirNoFim(std::make_unique<Aluno>(id, "Origem", "Curso", 7.0));
+        }
+        destino.mesclarOrdenadoPorId(origem);
+        destinoSimples.mesclarOrdenadoPorId(origemSimples);
+        
+        // Referência estável: a cada ID, os de 'destino' primeiro
+        std::vector<std::pair<long, int>> esperado;
+        for (long id : idsDestino) {
+            esperado.push_back({id, 0});
+        }
+        for (long id : idsOrigem) {
+            esperado.push_back({id, 1});
+        }
+        std::stable_sort(esperado.begin(), esperado.end(),
+                         [](const std::pair<long, int>& a, const std::pair<long, int>& b) { return a.first < b.first; });
+        
+        consistente = origem.estaVazia() && origemSimples.estaVazia() &&
+                      destino.getTamanho() == static_cast<int>(esperado.size()) &&
+                      destinoSimples.getTamanho() == static_cast<int>(esperado.size());
+        for (int i = static_cast<int>(esperado.size()) - 1; i >= 0 && consistente; i--) {
+            auto* aluno = dynamic_cast<Aluno*>(destino.obterElementoPorPosicao(i));
+            auto* alunoSimples = dynamic_cast<Aluno*>(destinoSimples.obterElementoPorPosicao(i));
+            const char* nome = esperado[i].second == 0 ? "Destino" : "Origem";
+            consistente = aluno->getID() == esperado[i].first && aluno->getNome() == nome &&
+                          alunoSimples->getID() == esperado[i].first && alunoSimples->getNome() == nome;
+        }
+        
+        // Os dois lados da lista dupla continuam ligados: remove pelas pontas
+        if (consistente && !esperado.empty()) {
+            consistente = destino.removerUltimo()->getID() == esperado.back().first &&
+                          destinoSimples.removerUltimo()->getID() == esperado.back().first;
+        }
+    }
+    return consistente;
+}
+
+void testarTransferencias() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO: TRANSFERÊNCIAS EM BLOCO E MESCLA ENTRE LISTAS" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    auto imprimirIds = [](const char* rotulo, const ListaDuplamenteEncadeada& lista) {
+        std::cout << rotulo << ":";
+        lista.paraCada([](Elemento& elemento) {
+            std::cout << " " << elemento.getID();
+        });
+        std::cout << " (tamanho " << lista.getTamanho() << ")" << std::endl;
+    };
+    
+    std::cout << "\n1. Trecho e lista inteira entre listas duplas:" << std::endl;
+    ListaDuplamenteEncadeada a, b;
+    for (int i = 0; i < 5; i++) {
+        a.inserirNoFim(std::make_unique<Aluno>(i, "Aluno", "Curso", 7.0));
+        b.inserirNoFim(std::make_unique<Aluno>(10 + i, "Aluno", "Curso", 7.0));
+    }
+    std::cout << "transferirIntervalo(2, b, 1, 3): " << a.transferirIntervalo(2, b, 1, 3) << " movidos" << std::endl;
+    imprimirIds("A", a);
+    imprimirIds("B", b);
+    a.transferirNoFim(b);
+    imprimirIds("A após transferirNoFim(B)", a);
+    std::cout << "B vazia: " << (b.estaVazia() ? "sim" : "não") << std::endl;
+    
+    std::cout << "\n2. Mescla de listas ordenadas por ID:" << std::endl;
+    ListaDuplamenteEncadeada pares, impares;
+    for (int i = 0; i < 6; i++) {
+        pares.inserirNoFim(std::make_unique<Aluno>(2 * i, "Aluno", "Curso", 7.0));
+        impares.inserirNoFim(std::make_unique<Aluno>(2 * i + 1, "Aluno", "Curso", 7.0));
+    }
+    pares.mesclarOrdenadoPorId(impares);
+    imprimirIds("Mesclada", pares);
+    
+    std::cout << "\n3. Pilha, fila e deque esvaziando uns nos outros:" << std::endl;
+    FilaEncadeada fila, outraFila;
+    PilhaEncadeada pilha, outraPilha;
+    for (int i = 1; i <= 3; i++) {
+        fila.enfileirar(std::make_unique<Aluno>(i, "Aluno", "Curso", 7.0));
+        outraFila.enfileirar(std::make_unique<Aluno>(10 + i, "Aluno", "Curso", 7.0));
+        pilha.empilhar(std::make_unique<Aluno>(20 + i, "Aluno", "Curso", 7.0));
+        outraPilha.empilhar(std::make_unique<Aluno>(30 + i, "Aluno", "Curso", 7.0));
+    }
+    fila.enfileirarTudo(outraFila);     // 1 2 3 11 12 13
+    fila.enfileirarTudo(pilha);         // ... 23 22 21 (ordem dos desempilhamentos)
+    outraPilha.empilharTudo(fila);      // topo: 1 2 3 11 12 13 23 22 21, depois 33 32 31
+    std::vector<long> esperado = {1, 2, 3, 11, 12, 13, 23, 22, 21, 33, 32, 31};
+    std::vector<long> obtido;
+    while (!outraPilha.estaVazia()) {
+        obtido.push_back(outraPilha.desempilhar()->getID());
+    }
+    std::cout << "Ordem dos desempilhamentos:";
+    for (long id : obtido) {
+        std::cout << " " << id;
+    }
+    std::cout << " -> " << (obtido == esperado && fila.estaVazia() && pilha.estaVazia() && outraFila.estaVazia() ? "OK" : "FALHA")
+              << std::endl;
+    
+    Deque frente, tras;
+    frente.inserirFim(std::make_unique<Aluno>(2, "Aluno", "Curso", 7.0));
+    tras.inserirFim(std::make_unique<Aluno>(1, "Aluno", "Curso", 7.0));
+    frente.inserirTudoNoInicio(tras);
+    tras.inserirFim(std::make_unique<Aluno>(3, "Aluno", "Curso", 7.0));
+    frente.inserirTudoNoFim(tras);
+    std::cout << "Deque: " << frente.inicio()->getID() << " ... " << frente.fim()->getID()
+              << " (tamanho " << frente.getTamanho() << ") -> "
+              << (frente.getTamanho() == 3 && frente.removerInicio()->getID() == 1 &&
+                  frente.removerFim()->getID() == 3 && tras.estaVazio() ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n4. 3000 transferências aleatórias comparadas com vectors:" << std::endl;
+    std::cout << "Sem pool: " << (conferirTransferenciasListaDupla(false, false, false) ? "OK" : "FALHA")
+              << " | Pools diferentes: " << (conferirTransferenciasListaDupla(true, false, false) ? "OK" : "FALHA")
+              << " | Com índices: " << (conferirTransferenciasListaDupla(false, false, true) ? "OK" : "FALHA")
+              << " | Pools e índices: " << (conferirTransferenciasListaDupla(true, true, true) ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n5. 200 mesclas com IDs repetidos comparadas com uma ordenação estável:" << std::endl;
+    std::cout << "Sem pool: " << (conferirMesclagens(false, false) ? "OK" : "FALHA")
+              << " | Com pool na origem: " << (conferirMesclagens(false, true) ? "OK" : "FALHA")
+              << " | Com pool no destino: " << (conferirMesclagens(true, false) ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n✅ Teste das transferências concluído!" << std::endl;
+}
+
+/**
+ * @brief Compara a ordem dos IDs da lista com a esperada (pela posição)
+ */
+template<typename Lista>
+bool conferirOrdemIds(const Lista& lista, const std::vector<long>& esperado) {
+    if (lista.getTamanho() != static_cast<int>(esperado.size())) {
+        return false;
+    }
+    for (int i = 0; i < lista.getTamanho(); i++) {
+        if (lista.obterElementoPorPosicao(i)->getID() != esperado[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Ordena listas aleatórias por nota (muitos empates) e por ID, conferindo com std::stable_sort
+ * @param usarPoolNos Se as listas usam pool de nós
+ * @param comIndices Se as listas usam índice de IDs (e a dupla, também o posicional)
+ */
+bool conferirOrdenacoes(bool usarPoolNos, bool comIndices) {
+    std::mt19937 gerador(46);
+    bool consistente = true;
+    for (int rodada = 0; rodada < 60 && consistente; rodada++) {
+        int tamanho = rodada < 4 ? rodada : static_cast<int>(gerador() % 400);
+        std::vector<long> ids(tamanho);
+        for (int i = 0; i < tamanho; i++) {
+            ids[i] = i;
+        }
+        std::shuffle(ids.begin(), ids.end(), gerador);
+        
+        ListaSimplesmenteEncadeada simples(usarPoolNos);
+        ListaDuplamenteEncadeada dupla(usarPoolNos);
+        std::vector<std::pair<double, long>> referencia;
+        for (long id : ids) {
+            double nota = static_cast<double>(gerador() % 11);
+            simples.inserirNoFim(std::make_unique<Aluno>(id, "Aluno", "Curso", nota));
+            dupla.inserirNoFim(std::make_unique<Aluno>(id, "Aluno", "Curso", nota));
+            referencia.push_back({nota, id});
+        }
+        if (comIndices) {
+            simples.ativarIndiceIds();
+            dupla.ativarIndiceIds();
+            dupla.ativarIndicePosicional();
+        }
+        
+        // Por nota decrescente: empates ficam na ordem de inserção
+        auto porNota = [](const Elemento& a, const Elemento& b) {
+            return static_cast<const Aluno&>(a).getNota() > static_cast<const Aluno&>(b).getNota();
+        };
+        simples.ordenar(porNota);
+        dupla.ordenar(porNota);
+        std::stable_sort(referencia.begin(), referencia.end(),
+                         [](const std::pair<double, long>& a, const std::pair<double, long>& b) { return a.first > b.first; });
+        std::vector<long> esperado;
+        for (const auto& par : referencia) {
+            esperado.push_back(par.second);
+        }
+        consistente = conferirOrdemIds(simples, esperado) && conferirOrdemIds(dupla, esperado);
+        
+        // Os ponteiros 'anterior' e a cauda foram refeitos: percorre de trás para frente
+        for (int i = tamanho - 1; i >= 0 && consistente; i--) {
+            consistente = dupla.obterElementoPorPosicao(i)->getID() == esperado[i];
+        }
+        
+        simples.ordenarPorId();
+        dupla.ordenarPorId();
+        std::sort(esperado.begin(), esperado.end());
+        consistente = consistente && conferirOrdemIds(simples, esperado) && conferirOrdemIds(dupla, esperado);
+        
+        // A lista segue utilizável: cauda, busca por ID e remoções pelas pontas
+        simples.inserirNoFim(std::make_unique<Aluno>(tamanho, "Aluno", "Curso", 5.0));
+        dupla.inserirNoFim(std::make_unique<Aluno>(tamanho, "Aluno", "Curso", 5.0));
+        consistente = consistente && simples.removerUltimo()->getID() == tamanho &&
+                      dupla.removerUltimo()->getID() == tamanho;
+        if (tamanho > 0 && consistente) {
+            long id = esperado[gerador() % tamanho];
+            consistente = simples.buscarPeloId(id) && simples.buscarPeloId(id)->getID() == id &&
+                          dupla.removerPeloId(id)->getID() == id && !dupla.buscarPeloId(id);
+        }
+    }
+    return consistente;
+}
+
+void testarOrdenacao() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO: ORDENAÇÃO DAS LISTAS (MERGE SORT RELIGANDO NÓS)" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    std::cout << "\n1. Alunos por nota decrescente (empates na ordem original):" << std::endl;
+    ListaDuplamenteEncadeada alunos;
+    alunos.inserirNoFim(std::make_unique<Aluno>(1, "Ana", "Engenharia", 8.0));
+    alunos.inserirNoFim(std::make_unique<Aluno>(2, "Bruno", "Direito", 6.5));
+    alunos.inserirNoFim(std::make_unique<Aluno>(3, "Carla", "Medicina", 9.5));
+    alunos.inserirNoFim(std::make_unique<Aluno>(4, "Diego", "Engenharia", 8.0));
+    alunos.inserirNoFim(std::make_unique<Aluno>(5, "Elisa", "Direito", 6.5));
+    Elemento* primeiro = alunos.getPrimeiro();
+    alunos.ordenar([](const Elemento& a, const Elemento& b) {
+        return static_cast<const Aluno&>(a).getNota() > static_cast<const Aluno&>(b).getNota();
+    });
+    alunos.paraCada([](Elemento& elemento) {
+        const Aluno& aluno = static_cast<const Aluno&>(elemento);
+        std::cout << "  " << aluno.getNome() << " (" << aluno.getNota() << ")" << std::endl;
+    });
+    std::cout << "Mesmo objeto, agora na posição 1: "
+              << (alunos.obterElementoPorPosicao(1) == primeiro ? "sim" : "não") << std::endl;
+    
+    std::cout << "\n2. Funcionários por salário na lista simples:" << std::endl;
+    ListaSimplesmenteEncadeada funcionarios;
+    funcionarios.inserirNoFim(std::make_unique<Funcionario>(10, "Paulo", "Analista", "TI", 5200.0));
+    funcionarios.inserirNoFim(std::make_unique<Funcionario>(11, "Rita", "Gerente", "RH", 9100.0));
+    funcionarios.inserirNoFim(std::make_unique<Funcionario>(12, "Saulo", "Estagiário", "TI", 1800.0));
+    funcionarios.ordenar([](const Elemento& a, const Elemento& b) {
+        return static_cast<const Funcionario&>(a).getSalario() < static_cast<const Funcionario&>(b).getSalario();
+    });
+    for (int i = 0; i < funcionarios.getTamanho(); i++) {
+        const auto* funcionario = static_cast<const Funcionario*>(funcionarios.obterElementoPorPosicao(i));
+        std::cout << "  " << funcionario->getNome() << " (" << funcionario->getSalario() << ")" << std::endl;
+    }
+    
+    std::cout << "\n3. 60 listas aleatórias (0 a 400 elementos) comparadas com std::stable_sort:" << std::endl;
+    std::cout << "Sem pool: " << (conferirOrdenacoes(false, false) ? "OK" : "FALHA")
+              << " | Com pool: " << (conferirOrdenacoes(true, false) ? "OK" : "FALHA")
+              << " | Com índices: " << (conferirOrdenacoes(false, true) ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n✅ Teste da ordenação concluído!" << std::endl;
+}
+
+void testarPoolNos() {
+    std::cout << "\n" << std::string(60, '=') << std::endl;
+    std::cout << "TESTANDO POOL DE NÓS NAS LISTAS ENCADEADAS" << std::endl;
+    std::cout << std::string(60, '=') << std::endl;
+    
+    std::cout << "\n1. Lista simples com pool (rotatividade de fila):" << std::endl;
+    ListaSimplesmenteEncadeada simples(true);
+    for (int i = 0; i < 100; i++) {
+        simples.inserirNoFim(std::make_unique<Aluno>(i, "Aluno", "Curso", 7.0));
+    }
+    int slabsAntes = simples.getPoolNos()->getSlabsAlocados();
+    for (int i = 0; i < 10000; i++) {
+        simples.inserirNoFim(simples.removerPrimeiro());
+    }
+    bool ordemMantida = simples.getPrimeiro()->getID() == 10000 % 100;
+    std::cout << "Usa pool? " << (simples.usaPoolNos() ? "Sim" : "Não")
+              << " | Nós em uso: " << simples.getPoolNos()->getNosEmUso()
+              << " | Slabs antes/depois: " << slabsAntes << "/" << simples.getPoolNos()->getSlabsAlocados() << std::endl;
+    std::cout << "Nós reaproveitados sem novos slabs? "
+              << (slabsAntes == simples.getPoolNos()->getSlabsAlocados() ? "Sim" : "Não") << std::endl;
+    std::cout << "Ordem FIFO mantida? " << (ordemMantida ? "Sim" : "Não") << std::endl;
+    simples.removerPeloId(50);
+    simples.removerUltimo();
+    std::cout << "Após remover por ID e último - tamanho: " << simples.getTamanho()
+              << " | Nós em uso: " << simples.getPoolNos()->getNosEmUso() << std::endl;
+    
+    std::cout << "\n2. Lista dupla com pool (remoções no meio e nas pontas):" << std::endl;
+    ListaDuplamenteEncadeada dupla(true);
+    for (int i = 0; i < 5000; i++) {
+        dupla.inserirNoFim(std::make_unique<Produto>(i, "Item", "Categoria", "Marca", 1.0, 1));
+    }
+    auto doMeio = dupla.removerDaPosicao(2500);
+    auto daCabeca = dupla.removerPeloId(0);
+    auto daCauda = dupla.removerPeloId(4999);
+    std::cout << "Removidos (posição 2500, ID 0, ID 4999): "
+              << (doMeio ? doMeio->getID() : -1) << ", "
+              << (daCabeca ? daCabeca->getID() : -1) << ", "
+              << (daCauda ? daCauda->getID() : -1) << std::endl;
+    std::cout << "Tamanho: " << dupla.getTamanho()
+              << " | Nós em uso: " << dupla.getPoolNos()->getNosEmUso()
+              << " | Slabs: " << dupla.getPoolNos()->getSlabsAlocados()
+              << " (" << PoolNos::NOS_POR_SLAB_PADRAO << " nós por slab)" << std::endl;
+    dupla.limpar();
+    std::cout << "Após limpar - nós em uso: " << dupla.getPoolNos()->getNosEmUso() << std::endl;
+    
+    std::cout << "\n3. Lista circular com pool (rotações e remoção da cabeça):" << std::endl;
+    ListaDuplamenteEncadeadaCircular circular(true);
+    for (int i = 1; i <= 5; i++) {
+        circular.inserirNoFim(std::make_unique<Funcionario>(i, "Func", "Cargo", "Depto", 1000.0));
+    }
+    circular.rotacionarDireita(2);
+    circular.rotacionarEsquerda(1);
+    long cabecaAtual = circular.obterElementoPorPosicao(0)->getID();
+    auto removidoCabeca = circular.removerPeloId(cabecaAtual);
+    std::cout << "Cabeça após rotações: " << cabecaAtual
+              << " | Removida: " << (removidoCabeca ? removidoCabeca->getID() : -1)
+              << " | Tamanho: " << circular.getTamanho()
+              << " | Nós em uso: " << circular.getPoolNos()->getNosEmUso() << std::endl;
+    std::cout << "Integridade após remoção: " << (circular.verificarIntegridade() ? "OK" : "FALHA") << std::endl;
+    
+    std::cout << "\n✅ Teste do pool de nós concluído!" << std::endl;
 }
 
 void testarPilhaEncadeada() {
@@ -394,6 +1380,14 @@ int main() {
         testarListaSimplesmenteEncadeada();
         testarListaDuplamenteEncadeada();
         testarListaDuplamenteEncadeadaCircular();
+        testarPoolNos();
+        testarListaDesenrolada();
+        testarListaIntrusiva();
+        testarIndicePosicional();
+        testarIndiceIds();
+        testarDedoPosicional();
+        testarTransferencias();
+        testarOrdenacao();
         testarPilhaEncadeada();
         testarFilaEncadeada();
         testarDeque();
@@ -1,12 +1,23 @@
 #include "../src/estruturas_sequenciais/ListaNaoOrdenada.h"
 #include "../src/estruturas_sequenciais/ListaOrdenada.h"
+#include "../src/estruturas_sequenciais/KernelsEstoque.h"
+#include "../src/estruturas_sequenciais/TabelaAlunos.h"
+#include "../src/estruturas_sequenciais/TabelaFuncionarios.h"
+#include "../src/estruturas_sequenciais/TabelaProdutos.h"
+#include "../src/estruturas_sequenciais/ListaValores.h"
 #include "../src/elementos/Aluno.h"
 #include "../src/elementos/Funcionario.h"
 #include "../src/elementos/Produto.h"
 #include "../ConfigLocale.h"
+#include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <cmath>
 #include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
 
 /**
  * @brief Teste abrangente das estruturas de lista sequencial
@@ -91,6 +102,88 @@ void testarListaNaoOrdenada() {
     lista.imprimirLista();
 }
 
+/**
+ * @brief Compara as duas listas com um vetor de IDs de referência a cada operação
+ *
+ * Os IDs ficam copiados em um array paralelo aos ponteiros; qualquer
+ * deslocamento que esqueça a cópia aparece como uma busca errada.
+ */
+bool conferirIdsEmCache() {
+    std::mt19937 gerador(49);
+    ListaNaoOrdenada naoOrdenada(4096);
+    ListaOrdenada ordenada(4096);
+    std::vector<long> referencia;   // IDs da lista não ordenada, na ordem dela
+    bool correto = true;
+    
+    for (int operacao = 0; operacao < 2000 && correto; operacao++) {
+        long id = static_cast<long>(gerador() % 500);
+        switch (gerador() % 7) {
+            case 0:
+                naoOrdenada.InserirNoInicio(std::make_unique<Aluno>(id, "A", "Curso", 5.0));
+                referencia.insert(referencia.begin(), id);
+                ordenada.InserirOrdenado(std::make_unique<Aluno>(id, "A", "Curso", 5.0));
+                break;
+            case 1:
+            case 2:
+                naoOrdenada.InserirNoFinal(std::make_unique<Aluno>(id, "A", "Curso", 5.0));
+                referencia.push_back(id);
+                ordenada.InserirOrdenado(std::make_unique<Aluno>(id, "A", "Curso", 5.0));
+                break;
+            case 3: {
+                auto removido = naoOrdenada.RemoverPeloId(id);
+                auto it = std::find(referencia.begin(), referencia.end(), id);
+                correto = (removido != nullptr) == (it != referencia.end());
+                if (it != referencia.end()) {
+                    referencia.erase(it);
+                }
+                ordenada.RemoverPeloId(id);
+                break;
+            }
+            case 4: {
+                // Troca o ID: a cópia tem que mudar junto (e, na ordenada, a posição)
+                long novoId = static_cast<long>(gerador() % 500);
+                auto it = std::find(referencia.begin(), referencia.end(), id);
+                bool alterou = naoOrdenada.AlterarPeloId(id, std::make_unique<Aluno>(novoId, "B", "Curso", 6.0));
+                correto = alterou == (it != referencia.end());
+                if (it != referencia.end()) {
+                    *it = novoId;
+                }
+                ordenada.AlterarPeloId(id, std::make_unique<Aluno>(novoId, "B", "Curso", 6.0));
+                break;
+            }
+            case 5: {
+                int quantidade = static_cast<int>(gerador() % 3);
+                quantidade = naoOrdenada.RemoverPrimeiros(nullptr, quantidade);
+                referencia.erase(referencia.begin(), referencia.begin() + quantidade);
+                ordenada.RemoverPrimeiro();
+                break;
+            }
+            default:
+                if (naoOrdenada.RemoverPrimeiro()) {
+                    referencia.erase(referencia.begin());
+                }
+                ordenada.RemoverUltimo();
+                break;
+        }
+        
+        long procurado = static_cast<long>(gerador() % 500);
+        bool naReferencia = std::find(referencia.begin(), referencia.end(), procurado) != referencia.end();
+        Elemento* encontrado = naoOrdenada.BuscarPeloId(procurado);
+        correto = correto && naoOrdenada.getTamanho() == static_cast<int>(referencia.size()) &&
+                  (encontrado ? naReferencia && encontrado->getID() == procurado : !naReferencia);
+        encontrado = ordenada.BuscarPeloId(procurado);
+        correto = correto && ordenada.verificarOrdenacao() && (!encontrado || encontrado->getID() == procurado);
+    }
+    
+    // Posição esvaziada por ExtrairPorIndice guarda o ID antigo e não pode ser encontrada
+    if (correto && !naoOrdenada.estaVazia()) {
+        long extraido = naoOrdenada.ExtrairPorIndice(0)->getID();
+        Elemento* outro = naoOrdenada.BuscarPeloId(extraido);
+        correto = !outro || outro->getID() == extraido;
+    }
+    return correto;
+}
+
 void testarListaOrdenada() {
     std::cout << "\n\n=============== TESTE LISTA ORDENADA ===============" << std::endl;
     
@@ -189,6 +282,10 @@ void testarListaOrdenada() {
     
     std::cout << "\nEstado final da lista ordenada:" << std::endl;
     lista.imprimirLista();
+    
+    // Teste 7: cópia dos IDs ao lado dos ponteiros, sob inserções, remoções e alterações
+    std::cout << "\n7. IDs em cache após 2000 operações aleatórias nas duas listas: "
+              << (conferirIdsEmCache() ? "OK" : "FALHA") << std::endl;
 }
 
 void compararComplexidades() {
@@ -218,6 +315,349 @@ void compararComplexidades() {
     std::cout << "Lista Ordenada:     Busca muito mais eficiente O(log n)" << std::endl;
 }
 
+/**
+ * @brief Coleção mínima com paraCada e inserirNoFim, para importar e exportar as tabelas
+ */
+struct ColecaoElementos {
+    std::vector<std::unique_ptr<Elemento>> elementos;
+
+    template<typename Funcao>
+    void paraCada(Funcao funcao) const {
+        for (const auto& elemento : elementos) {
+            funcao(*elemento);
+        }
+    }
+
+    void inserirNoFim(std::unique_ptr<Elemento> elemento) {
+        elementos.push_back(std::move(elemento));
+    }
+};
+
+bool quaseIgual(double a, double b) {
+    return std::fabs(a - b) <= 1e-9 * std::max(1.0, std::fabs(a));
+}
+
+/**
+ * @brief Importa elementos aleatórios nas três tabelas e confere agregações
+ * e a volta para objetos contra os valores calculados sobre os objetos
+ */
+bool conferirTabelasColunares() {
+    const char* categorias[] = {"Eletrônicos", "Periféricos", "Móveis", "Papelaria", "Áudio"};
+    const char* cursos[] = {"Computação", "Engenharia", "Direito", "Medicina"};
+    const char* departamentos[] = {"TI", "RH", "Financeiro"};
+    std::mt19937 gerador(45);
+    ColecaoElementos origem;
+    for (int i = 0; i < 3000; i++) {
+        std::string nome = "Registro " + std::to_string(i);
+        switch (gerador() % 3) {
+            case 0:
+                origem.inserirNoFim(std::make_unique<Produto>(i, nome, categorias[gerador() % 5], "Marca",
+                                                              (gerador() % 100000) / 100.0, static_cast<int>(gerador() % 20)));
+                break;
+            case 1:
+                origem.inserirNoFim(std::make_unique<Aluno>(i, nome, cursos[gerador() % 4], (gerador() % 101) / 10.0));
+                break;
+            default:
+                origem.inserirNoFim(std::make_unique<Funcionario>(i, nome, "Cargo", departamentos[gerador() % 3],
+                                                                  1500.0 + gerador() % 10000));
+                break;
+        }
+    }
+
+    TabelaProdutos produtos;
+    TabelaAlunos alunos;
+    TabelaFuncionarios funcionarios;
+    int importados = produtos.importar(origem) + alunos.importar(origem) + funcionarios.importar(origem);
+    bool consistente = importados == static_cast<int>(origem.elementos.size());
+
+    // Os mesmos valores calculados objeto a objeto
+    double valorEstoque = 0.0, somaNotas = 0.0, folha = 0.0;
+    int disponiveis = 0, estoqueBaixo = 0, aprovados = 0;
+    std::vector<double> porCategoria(produtos.getCategorias().getNumeroValores(), 0.0);
+    std::vector<double> porDepartamento(funcionarios.getDepartamentos().getNumeroValores(), 0.0);
+    for (const auto& elemento : origem.elementos) {
+        if (const Produto* produto = dynamic_cast<const Produto*>(elemento.get())) {
+            valorEstoque += produto->calcularValorTotalEstoque();
+            disponiveis += produto->estaDisponivel();
+            estoqueBaixo += produto->getQuantidadeEstoque() < 5;
+            porCategoria[produtos.getCategorias().buscarCodigo(produto->getCategoria())] += produto->calcularValorTotalEstoque();
+        } else if (const Aluno* aluno = dynamic_cast<const Aluno*>(elemento.get())) {
+            somaNotas += aluno->getNota();
+            aprovados += aluno->getNota() >= 7.0;
+        } else {
+            const Funcionario& funcionario = static_cast<const Funcionario&>(*elemento);
+            folha += funcionario.getSalario();
+            porDepartamento[funcionarios.getDepartamentos().buscarCodigo(funcionario.getDepartamento())] += funcionario.getSalario();
+        }
+    }
+    consistente = consistente && quaseIgual(produtos.calcularValorTotalEstoque(), valorEstoque) &&
+                  produtos.contarDisponiveis() == disponiveis &&
+                  static_cast<int>(produtos.filtrarEstoqueBaixo(5).size()) == estoqueBaixo &&
+                  quaseIgual(alunos.mediaNotas(), somaNotas / alunos.getTamanho()) &&
+                  alunos.contarAprovados(7.0) == aprovados &&
+                  quaseIgual(funcionarios.somaSalarios(), folha);
+    std::vector<double> valores = produtos.valorEstoquePorCategoria();
+    for (std::size_t c = 0; c < valores.size() && consistente; c++) {
+        consistente = quaseIgual(valores[c], porCategoria[c]);
+    }
+    std::vector<double> folhas = funcionarios.folhaPorDepartamento();
+    for (std::size_t d = 0; d < folhas.size() && consistente; d++) {
+        consistente = quaseIgual(folhas[d], porDepartamento[d]);
+    }
+    for (int linha : produtos.filtrarEstoqueBaixo(5)) {
+        consistente = consistente && produtos.getQuantidadeEstoque(linha) < 5;
+    }
+
+    // Volta para objetos: mesma ordem e mesmos campos
+    ColecaoElementos copia;
+    produtos.exportar(copia);
+    alunos.exportar(copia);
+    funcionarios.exportar(copia);
+    int linha = 0;
+    for (const auto& elemento : copia.elementos) {
+        if (!consistente) {
+            break;
+        }
+        if (const Produto* produto = dynamic_cast<const Produto*>(elemento.get())) {
+            linha = produtos.buscarLinhaPorId(produto->getID());
+            consistente = produto->getNome() == produtos.getNome(linha) &&
+                          produto->getCategoria() == produtos.getCategoria(linha) &&
+                          produto->getPreco() == produtos.getPreco(linha) &&
+                          produto->getQuantidadeEstoque() == produtos.getQuantidadeEstoque(linha);
+        } else if (const Aluno* aluno = dynamic_cast<const Aluno*>(elemento.get())) {
+            linha = alunos.buscarLinhaPorId(aluno->getID());
+            consistente = aluno->getNome() == alunos.getNome(linha) && aluno->getCurso() == alunos.getCurso(linha) &&
+                          aluno->getNota() == alunos.getNota(linha);
+        } else {
+            const Funcionario& funcionario = static_cast<const Funcionario&>(*elemento);
+            linha = funcionarios.buscarLinhaPorId(funcionario.getID());
+            consistente = funcionario.getNome() == funcionarios.getNome(linha) &&
+                          funcionario.getDepartamento() == funcionarios.getDepartamento(linha) &&
+                          funcionario.getSalario() == funcionarios.getSalario(linha);
+        }
+    }
+    return consistente && copia.elementos.size() == origem.elementos.size() &&
+           produtos.paraProduto(produtos.getTamanho()) == nullptr && produtos.buscarLinhaPorId(-1) == -1;
+}
+
+/**
+ * @brief Confere as versões escalar e AVX2 dos laços de estoque em tamanhos
+ * que não são múltiplos do vetor, e a precisão da soma de Kahan
+ */
+bool conferirKernelsEstoque() {
+    typedef KernelsEstoque::Implementacao Implementacao;
+    typedef KernelsEstoque::ModoSoma ModoSoma;
+    std::mt19937 gerador(46);
+    bool consistente = true;
+    for (int n = 0; n < 5000 && consistente; n += 1 + n / 8) {
+        std::vector<double> precos(n);
+        std::vector<int> quantidades(n);
+        for (int i = 0; i < n; i++) {
+            precos[i] = (gerador() % 1000000) / 100.0;
+            quantidades[i] = static_cast<int>(gerador() % 40) - 5;  // Inclui zeros e negativos
+        }
+        std::vector<int> escalar, avx2;
+        KernelsEstoque::filtrarAbaixoDe(quantidades.data(), n, 3, escalar, Implementacao::Escalar);
+        KernelsEstoque::filtrarAbaixoDe(quantidades.data(), n, 3, avx2, Implementacao::Avx2);
+        double simples = KernelsEstoque::valorTotal(precos.data(), quantidades.data(), n, ModoSoma::Simples, Implementacao::Escalar);
+        double kahan = KernelsEstoque::valorTotal(precos.data(), quantidades.data(), n, ModoSoma::Kahan, Implementacao::Escalar);
+        consistente = escalar == avx2 &&
+                      KernelsEstoque::contarPositivos(quantidades.data(), n, Implementacao::Escalar) ==
+                      KernelsEstoque::contarPositivos(quantidades.data(), n, Implementacao::Avx2) &&
+                      quaseIgual(simples, KernelsEstoque::valorTotal(precos.data(), quantidades.data(), n, ModoSoma::Simples, Implementacao::Avx2)) &&
+                      quaseIgual(kahan, KernelsEstoque::valorTotal(precos.data(), quantidades.data(), n, ModoSoma::Kahan, Implementacao::Avx2));
+    }
+
+    // Um valor grande seguido de um milhão de parcelas pequenas: a soma simples perde
+    // boa parte delas no arredondamento, a de Kahan não
+    const int n = 1000001;
+    std::vector<double> precos(n, 0.01);
+    std::vector<int> quantidades(n, 1);
+    precos[0] = 1e15;
+    double esperado = 1e15 + 10000.0;
+    for (Implementacao implementacao : {Implementacao::Escalar, Implementacao::Avx2}) {
+        double simples = KernelsEstoque::valorTotal(precos.data(), quantidades.data(), n, ModoSoma::Simples, implementacao);
+        double kahan = KernelsEstoque::valorTotal(precos.data(), quantidades.data(), n, ModoSoma::Kahan, implementacao);
+        consistente = consistente && std::fabs(kahan - esperado) < 0.5 &&
+                      std::fabs(kahan - esperado) <= std::fabs(simples - esperado);
+    }
+    return consistente;
+}
+
+void testarTabelasColunares() {
+    std::cout << "\n\n============= TABELAS COLUNARES =============" << std::endl;
+
+    TabelaProdutos estoque;
+    estoque.adicionar(7891001, "Notebook", "Eletrônicos", "Dell", 2500.0, 10);
+    estoque.adicionar(7891002, "Mouse", "Periféricos", "Logitech", 50.0, 0);
+    estoque.adicionar(7891003, "Teclado", "Periféricos", "Logitech", 120.0, 3);
+    estoque.adicionar(Produto(7891004, "Monitor", "Eletrônicos", "LG", 900.0, 4));
+
+    std::cout << "\n1. Estoque com " << estoque.getTamanho() << " produtos e "
+              << estoque.getCategorias().getNumeroValores() << " categorias:" << std::endl;
+    std::cout << "Valor total: " << estoque.calcularValorTotalEstoque()
+              << " | Disponíveis: " << estoque.contarDisponiveis() << std::endl;
+    std::cout << "Estoque abaixo de 5:";
+    for (int linha : estoque.filtrarEstoqueBaixo(5)) {
+        std::cout << " " << estoque.getNome(linha) << " (" << estoque.getQuantidadeEstoque(linha) << ")";
+    }
+    std::cout << std::endl;
+    std::vector<double> porCategoria = estoque.valorEstoquePorCategoria();
+    for (std::size_t c = 0; c < porCategoria.size(); c++) {
+        std::cout << "  " << estoque.getCategorias().valorDoCodigo(static_cast<std::uint32_t>(c))
+                  << ": " << porCategoria[c] << std::endl;
+    }
+
+    std::cout << "\n2. Folha por departamento após reajuste de 10%:" << std::endl;
+    TabelaFuncionarios equipe;
+    equipe.adicionar(100001, "João Santos", "Dev", "TI", 5500.0);
+    equipe.adicionar(100002, "Maria Silva", "Gerente", "RH", 8000.0);
+    equipe.adicionar(100003, "Pedro Lima", "Dev", "TI", 4500.0);
+    equipe.aplicarReajuste(10.0);
+    std::vector<double> folhas = equipe.folhaPorDepartamento();
+    for (std::size_t d = 0; d < folhas.size(); d++) {
+        std::cout << "  " << equipe.getDepartamentos().valorDoCodigo(static_cast<std::uint32_t>(d))
+                  << ": " << folhas[d] << std::endl;
+    }
+
+    std::cout << "\n3. Linha de volta para objeto:" << std::endl;
+    TabelaAlunos turma;
+    turma.adicionar(20231005, "Maria Silva", "Computação", 8.5);
+    turma.paraAluno(0)->imprimirInfo();
+
+    std::cout << "\n4. 3000 elementos mistos importados, agregados e exportados: "
+              << (conferirTabelasColunares() ? "OK" : "FALHA") << std::endl;
+
+    std::cout << "\n5. Laços de estoque escalar vs AVX2 (AVX2 neste processador: "
+              << (KernelsEstoque::avx2Disponivel() ? "sim" : "não") << "), soma simples e de Kahan: "
+              << (conferirKernelsEstoque() ? "OK" : "FALHA") << std::endl;
+}
+
+/**
+ * @brief Importa 2000 elementos mistos para uma ListaValores, faz operações
+ * aleatórias conferindo com um vetor de IDs e exporta de volta
+ */
+bool conferirListaValores() {
+    std::mt19937 gerador(50);
+    ColecaoElementos origem;
+    for (int i = 0; i < 2000; i++) {
+        std::string nome = "Registro " + std::to_string(i);
+        switch (gerador() % 3) {
+            case 0:
+                origem.inserirNoFim(std::make_unique<Produto>(i, nome, "Categoria", "Marca", i / 10.0, i % 7));
+                break;
+            case 1:
+                origem.inserirNoFim(std::make_unique<Aluno>(i, nome, "Curso", (i % 101) / 10.0));
+                break;
+            default:
+                origem.inserirNoFim(std::make_unique<Funcionario>(i, nome, "Cargo", "Departamento", 1500.0 + i));
+                break;
+        }
+    }
+
+    ListaValores lista;
+    bool consistente = lista.importar(origem) == 2000 && lista.getTamanho() == 2000;
+
+    // Mesmo tipo, mesmos campos e o objeto dentro do próprio vetor
+    const char* inicio = reinterpret_cast<const char*>(lista.obterPorIndice(0));
+    const char* fim = reinterpret_cast<const char*>(lista.obterPorIndice(lista.getTamanho() - 1) + 1);
+    for (int i = 0; i < lista.getTamanho() && consistente; i++) {
+        const ElementoValor& valor = *lista.obterPorIndice(i);
+        const Elemento& original = *origem.elementos[i];
+        const char* objeto = reinterpret_cast<const char*>(&valor.comoElemento());
+        consistente = valor.getID() == original.getID() && objeto >= inicio && objeto < fim &&
+                      valor.guarda<Aluno>() == (dynamic_cast<const Aluno*>(&original) != nullptr) &&
+                      valor.guarda<Funcionario>() == (dynamic_cast<const Funcionario*>(&original) != nullptr) &&
+                      valor.guarda<Produto>() == (dynamic_cast<const Produto*>(&original) != nullptr) &&
+                      valor.visitar([](const auto& objeto) { return objeto.getNome(); }) == "Registro " + std::to_string(i);
+    }
+
+    std::vector<long> esperado;
+    for (int i = 0; i < 2000; i++) {
+        esperado.push_back(i);
+    }
+    for (int operacao = 0; operacao < 2000 && consistente; operacao++) {
+        long id = static_cast<long>(gerador() % 2500);
+        bool presente = std::find(esperado.begin(), esperado.end(), id) != esperado.end();
+        switch (gerador() % 4) {
+            case 0: {
+                std::optional<ElementoValor> removido = lista.removerPeloId(id);
+                consistente = removido.has_value() == presente && (!removido || removido->getID() == id);
+                esperado.erase(std::remove(esperado.begin(), esperado.end(), id), esperado.end());
+                break;
+            }
+            case 1:
+                if (!presente) {
+                    lista.construirNoFim<Aluno>(id, "Novo " + std::to_string(id), "Curso", 5.0);
+                    esperado.push_back(id);
+                }
+                break;
+            case 2: {
+                // Às vezes troca também o ID: a cópia dos IDs precisa acompanhar
+                long novoId = gerador() % 2 ? id : id + 10000;
+                bool livre = std::find(esperado.begin(), esperado.end(), novoId) == esperado.end();
+                if (novoId != id && !livre) {
+                    break;
+                }
+                consistente = lista.alterarPeloId(id, Produto(novoId, "Alterado", "Categoria", "Marca", 1.0, 1)) == presente &&
+                              (!presente || lista.buscarPeloId(novoId)->como<Produto>()->getNome() == "Alterado");
+                std::replace(esperado.begin(), esperado.end(), id, novoId);
+                break;
+            }
+            default: {
+                const ElementoValor* encontrado = static_cast<const ListaValores&>(lista).buscarPeloId(id);
+                consistente = (encontrado != nullptr) == presente && (!encontrado || encontrado->getID() == id);
+                break;
+            }
+        }
+    }
+    for (int i = 0; i < lista.getTamanho() && consistente; i++) {
+        consistente = lista.obterPorIndice(i)->getID() == esperado[i] && lista.buscarPeloId(esperado[i]) == lista.obterPorIndice(i);
+    }
+
+    // Volta para o heap: mesma ordem, mesmos tipos
+    ColecaoElementos copia;
+    lista.exportar(copia);
+    for (std::size_t i = 0; i < copia.elementos.size() && consistente; i++) {
+        std::optional<ElementoValor> denovo = ElementoValor::copiarDe(*copia.elementos[i]);
+        consistente = denovo && denovo->getID() == esperado[i] &&
+                      denovo->guarda<Aluno>() == lista.obterPorIndice(static_cast<int>(i))->guarda<Aluno>() &&
+                      denovo->guarda<Produto>() == lista.obterPorIndice(static_cast<int>(i))->guarda<Produto>();
+    }
+    return consistente && copia.elementos.size() == esperado.size() &&
+           lista.obterPorIndice(-1) == nullptr && lista.obterPorIndice(lista.getTamanho()) == nullptr;
+}
+
+void testarListaValores() {
+    std::cout << "\n\n============= LISTA DE VALORES (std::variant) =============" << std::endl;
+
+    ListaValores cadastro;
+    cadastro.inserirNoFim(Aluno(20231001, "Ana Costa", "Computação", 9.0));
+    cadastro.inserirNoFim(Funcionario(100001, "João Santos", "Dev", "TI", 5500.0));
+    cadastro.construirNoFim<Produto>(7891001L, "Notebook", "Eletrônicos", "Dell", 2500.0, 10);
+
+    std::cout << "\n1. Três tipos guardados por valor (" << sizeof(ElementoValor) << " bytes cada):" << std::endl;
+    cadastro.imprimirLista();
+
+    std::cout << "\n2. Visita por tipo:" << std::endl;
+    double folha = 0.0, estoque = 0.0;
+    cadastro.paraCada([&folha, &estoque](const ElementoValor& elemento) {
+        if (const Funcionario* funcionario = elemento.como<Funcionario>()) {
+            folha += funcionario->getSalario();
+        } else if (const Produto* produto = elemento.como<Produto>()) {
+            estoque += produto->calcularValorTotalEstoque();
+        }
+    });
+    std::cout << "Folha: " << folha << " | Valor em estoque: " << estoque << std::endl;
+
+    std::cout << "\n3. Remoção do ID 100001: "
+              << (cadastro.removerPeloId(100001) && !cadastro.buscarPeloId(100001) && cadastro.getTamanho() == 2 ? "OK" : "FALHA")
+              << std::endl;
+
+    std::cout << "\n4. 2000 elementos mistos importados, alterados e exportados: "
+              << (conferirListaValores() ? "OK" : "FALHA") << std::endl;
+}
+
 int main() {
     // Configura locale para português
     CONFIGURAR_PORTUGUES();
@@ -230,6 +670,8 @@ int main() {
         testarListaNaoOrdenada();
         testarListaOrdenada();
         compararComplexidades();
+        testarTabelasColunares();
+        testarListaValores();
         
         std::cout << "\n\nTODOS OS TESTES CONCLUÍDOS COM SUCESSO! " << std::endl;
         std::cout << "Lista Não Ordenada: Funcional" << std::endl;
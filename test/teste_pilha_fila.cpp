@@ -1,4 +1,5 @@
 #include "../src/estruturas_sequenciais/Pilha.h"
+#include "../src/estruturas_sequenciais/PilhaOtimizada.h"
 #include "../src/estruturas_sequenciais/Fila.h"
 #include "../src/estruturas_sequenciais/FilaOtimizada.h"
 #include "../src/elementos/Aluno.h"
@@ -67,9 +68,55 @@ void testarPilha() {
     std::cout << "Resultado: " << (elementoVazio ? "Elemento retornado" : "nullptr - Pilha vazia") << std::endl;
 }
 
+void testarPilhaOtimizada() {
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: PILHA OTIMIZADA (Buffer Interno)" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    
+    PilhaOtimizada pilha;
+    
+    std::cout << "\n1. Pilha nova:" << std::endl;
+    std::cout << "Pilha vazia? " << (pilha.pilhaVazia() ? "Sim" : "Não") << std::endl;
+    std::cout << "Capacidade inicial: " << pilha.getCapacidade()
+              << " (buffer interno: " << (pilha.usandoBufferInterno() ? "Sim" : "Não") << ")" << std::endl;
+    std::cout << "Empilhando nullptr: " << (pilha.empilhar(nullptr) ? "Sucesso" : "Falha - elemento nulo") << std::endl;
+    
+    std::cout << "\n2. Empilhando até encher o buffer interno:" << std::endl;
+    for (int i = 1; i <= PilhaOtimizada::CAPACIDADE_INTERNA; i++) {
+        pilha.empilhar(std::make_unique<Produto>(i, "Item", "Pilha", "Marca", 10.0, 1));
+    }
+    std::cout << "Tamanho: " << pilha.getTamanho()
+              << " | Buffer interno: " << (pilha.usandoBufferInterno() ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n3. Empilhando além do buffer interno (migra para o heap):" << std::endl;
+    for (int i = PilhaOtimizada::CAPACIDADE_INTERNA + 1; i <= 40; i++) {
+        pilha.empilhar(std::make_unique<Produto>(i, "Item", "Pilha", "Marca", 10.0, 1));
+    }
+    std::cout << "Tamanho: " << pilha.getTamanho() << " | Capacidade: " << pilha.getCapacidade()
+              << " | Buffer interno: " << (pilha.usandoBufferInterno() ? "Sim" : "Não") << std::endl;
+    std::cout << "Topo: ID=" << pilha.consultarTopo()->getID() << std::endl;
+    
+    std::cout << "\n4. Desempilhando tudo (ordem LIFO):" << std::endl;
+    long esperado = 40;
+    bool ordemLifo = true;
+    while (auto elemento = pilha.desempilhar()) {
+        ordemLifo = ordemLifo && elemento->getID() == esperado;
+        esperado--;
+    }
+    std::cout << "Ordem LIFO preservada após a migração: " << (ordemLifo && esperado == 0 ? "Sim" : "Não") << std::endl;
+    std::cout << "Desempilhar de pilha vazia: " << (pilha.desempilhar() ? "Elemento retornado" : "nullptr - Pilha vazia") << std::endl;
+    
+    std::cout << "\n5. Reutilizando a pilha e limpando:" << std::endl;
+    pilha.empilhar(std::make_unique<Aluno>(1, "Ana Costa", "Matemática", 9.0));
+    pilha.empilhar(std::make_unique<Funcionario>(2, "Pedro Lima", "Analista", "RH", 4500.0));
+    pilha.imprimirPilha();
+    pilha.limpar();
+    std::cout << "Pilha vazia após limpar? " << (pilha.pilhaVazia() ? "Sim" : "Não") << std::endl;
+}
+
 void testarFila() {
     std::cout << "\n" << std::string(50, '=') << std::endl;
-    std::cout << "TESTANDO ESTRUTURA: FILA (Versão Ineficiente)" << std::endl;
+    std::cout << "TESTANDO ESTRUTURA: FILA (Composição com Deslocamento de Cabeça)" << std::endl;
     std::cout << std::string(50, '=') << std::endl;
     
     Fila fila(4);  // Capacidade máxima de 4 elementos
@@ -185,16 +232,69 @@ void testarFilaOtimizada() {
     std::cout << "\nFila vazia? " << (filaOpt.filaVazia() ? "Sim" : "Não") << std::endl;
 }
 
+void testarOperacoesEmLote() {
+    std::cout << "\n" << std::string(50, '=') << std::endl;
+    std::cout << "TESTANDO OPERAÇÕES EM LOTE (Fila e FilaOtimizada)" << std::endl;
+    std::cout << std::string(50, '=') << std::endl;
+    
+    std::cout << "\n1. FilaOtimizada: lote atravessando o fim do buffer:" << std::endl;
+    FilaOtimizada filaOpt(5);
+    std::unique_ptr<Elemento> lote[6];
+    for (int i = 0; i < 3; i++) {
+        lote[i] = std::make_unique<Produto>(i + 1, "Item", "Lote", "Marca", 10.0, 1);
+    }
+    std::cout << "Enfileirados (3 pedidos): " << filaOpt.enfileirarLote(lote, 3) << std::endl;
+    
+    std::unique_ptr<Elemento> saida[6];
+    std::cout << "Desenfileirados (2 pedidos): " << filaOpt.desenfileirarLote(saida, 2) << std::endl;
+    std::cout << "IDs removidos: " << saida[0]->getID() << ", " << saida[1]->getID() << std::endl;
+    
+    // Início agora está no índice 2: um lote de 4 ocupa os índices 3, 4, 0 e 1
+    for (int i = 0; i < 6; i++) {
+        lote[i] = std::make_unique<Produto>(i + 4, "Item", "Lote", "Marca", 10.0, 1);
+    }
+    int enfileirados = filaOpt.enfileirarLote(lote, 6);
+    std::cout << "Enfileirados (6 pedidos, 4 livres): " << enfileirados << std::endl;
+    std::cout << "Elementos que não couberam continuam no lote: "
+              << (lote[4] && lote[5] ? "Sim" : "Não") << std::endl;
+    std::cout << "Fila cheia? " << (filaOpt.filaCheia() ? "Sim" : "Não") << std::endl;
+    
+    int removidos = filaOpt.desenfileirarLote(saida, 6);
+    std::cout << "Desenfileirados (6 pedidos): " << removidos << " -> IDs:";
+    bool ordemFifo = true;
+    for (int i = 0; i < removidos; i++) {
+        std::cout << " " << saida[i]->getID();
+        ordemFifo = ordemFifo && saida[i]->getID() == i + 3;
+    }
+    std::cout << std::endl;
+    std::cout << "Ordem FIFO preservada na volta do buffer: " << (ordemFifo ? "Sim" : "Não") << std::endl;
+    
+    std::cout << "\n2. Fila (composição): lote limitado pela capacidade:" << std::endl;
+    Fila fila(4);
+    for (int i = 0; i < 6; i++) {
+        lote[i] = std::make_unique<Aluno>(i + 1, "Aluno", "Curso", 7.0);
+    }
+    std::cout << "Enfileirados (6 pedidos, capacidade 4): " << fila.enfileirarLote(lote, 6) << std::endl;
+    removidos = fila.desenfileirarLote(saida, 3);
+    std::cout << "Desenfileirados (3 pedidos): " << removidos << " -> IDs:";
+    for (int i = 0; i < removidos; i++) {
+        std::cout << " " << saida[i]->getID();
+    }
+    std::cout << std::endl;
+    std::cout << "Frente da fila após o lote: ID=" << fila.consultarFrente()->getID() << std::endl;
+    std::cout << "Tamanho restante: " << fila.getTamanho() << std::endl;
+}
+
 void compararPerformance() {
     std::cout << "\n" << std::string(60, '=') << std::endl;
     std::cout << "COMPARAÇÃO DE PERFORMANCE: FILA vs FILA OTIMIZADA" << std::endl;
     std::cout << std::string(60, '=') << std::endl;
     
-    std::cout << "\nFILA INEFICIENTE (Lista Sequencial):" << std::endl;
+    std::cout << "\nFILA (Lista Sequencial + Deslocamento de Cabeça):" << std::endl;
     std::cout << "- Enfileirar: O(1) - inserção no final" << std::endl;
-    std::cout << "- Desenfileirar: O(n) - remoção do início com deslocamento" << std::endl;
-    std::cout << "- Problema: A cada desenfileiramento, todos os elementos" << std::endl;
-    std::cout << "  restantes precisam ser deslocados uma posição." << std::endl;
+    std::cout << "- Desenfileirar: O(1) amortizado - avança o índice da frente" << std::endl;
+    std::cout << "- Custo: as posições consumidas só são descartadas quando" << std::endl;
+    std::cout << "  ocupam metade da lista (um deslocamento a cada várias remoções)." << std::endl;
     
     std::cout << "\nFILA OTIMIZADA (Buffer Circular):" << std::endl;
     std::cout << "- Enfileirar: O(1) - inserção na posição circular" << std::endl;
@@ -203,8 +303,8 @@ void compararPerformance() {
     std::cout << "  movimentação dos índices de início e fim." << std::endl;
     
     std::cout << "\nCONCLUSÃO:" << std::endl;
-    std::cout << "Para operações frequentes de enfileirar/desenfileirar," << std::endl;
-    std::cout << "a FilaOtimizada é significativamente mais eficiente!" << std::endl;
+    std::cout << "Ambas drenam em tempo linear; a FilaOtimizada evita até" << std::endl;
+    std::cout << "mesmo as compactações periódicas e usa só 'capacidade' posições." << std::endl;
 }
 
 int main() {
@@ -217,8 +317,10 @@ int main() {
     
     try {
         testarPilha();
+        testarPilhaOtimizada();
         testarFila();
         testarFilaOtimizada();
+        testarOperacoesEmLote();
         compararPerformance();
         
         std::cout << "\n" << std::string(60, '=') << std::endl;